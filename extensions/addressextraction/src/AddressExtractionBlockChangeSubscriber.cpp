@@ -39,6 +39,10 @@ namespace catapult { namespace addressextraction {
 				// nothing to intercept
 			}
 
+			void flush() override {
+				// nothing to intercept
+			}
+
 		private:
 			const AddressExtractor& m_extractor;
 		};
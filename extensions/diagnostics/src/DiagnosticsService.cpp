@@ -24,12 +24,16 @@
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/handlers/DiagnosticHandlers.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/utils/DiagnosticHistogramCounter.h"
 
 namespace catapult { namespace diagnostics {
 
 	namespace {
-		thread::Task CreateLoggingTask(const std::vector<utils::DiagnosticCounter>& counters) {
-			return thread::CreateNamedTask("logging task", [counters]() {
+		using DiagnosticCounters = std::vector<utils::DiagnosticCounter>;
+		using DiagnosticHistogramCounters = std::vector<utils::DiagnosticHistogramCounter>;
+
+		thread::Task CreateLoggingTask(const DiagnosticCounters& counters, const DiagnosticHistogramCounters& histogramCounters) {
+			return thread::CreateNamedTask("logging task", [counters, histogramCounters]() {
 				std::ostringstream table;
 				table << "--- current counter values ---";
 				for (const auto& counter : counters) {
@@ -37,16 +41,32 @@ namespace catapult { namespace diagnostics {
 					table << std::endl << counter.id().name() << " : " << counter.value();
 				}
 
+				table << std::endl << "--- current histogram values (count / p50 / p90 / p99 / max) ---";
+				for (const auto& histogramCounter : histogramCounters) {
+					auto values = histogramCounter.values();
+					table.width(utils::DiagnosticCounterId::Max_Counter_Name_Size);
+					table
+							<< std::endl << histogramCounter.id().name() << " : " << values.count()
+							<< " / " << values.percentile(50)
+							<< " / " << values.percentile(90)
+							<< " / " << values.percentile(99)
+							<< " / " << values.max();
+				}
+
 				CATAPULT_LOG(info) << table.str();
 				return thread::make_ready_future(thread::TaskResult::Continue);
 			});
 		}
 
-		void AddDiagnosticHandlers(const std::vector<utils::DiagnosticCounter>& counters, extensions::ServiceState& state) {
+		void AddDiagnosticHandlers(
+				const DiagnosticCounters& counters,
+				const DiagnosticHistogramCounters& histogramCounters,
+				extensions::ServiceState& state) {
 			auto& handlers = state.packetHandlers();
 			handlers.setAllowedHosts(state.config().Node.TrustedHosts);
 
 			handlers::RegisterDiagnosticCountersHandler(handlers, counters);
+			handlers::RegisterDiagnosticHistogramsHandler(handlers, histogramCounters);
 			handlers::RegisterDiagnosticNodesHandler(handlers, state.nodes());
 			handlers::RegisterDiagnosticBlockStatementHandler(handlers, state.storage());
 			state.pluginManager().addDiagnosticHandlers(handlers, state.cache());
@@ -69,11 +89,17 @@ namespace catapult { namespace diagnostics {
 				auto counters = state.counters();
 				counters.insert(counters.end(), locator.counters().cbegin(), locator.counters().cend());
 
+				// merge all histogram counters
+				auto histogramCounters = locator.histogramCounters();
+				histogramCounters.emplace_back(utils::DiagnosticCounterId("PKT HANDLE"), [&handlers = state.packetHandlers()]() {
+					return handlers.processHistogram().values();
+				});
+
 				// add task
-				state.tasks().push_back(CreateLoggingTask(counters));
+				state.tasks().push_back(CreateLoggingTask(counters, histogramCounters));
 
 				// add packet handlers
-				AddDiagnosticHandlers(counters, state);
+				AddDiagnosticHandlers(counters, histogramCounters, state);
 			}
 		};
 	}
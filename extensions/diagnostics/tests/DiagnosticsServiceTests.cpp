@@ -21,6 +21,7 @@
 
 #include "diagnostics/src/DiagnosticsService.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DiagnosticHistogramValue.h"
 #include "tests/test/core/HandlersTrustedHostTests.h"
 #include "tests/test/core/PacketPayloadTestUtils.h"
 #include "tests/test/local/ServiceLocatorTestContext.h"
@@ -69,9 +70,10 @@ namespace catapult { namespace diagnostics {
 		context.boot();
 		const auto& packetHandlers = context.testState().state().packetHandlers();
 
-		// Assert: three default handlers were added
-		EXPECT_EQ(4u, packetHandlers.size());
+		// Assert: four default handlers were added
+		EXPECT_EQ(5u, packetHandlers.size());
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Diagnostic_Counters)); // the default (counters) diagnostic handler
+		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Diagnostic_Histograms)); // the default (histograms) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Active_Node_Infos)); // the default (nodes) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Block_Statement)); // the default (statements) diagnostic handler
 		EXPECT_TRUE(packetHandlers.canProcess(ionet::PacketType::Chain_Statistics)); // the diagnostic handler hook registered above
@@ -115,4 +117,38 @@ namespace catapult { namespace diagnostics {
 		EXPECT_EQ(Num_Counters, actualCounterNames.size());
 		EXPECT_EQ(std::set<std::string>({ "ALPHA", "BETA" }), actualCounterNames);
 	}
+
+	TEST(TEST_CLASS, HistogramCountersAreSourcedFromLocatorAndPacketHandlers) {
+		// Arrange: add histogram counter to locator
+		constexpr auto Num_Histogram_Counters = 2u;
+		TestContext context;
+		context.locator().registerServiceHistogram<uint32_t>("A SERVICE", "ALPHA", [](const auto&) {
+			return utils::DiagnosticHistogramValues();
+		});
+
+		// Act:
+		context.boot();
+		const auto& packetHandlers = context.testState().state().packetHandlers();
+
+		// - process a histograms request
+		auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+		pPacket->Type = ionet::PacketType::Diagnostic_Histograms;
+		ionet::ServerPacketHandlerContext handlerContext;
+		EXPECT_TRUE(packetHandlers.process(*pPacket, handlerContext));
+
+		// Assert: header is correct and contains the expected number of histogram counters
+		auto expectedPacketSize = sizeof(ionet::PacketHeader) + Num_Histogram_Counters * sizeof(model::DiagnosticHistogramValue);
+		test::AssertPacketHeader(handlerContext, expectedPacketSize, ionet::PacketType::Diagnostic_Histograms);
+
+		// - check the histogram counter names
+		std::set<std::string> actualHistogramCounterNames;
+		const auto* pHistogramValue = reinterpret_cast<const model::DiagnosticHistogramValue*>(test::GetSingleBufferData(handlerContext));
+		for (auto i = 0u; i < Num_Histogram_Counters; ++i) {
+			actualHistogramCounterNames.insert(utils::DiagnosticCounterId(pHistogramValue->Id).name());
+			++pHistogramValue;
+		}
+
+		EXPECT_EQ(Num_Histogram_Counters, actualHistogramCounterNames.size());
+		EXPECT_EQ(std::set<std::string>({ "ALPHA", "PKT HANDLE" }), actualHistogramCounterNames);
+	}
 }}
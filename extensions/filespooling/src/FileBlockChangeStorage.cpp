@@ -53,6 +53,10 @@ namespace catapult { namespace filespooling {
 				m_pOutputStream->flush();
 			}
 
+			void flush() override {
+				// empty because each change is flushed as a separate message in notifyBlock and notifyDropBlocksAfter
+			}
+
 		private:
 			std::unique_ptr<io::OutputStream> m_pOutputStream;
 		};
@@ -26,10 +26,12 @@
 #include "finalization/src/ionet/FinalizationMessagePacketUtils.h"
 #include "finalization/src/model/FinalizationRoundRange.h"
 #include "catapult/consumers/RecentHashCache.h"
+#include "catapult/crypto/SecureRandomGenerator.h"
 #include "catapult/extensions/DispatcherUtils.h"
 #include "catapult/extensions/ServiceState.h"
 #include "catapult/extensions/ServiceUtils.h"
 #include "catapult/thread/MultiServicePool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/ThrottleLogger.h"
 
 namespace catapult { namespace finalization {
@@ -48,6 +50,44 @@ namespace catapult { namespace finalization {
 			return model::FinalizationRoundRange(view.minFinalizationRound(), view.maxFinalizationRound());
 		}
 
+		using Messages = std::vector<std::shared_ptr<model::FinalizationMessage>>;
+
+		// each message has two signatures (root and bottom), so this fills a single donna batch
+		constexpr size_t Min_Messages_Per_Partition = 32;
+
+		void FillSecureRandom(uint8_t* pOut, size_t count) {
+			crypto::SecureRandomGenerator().fill(pOut, count);
+		}
+
+		void VerifyAndAddMessages(
+				chain::MultiRoundMessageAggregator& messageAggregator,
+				thread::IoThreadPool& messageProcessingPool,
+				Messages&& messages) {
+			// verify all message signatures in parallel batches outside of the aggregator lock
+			auto pMessages = std::make_shared<Messages>(std::move(messages));
+			auto numPartitions = std::max<size_t>(1, pMessages->size() / Min_Messages_Per_Partition);
+			numPartitions = std::min<size_t>(numPartitions, messageProcessingPool.numWorkerThreads());
+
+			auto partitionCallback = [&messageAggregator, pMessages](auto itBegin, auto itEnd, auto, auto) {
+				auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
+				auto verifyResults = model::VerifyMessageSignatures(FillSecureRandom, &*itBegin, count);
+
+				auto i = 0u;
+				for (auto iter = itBegin; itEnd != iter; ++iter, ++i) {
+					const auto& pMessage = *iter;
+					auto addResult = verifyResults[i]
+							? messageAggregator.modifier().addVerified(pMessage)
+							: chain::RoundMessageAggregatorAddResult::Failure_Processing;
+					if (addResult < chain::RoundMessageAggregatorAddResult::Neutral_Redundant) {
+						auto messageHash = model::CalculateMessageHash(*pMessage);
+						CATAPULT_LOG(warning) << "finalization message " << messageHash << " rejected due to " << addResult;
+					}
+				}
+			};
+
+			thread::ParallelForPartition(messageProcessingPool.ioContext(), *pMessages, numPartitions, partitionCallback);
+		}
+
 		class FinalizationMessageProcessingServiceRegistrar : public extensions::ServiceRegistrar {
 		public:
 			explicit FinalizationMessageProcessingServiceRegistrar(const FinalizationConfiguration& config) : m_config(config)
@@ -75,6 +115,7 @@ namespace catapult { namespace finalization {
 				auto& hooks = GetFinalizationServerHooks(locator);
 				hooks.setMessageRangeConsumer([&messageAggregator, &messageProcessingPool, pRecentHashCache, messagesSink](
 						auto&& messages) {
+					auto pendingMessages = Messages();
 					auto newMessages = ionet::FinalizationMessages();
 					auto extractedMessages = model::FinalizationMessageRange::ExtractEntitiesFromRange(std::move(messages.Range));
 					CATAPULT_LOG(trace) << "received " << extractedMessages.size() << " messages from peer " << messages.SourceIdentity;
@@ -94,16 +135,15 @@ namespace catapult { namespace finalization {
 						if (!pRecentHashCache->add(messageHash))
 							continue;
 
-						messageProcessingPool.ioContext().dispatch([&messageAggregator, pMessage, messageHash]() {
-							auto addResult = messageAggregator.modifier().add(pMessage);
-							if (addResult < chain::RoundMessageAggregatorAddResult::Neutral_Redundant)
-								CATAPULT_LOG(warning) << "finalization message " << messageHash << " rejected due to " << addResult;
-						});
+						pendingMessages.push_back(pMessage);
 						newMessages.push_back(pMessage);
 					}
 
-					if (!newMessages.empty())
-						messagesSink(newMessages);
+					if (newMessages.empty())
+						return;
+
+					VerifyAndAddMessages(messageAggregator, messageProcessingPool, std::move(pendingMessages));
+					messagesSink(newMessages);
 				});
 			}
 
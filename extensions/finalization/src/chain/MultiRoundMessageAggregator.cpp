@@ -161,13 +161,36 @@ namespace catapult { namespace chain {
 	}
 
 	RoundMessageAggregatorAddResult MultiRoundMessageAggregatorModifier::add(const std::shared_ptr<model::FinalizationMessage>& pMessage) {
-		auto messageRound = pMessage->StepIdentifier.Round();
+		auto* pRoundAggregator = findOrCreateRoundMessageAggregator(*pMessage);
+		return pRoundAggregator ? pRoundAggregator->add(pMessage) : RoundMessageAggregatorAddResult::Failure_Invalid_Point;
+	}
+
+	RoundMessageAggregatorAddResult MultiRoundMessageAggregatorModifier::addVerified(
+			const std::shared_ptr<model::FinalizationMessage>& pMessage) {
+		auto* pRoundAggregator = findOrCreateRoundMessageAggregator(*pMessage);
+		return pRoundAggregator ? pRoundAggregator->addVerified(pMessage) : RoundMessageAggregatorAddResult::Failure_Invalid_Point;
+	}
+
+	void MultiRoundMessageAggregatorModifier::prune(FinalizationEpoch epoch) {
+		auto& roundMessageAggregators = m_state.RoundMessageAggregators;
+
+		auto iter = roundMessageAggregators.lower_bound({ epoch, FinalizationPoint(0) });
+		roundMessageAggregators.erase(roundMessageAggregators.begin(), iter);
+
+		m_state.MinFinalizationRound = roundMessageAggregators.cend() == iter ? m_state.MaxFinalizationRound : iter->first;
+
+		CATAPULT_LOG(trace) << "set min finalization round to " << m_state.MinFinalizationRound << " after pruning at epoch " << epoch;
+	}
+
+	RoundMessageAggregator* MultiRoundMessageAggregatorModifier::findOrCreateRoundMessageAggregator(
+			const model::FinalizationMessage& message) {
+		auto messageRound = message.StepIdentifier.Round();
 		if (m_state.MinFinalizationRound > messageRound || m_state.MaxFinalizationRound < messageRound) {
 			CATAPULT_LOG(warning)
 					<< "rejecting message with round " << messageRound
 					<< ", min round " << m_state.MinFinalizationRound
 					<< ", max round " << m_state.MaxFinalizationRound;
-			return RoundMessageAggregatorAddResult::Failure_Invalid_Point;
+			return nullptr;
 		}
 
 		auto iter = m_state.RoundMessageAggregators.find(messageRound);
@@ -176,18 +199,7 @@ namespace catapult { namespace chain {
 			iter = m_state.RoundMessageAggregators.emplace(messageRound, std::move(pRoundAggregator)).first;
 		}
 
-		return iter->second->add(pMessage);
-	}
-
-	void MultiRoundMessageAggregatorModifier::prune(FinalizationEpoch epoch) {
-		auto& roundMessageAggregators = m_state.RoundMessageAggregators;
-
-		auto iter = roundMessageAggregators.lower_bound({ epoch, FinalizationPoint(0) });
-		roundMessageAggregators.erase(roundMessageAggregators.begin(), iter);
-
-		m_state.MinFinalizationRound = roundMessageAggregators.cend() == iter ? m_state.MaxFinalizationRound : iter->first;
-
-		CATAPULT_LOG(trace) << "set min finalization round to " << m_state.MinFinalizationRound << " after pruning at epoch " << epoch;
+		return iter->second.get();
 	}
 
 	// endregion
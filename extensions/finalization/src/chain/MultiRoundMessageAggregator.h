@@ -112,9 +112,15 @@ namespace catapult { namespace chain {
 		/// \note Message is a shared_ptr because it is detached from an EntityRange and is kept alive with its associated step.
 		RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>& pMessage);
 
+		/// Adds a finalization message (\a pMessage) with a previously verified signature to the aggregator.
+		RoundMessageAggregatorAddResult addVerified(const std::shared_ptr<model::FinalizationMessage>& pMessage);
+
 		/// Prunes this aggregator by removing all rounds with an epoch less than \a epoch.
 		void prune(FinalizationEpoch epoch);
 
+	private:
+		RoundMessageAggregator* findOrCreateRoundMessageAggregator(const model::FinalizationMessage& message);
+
 	private:
 		MultiRoundMessageAggregatorState& m_state;
 		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
@@ -123,6 +123,18 @@ namespace catapult { namespace chain {
 
 		public:
 			RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>& pMessage) override {
+				return addMessage(pMessage, model::ProcessMessage);
+			}
+
+			RoundMessageAggregatorAddResult addVerified(const std::shared_ptr<model::FinalizationMessage>& pMessage) override {
+				return addMessage(pMessage, model::ProcessVerifiedMessage);
+			}
+
+		private:
+			template<typename TProcessMessage>
+			RoundMessageAggregatorAddResult addMessage(
+					const std::shared_ptr<model::FinalizationMessage>& pMessage,
+					TProcessMessage processMessage) {
 				auto maxHashesPerPoint = m_finalizationContext.config().MaxHashesPerPoint;
 				CATAPULT_LOG(trace)
 						<< "received message at " << pMessage->StepIdentifier
@@ -159,7 +171,7 @@ namespace catapult { namespace chain {
 							: RoundMessageAggregatorAddResult::Failure_Conflicting;
 				}
 
-				auto processResultPair = model::ProcessMessage(*pMessage, m_finalizationContext);
+				auto processResultPair = processMessage(*pMessage, m_finalizationContext);
 				if (model::ProcessMessageResult::Success != processResultPair.first) {
 					CATAPULT_LOG(warning) << "rejecting finalization message with result " << processResultPair.first;
 					return RoundMessageAggregatorAddResult::Failure_Processing;
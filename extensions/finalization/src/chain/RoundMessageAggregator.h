@@ -64,6 +64,9 @@ namespace catapult { namespace chain {
 		/// Adds a finalization message (\a pMessage) to the aggregator.
 		/// \note Message is a shared_ptr because it is detached from an EntityRange and is kept alive with its associated step.
 		virtual RoundMessageAggregatorAddResult add(const std::shared_ptr<model::FinalizationMessage>& pMessage) = 0;
+
+		/// Adds a finalization message (\a pMessage) with a previously verified signature to the aggregator.
+		virtual RoundMessageAggregatorAddResult addVerified(const std::shared_ptr<model::FinalizationMessage>& pMessage) = 0;
 	};
 
 	/// Creates a round message aggregator around \a finalizationContext.
@@ -62,7 +62,7 @@ namespace catapult { namespace io {
 	// region FileProofStorage
 
 	FileProofStorage::FileProofStorage(const std::string& dataDirectory, uint32_t fileDatabaseBatchSize)
-			: m_database(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".proof" })
+			: m_database(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".proof", false })
 			, m_indexFile((std::filesystem::path(dataDirectory) / "proof.index.dat").generic_string())
 	{}
 
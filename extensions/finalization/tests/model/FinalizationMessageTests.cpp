@@ -21,6 +21,7 @@
 
 #include "finalization/src/model/FinalizationMessage.h"
 #include "catapult/crypto_voting/AggregateBmPrivateKeyTree.h"
+#include "catapult/utils/RandomGenerator.h"
 #include "finalization/tests/test/FinalizationMessageTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
 #include "tests/test/core/HashTestUtils.h"
@@ -460,4 +461,123 @@ namespace catapult { namespace model {
 	}
 
 	// endregion
+
+	// region ProcessVerifiedMessage
+
+	TEST(TEST_CLASS, ProcessVerifiedMessage_DoesNotVerifySignature) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Large, 3, [](const auto& context, const auto&, auto& message) {
+			// - corrupt a hash
+			test::FillWithRandomData(message.HashesPtr()[1]);
+
+			// Act:
+			auto processResultPair = ProcessVerifiedMessage(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Success, processResultPair.first);
+			EXPECT_EQ(Expected_Large_Weight, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessVerifiedMessage_FailsWhenVersionIsIncorrect) {
+		// Arrange:
+		auto modifyMessage = [](auto& message) { ++message.Version; };
+		RunProcessMessageTest(VoterType::Large, 3, modifyMessage, [](const auto& context, const auto&, const auto& message) {
+			// Act:
+			auto processResultPair = ProcessVerifiedMessage(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Version, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessVerifiedMessage_FailsWhenAccountIsNotVotingEligible) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Ineligible, 3, [](const auto& context, const auto&, const auto& message) {
+			// Act:
+			auto processResultPair = ProcessVerifiedMessage(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Failure_Voter, processResultPair.first);
+			EXPECT_EQ(0u, processResultPair.second);
+		});
+	}
+
+	TEST(TEST_CLASS, ProcessVerifiedMessage_CanProcessValidMessageWithHashes) {
+		// Arrange:
+		RunProcessMessageTest(VoterType::Large, 3, [](const auto& context, const auto&, const auto& message) {
+			// Act:
+			auto processResultPair = ProcessVerifiedMessage(message, context);
+
+			// Assert:
+			EXPECT_EQ(ProcessMessageResult::Success, processResultPair.first);
+			EXPECT_EQ(Expected_Large_Weight, processResultPair.second);
+		});
+	}
+
+	// endregion
+
+	// region VerifyMessageSignatures
+
+	namespace {
+		std::vector<std::shared_ptr<FinalizationMessage>> CreateSignedMessages(size_t numMessages) {
+			std::vector<std::shared_ptr<FinalizationMessage>> messages;
+			for (auto i = 0u; i < numMessages; ++i) {
+				std::shared_ptr<FinalizationMessage> pMessage = CreateMessage(i % 4);
+				pMessage->StepIdentifier = DefaultStepIdentifier();
+				test::SignMessage(*pMessage, test::GenerateVotingKeyPair());
+				messages.push_back(pMessage);
+			}
+
+			return messages;
+		}
+
+		std::vector<bool> VerifyAllMessageSignatures(const std::vector<std::shared_ptr<FinalizationMessage>>& messages) {
+			auto randomFiller = [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+			return VerifyMessageSignatures(randomFiller, messages.data(), messages.size());
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_SucceedsWhenNoMessagesAreProvided) {
+		// Act:
+		auto results = VerifyAllMessageSignatures({});
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_SucceedsWhenAllSignaturesAreValid) {
+		// Arrange:
+		auto messages = CreateSignedMessages(40);
+
+		// Act:
+		auto results = VerifyAllMessageSignatures(messages);
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(40, true), results);
+	}
+
+	TEST(TEST_CLASS, VerifyMessageSignatures_FailsWhenSomeSignaturesAreInvalid) {
+		// Arrange: corrupt signed data, signature and epoch (key identifier) of some messages
+		auto messages = CreateSignedMessages(40);
+		messages[1]->Height = messages[1]->Height + Height(1);
+		messages[17]->Signature.Bottom.Signature[0] ^= 0xFF;
+		messages[38]->StepIdentifier.Epoch = messages[38]->StepIdentifier.Epoch + FinalizationEpoch(1);
+
+		std::vector<bool> expectedResults(40, true);
+		for (auto index : { 1u, 17u, 38u })
+			expectedResults[index] = false;
+
+		// Act:
+		auto results = VerifyAllMessageSignatures(messages);
+
+		// Assert:
+		EXPECT_EQ(expectedResults, results);
+	}
+
+	// endregion
 }}
@@ -33,6 +33,7 @@ namespace catapult { namespace mocks {
 		explicit MockRoundMessageAggregator(const model::FinalizationRound& round)
 				: m_round(round)
 				, m_numAddCalls(0)
+				, m_numAddVerifiedCalls(0)
 				, m_roundContext(1000, 700)
 				, m_addResult(static_cast<chain::RoundMessageAggregatorAddResult>(-1))
 		{}
@@ -53,6 +54,11 @@ namespace catapult { namespace mocks {
 			return m_numAddCalls;
 		}
 
+		/// Gets the number of times addVerified was called.
+		size_t numAddVerifiedCalls() const {
+			return m_numAddVerifiedCalls;
+		}
+
 	public:
 		/// Sets the result of shortHashes to \a shortHashes.
 		void setShortHashes(model::ShortHashRange&& shortHashes) {
@@ -103,10 +109,16 @@ namespace catapult { namespace mocks {
 			return m_addResult;
 		}
 
+		chain::RoundMessageAggregatorAddResult addVerified(const std::shared_ptr<model::FinalizationMessage>&) override {
+			++m_numAddVerifiedCalls;
+			return m_addResult;
+		}
+
 	private:
 		model::FinalizationRound m_round;
 		Height m_height;
 		size_t m_numAddCalls;
+		size_t m_numAddVerifiedCalls;
 		chain::RoundContext m_roundContext;
 
 		model::ShortHashRange m_shortHashes;
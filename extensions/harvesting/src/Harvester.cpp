@@ -24,7 +24,10 @@
 #include "catapult/chain/BlockDifficultyScorer.h"
 #include "catapult/chain/BlockScorer.h"
 #include "catapult/model/BlockUtils.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
+#include <atomic>
 
 namespace catapult { namespace harvesting {
 
@@ -71,6 +74,82 @@ namespace catapult { namespace harvesting {
 		void AddGenerationHashProof(model::Block& block, const crypto::VrfProof& vrfProof) {
 			block.GenerationHashProof = { vrfProof.Gamma, vrfProof.VerificationHash, vrfProof.Scalar };
 		}
+
+		// region hit search
+
+		// minimum number of unlocked accounts that need to be evaluated by each partition
+		constexpr size_t Min_Accounts_Per_Partition = 16;
+
+		using AccountDescriptors = std::vector<const BlockGeneratorAccountDescriptor*>;
+		using HitPredicate = predicate<const BlockGeneratorAccountDescriptor&, crypto::VrfProof&>;
+
+		class HitSearch {
+		public:
+			explicit HitSearch(const AccountDescriptors& descriptors)
+					: m_descriptors(descriptors)
+					, m_vrfProofs(descriptors.size())
+					, m_hitIndex(descriptors.size())
+			{}
+
+		public:
+			const BlockGeneratorAccountDescriptor* hitDescriptor() const {
+				return m_hitIndex < m_descriptors.size() ? m_descriptors[m_hitIndex] : nullptr;
+			}
+
+			const crypto::VrfProof& hitVrfProof() const {
+				return m_vrfProofs[m_hitIndex];
+			}
+
+		public:
+			void run(const HitPredicate& isHit, thread::IoThreadPool* pPool) {
+				auto numPartitions = m_descriptors.size() / Min_Accounts_Per_Partition;
+				if (pPool)
+					numPartitions = std::min<size_t>(numPartitions, pPool->numWorkerThreads());
+
+				if (!pPool || numPartitions < 2) {
+					search(isHit, m_descriptors.cbegin(), m_descriptors.cend(), 0);
+					return;
+				}
+
+				thread::ParallelForPartition(pPool->ioContext(), m_descriptors, numPartitions, [this, &isHit](
+						auto itBegin,
+						auto itEnd,
+						auto startIndex,
+						auto) {
+					search(isHit, itBegin, itEnd, startIndex);
+				}).get();
+			}
+
+		private:
+			void search(
+					const HitPredicate& isHit,
+					AccountDescriptors::const_iterator itBegin,
+					AccountDescriptors::const_iterator itEnd,
+					size_t startIndex) {
+				auto index = startIndex;
+				for (auto iter = itBegin; itEnd != iter; ++iter, ++index) {
+					// the first hit in priority order is harvested, so stop when an earlier account has already hit
+					if (index > m_hitIndex)
+						return;
+
+					if (!isHit(**iter, m_vrfProofs[index]))
+						continue;
+
+					auto hitIndex = m_hitIndex.load();
+					while (index < hitIndex && !m_hitIndex.compare_exchange_weak(hitIndex, index))
+					{}
+
+					return;
+				}
+			}
+
+		private:
+			const AccountDescriptors& m_descriptors;
+			std::vector<crypto::VrfProof> m_vrfProofs;
+			std::atomic<size_t> m_hitIndex;
+		};
+
+		// endregion
 	}
 
 	Harvester::Harvester(
@@ -84,8 +163,20 @@ namespace catapult { namespace harvesting {
 			, m_beneficiary(beneficiary)
 			, m_unlockedAccounts(unlockedAccounts)
 			, m_blockGenerator(blockGenerator)
+			, m_pPool(nullptr)
 	{}
 
+	Harvester::Harvester(
+			const cache::CatapultCache& cache,
+			const model::BlockChainConfiguration& config,
+			const Address& beneficiary,
+			const UnlockedAccounts& unlockedAccounts,
+			const BlockGenerator& blockGenerator,
+			thread::IoThreadPool& pool)
+			: Harvester(cache, config, beneficiary, unlockedAccounts, blockGenerator) {
+		m_pPool = &pool;
+	}
+
 	std::unique_ptr<model::Block> Harvester::harvest(const model::BlockElement& lastBlockElement, Timestamp timestamp) {
 		NextBlockContext context(lastBlockElement, timestamp);
 		if (!context.tryCalculateDifficulty(m_cache.sub<cache::BlockStatisticCache>(), m_config)) {
@@ -98,34 +189,40 @@ namespace catapult { namespace harvesting {
 		hitContext.Difficulty = context.Difficulty;
 		hitContext.Height = context.Height;
 
-		const auto& accountStateCache = m_cache.sub<cache::AccountStateCache>();
-		chain::BlockHitPredicate hitPredicate(m_config, [&accountStateCache](const auto& key, auto height) {
-			auto lockedCacheView = accountStateCache.createView();
-			cache::ReadOnlyAccountStateCache readOnlyCache(*lockedCacheView);
-			cache::ImportanceView view(readOnlyCache);
-			return view.getAccountImportanceOrDefault(key, height);
-		});
-
 		auto unlockedAccountsView = m_unlockedAccounts.view();
-		const crypto::KeyPair* pHarvesterKeyPair = nullptr;
-		crypto::VrfProof vrfProof;
-
-		unlockedAccountsView.forEach([&context, &hitContext, &hitPredicate, &pHarvesterKeyPair, &vrfProof](const auto& descriptor) {
-			hitContext.Signer = descriptor.signingKeyPair().publicKey();
-
-			vrfProof = crypto::GenerateVrfProof(context.ParentContext.GenerationHash, descriptor.vrfKeyPair());
-			hitContext.GenerationHash = model::CalculateGenerationHash(vrfProof.Gamma);
-			if (hitPredicate(hitContext)) {
-				pHarvesterKeyPair = &descriptor.signingKeyPair();
-				return false;
-			}
-
+		AccountDescriptors descriptors;
+		unlockedAccountsView.forEach([&descriptors](const auto& descriptor) {
+			descriptors.push_back(&descriptor);
 			return true;
 		});
 
-		if (!pHarvesterKeyPair)
+		HitSearch hitSearch(descriptors);
+		{
+			// share a single importance view across all unlocked accounts instead of creating one for each account
+			auto accountStateCacheView = m_cache.sub<cache::AccountStateCache>().createView();
+			cache::ReadOnlyAccountStateCache readOnlyAccountStateCache(*accountStateCacheView);
+			cache::ImportanceView importanceView(readOnlyAccountStateCache);
+			chain::BlockHitPredicate hitPredicate(m_config, [&importanceView](const auto& key, auto height) {
+				return importanceView.getAccountImportanceOrDefault(key, height);
+			});
+
+			hitSearch.run([&context, &hitContext, &hitPredicate](const auto& descriptor, auto& vrfProof) {
+				auto accountHitContext = hitContext;
+				accountHitContext.Signer = descriptor.signingKeyPair().publicKey();
+
+				vrfProof = crypto::GenerateVrfProof(context.ParentContext.GenerationHash, descriptor.vrfKeyPair());
+				accountHitContext.GenerationHash = model::CalculateGenerationHash(vrfProof.Gamma);
+				return hitPredicate(accountHitContext);
+			}, m_pPool);
+		}
+
+		const auto* pHarvesterDescriptor = hitSearch.hitDescriptor();
+		if (!pHarvesterDescriptor)
 			return nullptr;
 
+		const auto& vrfProof = hitSearch.hitVrfProof();
+		const auto* pHarvesterKeyPair = &pHarvesterDescriptor->signingKeyPair();
+
 		utils::StackLogger stackLogger("generating candidate block", utils::LogLevel::debug);
 		auto pBlockHeader = CreateUnsignedBlockHeader(
 				context,
@@ -27,7 +27,10 @@
 #include "catapult/model/Elements.h"
 #include "catapult/model/EntityInfo.h"
 
-namespace catapult { namespace harvesting { struct BlockExecutionHashes; } }
+namespace catapult {
+	namespace harvesting { struct BlockExecutionHashes; }
+	namespace thread { class IoThreadPool; }
+}
 
 namespace catapult { namespace harvesting {
 
@@ -43,6 +46,17 @@ namespace catapult { namespace harvesting {
 				const UnlockedAccounts& unlockedAccounts,
 				const BlockGenerator& blockGenerator);
 
+		/// Creates a harvester around catapult \a cache, block chain \a config, \a beneficiary,
+		/// unlocked accounts set (\a unlockedAccounts) and \a blockGenerator used to customize block generation.
+		/// Hits of unlocked accounts are evaluated in parallel using \a pool.
+		Harvester(
+				const cache::CatapultCache& cache,
+				const model::BlockChainConfiguration& config,
+				const Address& beneficiary,
+				const UnlockedAccounts& unlockedAccounts,
+				const BlockGenerator& blockGenerator,
+				thread::IoThreadPool& pool);
+
 	public:
 		/// Creates the best block (if any) harvested by any unlocked account.
 		/// Created block will have \a lastBlockElement as parent and \a timestamp as timestamp.
@@ -54,5 +68,6 @@ namespace catapult { namespace harvesting {
 		const Address m_beneficiary;
 		const UnlockedAccounts& m_unlockedAccounts;
 		BlockGenerator m_blockGenerator;
+		thread::IoThreadPool* m_pPool;
 	};
 }}
@@ -36,6 +36,7 @@
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/EntityRange.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/thread/MultiServicePool.h"
 #include "catapult/utils/HexParser.h"
 
 namespace catapult { namespace harvesting {
@@ -134,9 +135,15 @@ namespace catapult { namespace harvesting {
 
 			auto pUnlockedAccounts = unlockedAccountsHolder.pUnlockedAccounts;
 			auto blockGenerator = CreateHarvesterBlockGenerator(strategy, transactionRegistry, utFacadeFactory, utCache);
-			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(
-					CreateHarvesterTaskOptions(state),
-					std::make_unique<Harvester>(cache, blockChainConfig, beneficiaryAddress, *pUnlockedAccounts, blockGenerator));
+			auto& harvestingPool = *state.pool().pushIsolatedPool("harvesting");
+			auto pHarvester = std::make_unique<Harvester>(
+					cache,
+					blockChainConfig,
+					beneficiaryAddress,
+					*pUnlockedAccounts,
+					blockGenerator,
+					harvestingPool);
+			auto pHarvesterTask = std::make_shared<ScheduledHarvesterTask>(CreateHarvesterTaskOptions(state), std::move(pHarvester));
 
 			auto pUnlockedAccountsUpdater = unlockedAccountsHolder.pUnlockedAccountsUpdater;
 			return thread::CreateNamedTask("harvesting task", [pUnlockedAccountsUpdater, pHarvesterTask]() {
@@ -31,6 +31,7 @@
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/EntityTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/test/nodeps/TestConstants.h"
 #include "tests/test/nodeps/Waits.h"
@@ -101,14 +102,17 @@ namespace catapult { namespace harvesting {
 			HarvesterContext() : HarvesterContext(Height(1))
 			{}
 
-			explicit HarvesterContext(Height height)
+			explicit HarvesterContext(Height height) : HarvesterContext(height, Num_Accounts)
+			{}
+
+			HarvesterContext(Height height, size_t numAccounts)
 					: Cache(test::CreateEmptyCatapultCache(CreateConfiguration()))
-					, SigningKeyPairs(CreateKeyPairs(Num_Accounts))
-					, VotingKeyPairs(CreateKeyPairs(Num_Accounts))
-					, VrfKeyPairs(CreateKeyPairs(Num_Accounts))
+					, SigningKeyPairs(CreateKeyPairs(numAccounts))
+					, VotingKeyPairs(CreateKeyPairs(numAccounts))
+					, VrfKeyPairs(CreateKeyPairs(numAccounts))
 					, Beneficiary(test::GenerateRandomByteArray<Address>())
-					, Importances(CreateImportances(Num_Accounts))
-					, pUnlockedAccounts(std::make_unique<UnlockedAccounts>(Num_Accounts, [](const auto&) { return 0; }))
+					, Importances(CreateImportances(numAccounts))
+					, pUnlockedAccounts(std::make_unique<UnlockedAccounts>(numAccounts, [](const auto&) { return 0; }))
 					, pLastBlock(CreateBlock(height))
 					, LastBlockElement(test::BlockToBlockElement(*pLastBlock)) {
 				auto delta = Cache.createDelta();
@@ -131,12 +135,7 @@ namespace catapult { namespace harvesting {
 			}
 
 			std::unique_ptr<Harvester> CreateHarvester(const model::BlockChainConfiguration& config) {
-				return CreateHarvester(config, [](const auto& blockHeader, auto) {
-					auto size = model::GetBlockHeaderSize(blockHeader.Type);
-					auto pBlock = utils::MakeUniqueWithSize<model::Block>(size);
-					std::memcpy(static_cast<void*>(pBlock.get()), &blockHeader, size);
-					return pBlock;
-				});
+				return CreateHarvester(config, CreateBlockGenerator());
 			}
 
 			std::unique_ptr<Harvester> CreateHarvester(
@@ -145,6 +144,11 @@ namespace catapult { namespace harvesting {
 				return std::make_unique<Harvester>(Cache, config, Beneficiary, *pUnlockedAccounts, blockGenerator);
 			}
 
+			std::unique_ptr<Harvester> CreateHarvester(thread::IoThreadPool& pool) {
+				auto blockGenerator = CreateBlockGenerator();
+				return std::make_unique<Harvester>(Cache, CreateConfiguration(), Beneficiary, *pUnlockedAccounts, blockGenerator, pool);
+			}
+
 			HarvesterDescriptor BestHarvester() const {
 				crypto::VrfProof bestVrfProof;
 				uint64_t bestHit = std::numeric_limits<uint64_t>::max();
@@ -207,13 +211,22 @@ namespace catapult { namespace harvesting {
 			}
 
 		private:
+			static BlockGenerator CreateBlockGenerator() {
+				return [](const auto& blockHeader, auto) {
+					auto size = model::GetBlockHeaderSize(blockHeader.Type);
+					auto pBlock = utils::MakeUniqueWithSize<model::Block>(size);
+					std::memcpy(static_cast<void*>(pBlock.get()), &blockHeader, size);
+					return pBlock;
+				};
+			}
+
 			static void CreateAccounts(
 					cache::AccountStateCacheDelta& cache,
 					const std::vector<KeyPair>& signingKeyPairs,
 					const std::vector<KeyPair>& votingKeyPairs,
 					const std::vector<KeyPair>& vrfKeyPairs,
 					const std::vector<Importance> importances) {
-				for (auto i = 0u; i < Num_Accounts; ++i) {
+				for (auto i = 0u; i < signingKeyPairs.size(); ++i) {
 					cache.addAccount(signingKeyPairs[i].publicKey(), Height(123));
 					auto& accountState = cache.find(signingKeyPairs[i].publicKey()).get();
 					auto multiplier = static_cast<uint64_t>(i % 2 ? -2 : 2);
@@ -236,7 +249,7 @@ namespace catapult { namespace harvesting {
 					const std::vector<KeyPair>& signingKeyPairs,
 					const std::vector<KeyPair>& vrfKeyPairs) {
 				auto modifier = unlockedAccounts.modifier();
-				for (auto i = 0u; i < Num_Accounts; ++i) {
+				for (auto i = 0u; i < signingKeyPairs.size(); ++i) {
 					modifier.add(BlockGeneratorAccountDescriptor(
 							test::CopyKeyPair(signingKeyPairs[i]),
 							test::CopyKeyPair(vrfKeyPairs[i])));
@@ -548,6 +561,81 @@ namespace catapult { namespace harvesting {
 
 	// endregion
 
+	// region parallel hit evaluation
+
+	namespace {
+		// large enough to be split across multiple partitions
+		constexpr size_t Num_Parallel_Accounts = 64;
+		constexpr uint32_t Num_Pool_Threads = 4;
+	}
+
+	TEST(TEST_CLASS, HarvestReturnsNullptrWhenNoHarvesterHasHit_Parallel) {
+		// Arrange:
+		HarvesterContext context(Height(1), Num_Parallel_Accounts);
+		auto bestHarvester = context.BestHarvester();
+		auto timestamp = context.CalculateBlockGenerationTime(bestHarvester);
+		auto tooEarly = Timestamp(timestamp.unwrap() - 1000);
+
+		auto pPool = test::CreateStartedIoThreadPool(Num_Pool_Threads);
+		auto pHarvester = context.CreateHarvester(*pPool);
+
+		// Act:
+		auto pBlock = pHarvester->harvest(context.LastBlockElement, tooEarly);
+
+		// Assert:
+		EXPECT_FALSE(!!pBlock);
+	}
+
+	TEST(TEST_CLASS, HarvestHasFirstHarvesterWithHitAsSigner_Parallel) {
+		// Arrange: all accounts have a hit at max time
+		HarvesterContext context(Height(1), Num_Parallel_Accounts);
+		Key firstPublicKey;
+		context.pUnlockedAccounts->view().forEach([&firstPublicKey](const auto& descriptor) {
+			firstPublicKey = descriptor.signingKeyPair().publicKey();
+			return false;
+		});
+
+		auto pPool = test::CreateStartedIoThreadPool(Num_Pool_Threads);
+		auto pHarvester = context.CreateHarvester(*pPool);
+
+		// Act:
+		auto pBlock = pHarvester->harvest(context.LastBlockElement, Max_Time);
+
+		// Assert: first account wins even though accounts in other partitions also have hits
+		ASSERT_TRUE(!!pBlock);
+		EXPECT_EQ(firstPublicKey, pBlock->SignerPublicKey);
+	}
+
+	TEST(TEST_CLASS, HarvesterWithBestKeyCreatesBlockAtEarliestMoment_Parallel) {
+		// Arrange:
+		test::RunNonDeterministicTest("harvester with best key harvests", []() {
+			HarvesterContext context(Height(1), Num_Parallel_Accounts);
+			auto bestHarvester = context.BestHarvester();
+			auto timestamp = context.CalculateBlockGenerationTime(bestHarvester);
+
+			auto pPool = test::CreateStartedIoThreadPool(Num_Pool_Threads);
+			auto pHarvester = context.CreateHarvester(*pPool);
+
+			// Act:
+			auto pBlock = pHarvester->harvest(context.LastBlockElement, timestamp);
+			if (!pBlock || bestHarvester.SigningPublicKey != pBlock->SignerPublicKey)
+				return false;
+
+			// Assert:
+			context.AssertBlockFields(
+					bestHarvester,
+					context.Beneficiary,
+					model::Entity_Type_Block_Normal,
+					Height(2),
+					timestamp,
+					CreateConfiguration(),
+					*pBlock);
+			return true;
+		});
+	}
+
+	// endregion
+
 	// region block generator delegation
 
 	namespace {
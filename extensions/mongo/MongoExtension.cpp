@@ -33,7 +33,6 @@
 #include "src/MongoTransactionStorage.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/extensions/RootedService.h"
-#include "catapult/io/BlockStorageChangeSubscriber.h"
 #include <mongocxx/instance.hpp>
 
 namespace catapult { namespace mongo {
@@ -118,9 +117,9 @@ namespace catapult { namespace mongo {
 					"mongo.services",
 					extensions::ServiceRegistrarPhase::Initial_With_Modules));
 
-			// add a pre load handler for initializing (nemesis) storage
+			// create block change storage
 			// (pPluginManager is kept alive by pTransactionRegistry)
-			auto pMongoBlockStorage = CreateMongoBlockStorage(
+			auto pMongoBlockChangeStorage = CreateMongoBlockChangeStorage(
 					*pMongoContext,
 					dbConfig.MaxDropBatchSize,
 					*pTransactionRegistry,
@@ -131,8 +130,7 @@ namespace catapult { namespace mongo {
 			EmptyCollection(*pMongoContext, Pt_Collection_Name);
 
 			// register subscriptions
-			bootstrapper.subscriptionManager().addBlockChangeSubscriber(
-					io::CreateBlockStorageChangeSubscriber(std::move(pMongoBlockStorage)));
+			bootstrapper.subscriptionManager().addBlockChangeSubscriber(std::move(pMongoBlockChangeStorage));
 			bootstrapper.subscriptionManager().addPtChangeSubscriber(CreateMongoPtStorage(*pMongoContext, *pTransactionRegistry));
 			bootstrapper.subscriptionManager().addUtChangeSubscriber(
 					CreateMongoTransactionStorage(*pMongoContext, *pTransactionRegistry, Ut_Collection_Name));
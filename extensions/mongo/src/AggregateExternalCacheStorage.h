@@ -21,12 +21,14 @@
 
 #pragma once
 #include "ExternalCacheStorage.h"
+#include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/NamedObject.h"
 #include <vector>
 
 namespace catapult { namespace mongo {
 
 	/// Aggregate for saving cache data to external storage.
+	/// \note Changes of all sub cache storages are saved concurrently.
 	class AggregateExternalCacheStorage : public ExternalCacheStorage {
 	public:
 		/// Container of sub cache storages.
@@ -40,9 +42,27 @@ namespace catapult { namespace mongo {
 		{}
 
 	public:
-		void saveDelta(const cache::CacheChanges& changes) override {
-			for (const auto& pStorage : m_storages)
-				pStorage->saveDelta(changes);
+		thread::future<bool> saveDeltaAsync(const cache::CacheChanges& changes) override {
+			if (m_storages.empty())
+				return thread::make_ready_future(true);
+
+			std::vector<thread::future<bool>> futures;
+			futures.reserve(m_storages.size());
+			for (const auto& pStorage : m_storages) {
+				// capture synchronous failures so that saves already started are always awaited before \a changes is released
+				try {
+					futures.push_back(pStorage->saveDeltaAsync(changes));
+				} catch (...) {
+					thread::promise<bool> promise;
+					promise.set_exception(std::current_exception());
+					futures.push_back(promise.get_future());
+				}
+			}
+
+			return thread::when_all(std::move(futures)).then([](auto&& resultsFuture) {
+				thread::get_all(resultsFuture.get());
+				return true;
+			});
 		}
 
 	private:
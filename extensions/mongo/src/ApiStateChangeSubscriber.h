@@ -24,6 +24,7 @@
 #include "ExternalCacheStorage.h"
 #include "catapult/subscribers/StateChangeInfo.h"
 #include "catapult/subscribers/StateChangeSubscriber.h"
+#include "catapult/utils/StackLogger.h"
 
 namespace catapult { namespace mongo {
 
@@ -44,6 +45,7 @@ namespace catapult { namespace mongo {
 		}
 
 		void notifyStateChange(const subscribers::StateChangeInfo& stateChangeInfo) override {
+			utils::SlowOperationLogger logger("ApiStateChangeSubscriber::notifyStateChange", utils::LogLevel::warning);
 			m_pCacheStorage->saveDelta(stateChangeInfo.CacheChanges);
 		}
 
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "catapult/cache/CacheChanges.h"
+#include "catapult/thread/Future.h"
 #include "catapult/functions.h"
 
 namespace catapult { namespace mongo {
@@ -50,7 +51,13 @@ namespace catapult { namespace mongo {
 
 	public:
 		/// Saves cache \a changes to external storage.
-		virtual void saveDelta(const cache::CacheChanges& changes) = 0;
+		void saveDelta(const cache::CacheChanges& changes) {
+			saveDeltaAsync(changes).get();
+		}
+
+		/// Starts saving cache \a changes to external storage and returns a future that is signaled on completion.
+		/// \note \a changes must remain valid until the returned future is signaled.
+		virtual thread::future<bool> saveDeltaAsync(const cache::CacheChanges& changes) = 0;
 
 	private:
 		std::string m_name;
@@ -66,14 +73,14 @@ namespace catapult { namespace mongo {
 		{}
 
 	public:
-		void saveDelta(const cache::CacheChanges& changes) final override {
-			saveDelta(changes.sub<TCache>());
+		thread::future<bool> saveDeltaAsync(const cache::CacheChanges& changes) final override {
+			return saveDeltaAsync(changes.sub<TCache>());
 		}
 
 	private:
 		using CacheChangesType = cache::SingleCacheChangesT<typename TCache::CacheDeltaType, typename TCache::CacheValueType>;
 
-		/// Saves cache \a changes to external storage.
-		virtual void saveDelta(const CacheChangesType& changes) = 0;
+		/// Starts saving cache \a changes to external storage and returns a future that is signaled on completion.
+		virtual thread::future<bool> saveDeltaAsync(const CacheChangesType& changes) = 0;
 	};
 }}
@@ -29,12 +29,17 @@
 #include "mappers/ResolutionStatementMapper.h"
 #include "mappers/TransactionMapper.h"
 #include "mappers/TransactionStatementMapper.h"
+#include "catapult/io/BlockChangeSubscriber.h"
+#include "catapult/utils/StackTimer.h"
+#include <optional>
 
 using namespace bsoncxx::builder::stream;
 
 namespace catapult { namespace mongo {
 
 	namespace {
+		constexpr auto Unordered_Bulk_Write = MongoBulkWriter::BulkWriteOrder::Unordered;
+
 		model::HashRange LoadHashes(const mongocxx::database& database, Height height, size_t numHashes) {
 			auto blocks = database["blocks"];
 			auto filter = document()
@@ -66,28 +71,33 @@ namespace catapult { namespace mongo {
 				CATAPULT_THROW_RUNTIME_ERROR("SaveBlockHeader failed: block header was not inserted");
 		}
 
-		size_t SaveTransactions(
+		thread::future<size_t> SaveTransactions(
 				MongoBulkWriter& bulkWriter,
 				Height height,
 				const std::vector<model::TransactionElement>& transactions,
 				const MongoTransactionRegistry& registry,
 				const MongoErrorPolicy& errorPolicy) {
-			std::atomic<size_t> totalTransactionsCount(0);
-			auto createDocuments = [height, &registry, &totalTransactionsCount](const auto& transactionElement, auto index) {
+			auto pTotalTransactionsCount = std::make_shared<std::atomic<size_t>>(0);
+			auto createDocuments = [height, &registry, pTotalTransactionsCount](const auto& transactionElement, auto index) {
 				auto metadata = MongoTransactionMetadata(transactionElement, height, index);
 				auto documents = mappers::ToDbDocuments(transactionElement.Transaction, metadata, registry);
-				totalTransactionsCount += documents.size();
+				*pTotalTransactionsCount += documents.size();
 				return documents;
 			};
-			auto results = bulkWriter.bulkInsert("transactions", transactions, createDocuments).get();
-			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(results)));
 
-			auto itemsDescription = "transactions at height " + std::to_string(height.unwrap());
-			errorPolicy.checkInserted(totalTransactionsCount, aggregateResult, itemsDescription);
-			return totalTransactionsCount;
+			// transactions are independent documents, so they can be inserted in any order
+			auto resultsFuture = bulkWriter.bulkInsert("transactions", transactions, createDocuments, Unordered_Bulk_Write);
+			return resultsFuture.then([height, &errorPolicy, pTotalTransactionsCount](auto&& insertResultsFuture) {
+				auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(insertResultsFuture.get()));
+
+				auto itemsDescription = "transactions at height " + std::to_string(height.unwrap());
+				size_t totalTransactionsCount = *pTotalTransactionsCount;
+				errorPolicy.checkInserted(totalTransactionsCount, aggregateResult, itemsDescription);
+				return totalTransactionsCount;
+			});
 		}
 
-		void SaveBlockStatement(
+		thread::future<bool> SaveBlockStatement(
 				MongoBulkWriter& bulkWriter,
 				Height height,
 				const model::BlockStatement& blockStatement,
@@ -98,13 +108,15 @@ namespace catapult { namespace mongo {
 			std::vector<BulkWriteResultFuture> futures;
 			std::vector<size_t> numExpectedInserts;
 
+			// statements are independent documents, so they can be inserted in any order
+
 			// transaction statements
 			numExpectedInserts.emplace_back(blockStatement.TransactionStatements.size());
 			futures.emplace_back(bulkWriter.bulkInsert("transactionStatements", blockStatement.TransactionStatements, [height, &registry](
 					const auto& pair,
 					auto) {
 				return mappers::ToDbModel(height, pair.second, registry);
-			}));
+			}, Unordered_Bulk_Write));
 
 			// address resolution statements
 			numExpectedInserts.emplace_back(blockStatement.AddressResolutionStatements.size());
@@ -112,7 +124,7 @@ namespace catapult { namespace mongo {
 					const auto& pair,
 					auto) {
 				return mappers::ToDbModel(height, pair.second);
-			}));
+			}, Unordered_Bulk_Write));
 
 			// mosaic resolution statements
 			numExpectedInserts.emplace_back(blockStatement.MosaicResolutionStatements.size());
@@ -120,10 +132,9 @@ namespace catapult { namespace mongo {
 					const auto& pair,
 					auto) {
 				return mappers::ToDbModel(height, pair.second);
-			}));
+			}, Unordered_Bulk_Write));
 
-			auto statementsFuture = thread::when_all(std::move(futures)).then([height, numExpectedInserts, &errorPolicy](
-					auto&& resultsFuture) {
+			return thread::when_all(std::move(futures)).then([height, numExpectedInserts, &errorPolicy](auto&& resultsFuture) {
 				auto insertResultsContainer = resultsFuture.get();
 				auto i = 0u;
 				auto itemsDescription = "statements at height " + std::to_string(height.unwrap());
@@ -133,10 +144,65 @@ namespace catapult { namespace mongo {
 					++i;
 				}
 			});
+		}
+
+		// region BlockDocuments
+
+		// documents of consecutive blocks that are saved together
+		struct BlockDocuments {
+		public:
+			Height FirstHeight;
+			Height LastHeight;
+			std::vector<bsoncxx::document::value> Blocks;
+			std::vector<bsoncxx::document::value> Transactions;
+			std::vector<bsoncxx::document::value> TransactionStatements;
+			std::vector<bsoncxx::document::value> AddressResolutionStatements;
+			std::vector<bsoncxx::document::value> MosaicResolutionStatements;
+
+		public:
+			bool empty() const {
+				return Blocks.empty();
+			}
+		};
+
+		void AppendBlockDocuments(
+				BlockDocuments& documents,
+				const model::BlockElement& blockElement,
+				const MongoTransactionRegistry& transactionRegistry,
+				const MongoReceiptRegistry& receiptRegistry) {
+			auto height = blockElement.Block.Height;
+
+			auto numTransactionDocuments = documents.Transactions.size();
+			auto index = 0u;
+			for (const auto& transactionElement : blockElement.Transactions) {
+				auto metadata = MongoTransactionMetadata(transactionElement, height, index++);
+				for (auto& transactionDocument : mappers::ToDbDocuments(transactionElement.Transaction, metadata, transactionRegistry))
+					documents.Transactions.push_back(std::move(transactionDocument));
+			}
+
+			numTransactionDocuments = documents.Transactions.size() - numTransactionDocuments;
+			documents.Blocks.push_back(mappers::ToDbModel(blockElement, static_cast<uint32_t>(numTransactionDocuments)));
+
+			if (blockElement.OptionalStatement) {
+				const auto& blockStatement = *blockElement.OptionalStatement;
+				for (const auto& pair : blockStatement.TransactionStatements)
+					documents.TransactionStatements.push_back(mappers::ToDbModel(height, pair.second, receiptRegistry));
+
+				for (const auto& pair : blockStatement.AddressResolutionStatements)
+					documents.AddressResolutionStatements.push_back(mappers::ToDbModel(height, pair.second));
+
+				for (const auto& pair : blockStatement.MosaicResolutionStatements)
+					documents.MosaicResolutionStatements.push_back(mappers::ToDbModel(height, pair.second));
+			}
+
+			if (1u == documents.Blocks.size())
+				documents.FirstHeight = height;
 
-			statementsFuture.get();
+			documents.LastHeight = height;
 		}
 
+		// endregion
+
 		class MongoBlockStorage final : public io::LightBlockStorage {
 		public:
 			MongoBlockStorage(
@@ -205,24 +271,89 @@ namespace catapult { namespace mongo {
 
 			// endregion
 
+		public:
+			void saveBlocks(const BlockDocuments& documents) {
+				if (MongoErrorPolicy::Mode::Idempotent == m_errorPolicy.mode()) {
+					dropBlocksAfter(documents.FirstHeight - Height(1));
+					dropAllAfter(documents.FirstHeight - Height(1)); // forcibly drop orphaned documents
+				}
+
+				auto dbHeight = chainHeight();
+				if (documents.FirstHeight != dbHeight + Height(1)) {
+					std::ostringstream out;
+					out << "cannot save blocks starting at height " << documents.FirstHeight << " when storage height is " << dbHeight;
+					CATAPULT_THROW_INVALID_ARGUMENT(out.str().c_str());
+				}
+
+				saveBlocksInternal(documents);
+			}
+
 		private:
+			void saveBlocksInternal(const BlockDocuments& documents) {
+				using BulkWriteResultFuture = thread::future<std::vector<thread::future<BulkWriteResult>>>;
+
+				// documents of different blocks are independent, so all collections can be written concurrently and unordered
+				std::vector<BulkWriteResultFuture> futures;
+				std::vector<std::pair<std::string, size_t>> collectionSizes;
+				auto bulkInsert = [&bulkWriter = m_context.bulkWriter(), &futures, &collectionSizes](
+						const auto& collectionName,
+						const auto& collectionDocuments) {
+					collectionSizes.emplace_back(collectionName, collectionDocuments.size());
+					futures.push_back(bulkWriter.bulkInsert(collectionName, collectionDocuments, [](const auto& document, auto) {
+						return document;
+					}, Unordered_Bulk_Write));
+				};
+
+				bulkInsert("blocks", documents.Blocks);
+				bulkInsert("transactions", documents.Transactions);
+				bulkInsert("transactionStatements", documents.TransactionStatements);
+				bulkInsert("addressResolutionStatements", documents.AddressResolutionStatements);
+				bulkInsert("mosaicResolutionStatements", documents.MosaicResolutionStatements);
+
+				// wait for all writes before checking any result because pending writes reference documents
+				auto insertResultsContainer = thread::when_all(std::move(futures)).get();
+
+				std::ostringstream heightsDescription;
+				heightsDescription << " at heights " << documents.FirstHeight << " - " << documents.LastHeight;
+
+				auto i = 0u;
+				for (auto& insertResults : insertResultsContainer) {
+					auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(insertResults.get())));
+					const auto& collectionSize = collectionSizes[i++];
+					m_errorPolicy.checkInserted(collectionSize.second, aggregateResult, collectionSize.first + heightsDescription.str());
+				}
+
+				// chain height is updated last so that partially saved blocks are dropped upon recovery
+				setHeight(documents.LastHeight);
+			}
+
 			void saveBlockInternal(const model::BlockElement& blockElement) {
 				auto height = blockElement.Block.Height;
-				auto totalTransactionsCount = saveTransactions(height, blockElement.Transactions);
+
+				// save transactions and statements concurrently
+				size_t totalTransactionsCount = 0;
+				std::vector<thread::future<bool>> futures;
+				futures.push_back(saveTransactions(height, blockElement.Transactions).then([&totalTransactionsCount](auto&& countFuture) {
+					totalTransactionsCount = countFuture.get();
+					return true;
+				}));
 
 				if (blockElement.OptionalStatement)
-					saveBlockStatement(height, *blockElement.OptionalStatement);
+					futures.push_back(saveBlockStatement(height, *blockElement.OptionalStatement));
+
+				// wait for all writes before checking any result because pending writes reference blockElement
+				thread::get_all(thread::when_all(std::move(futures)).get());
 
 				SaveBlockHeader(m_database, blockElement, static_cast<uint32_t>(totalTransactionsCount));
 				setHeight(height);
 			}
 
-			size_t saveTransactions(Height height, const std::vector<model::TransactionElement>& transactions) {
+			thread::future<size_t> saveTransactions(Height height, const std::vector<model::TransactionElement>& transactions) {
 				return SaveTransactions(m_context.bulkWriter(), height, transactions, m_transactionRegistry, m_errorPolicy);
 			}
 
-			void saveBlockStatement(Height height, const model::BlockStatement& blockStatement) {
-				SaveBlockStatement(m_context.bulkWriter(), height, blockStatement, m_receiptRegistry, m_errorPolicy);
+			thread::future<bool> saveBlockStatement(Height height, const model::BlockStatement& blockStatement) {
+				return SaveBlockStatement(m_context.bulkWriter(), height, blockStatement, m_receiptRegistry, m_errorPolicy);
 			}
 
 			void setHeight(Height height) {
@@ -284,6 +415,61 @@ namespace catapult { namespace mongo {
 			MongoDatabase m_database;
 			MongoErrorPolicy m_errorPolicy;
 		};
+
+		class MongoBlockChangeStorage final : public io::BlockChangeSubscriber {
+		public:
+			MongoBlockChangeStorage(
+					MongoStorageContext& context,
+					uint32_t maxDropBatchSize,
+					const MongoTransactionRegistry& transactionRegistry,
+					const MongoReceiptRegistry& receiptRegistry)
+					: m_transactionRegistry(transactionRegistry)
+					, m_receiptRegistry(receiptRegistry)
+					, m_storage(context, maxDropBatchSize, transactionRegistry, receiptRegistry)
+			{}
+
+		public:
+			void notifyBlock(const model::BlockElement& blockElement) override {
+				// only consecutive blocks can be saved together
+				if (!m_documents.empty() && blockElement.Block.Height != m_documents.LastHeight + Height(1))
+					flush();
+
+				if (m_documents.empty())
+					m_batchTimer.emplace();
+
+				AppendBlockDocuments(m_documents, blockElement, m_transactionRegistry, m_receiptRegistry);
+			}
+
+			void notifyDropBlocksAfter(Height height) override {
+				flush();
+				m_storage.dropBlocksAfter(height);
+			}
+
+			void flush() override {
+				if (m_documents.empty())
+					return;
+
+				m_storage.saveBlocks(m_documents);
+
+				// elapsed time includes mapping of all blocks in addition to writing them
+				auto numBlocks = m_documents.Blocks.size();
+				if (numBlocks > 1) {
+					auto elapsedMillis = std::max<uint64_t>(1, m_batchTimer->millis());
+					CATAPULT_LOG(info)
+							<< "saved " << numBlocks << " blocks at heights " << m_documents.FirstHeight << " - " << m_documents.LastHeight
+							<< " in " << elapsedMillis << "ms (" << numBlocks * 60'000 / elapsedMillis << " blocks per minute)";
+				}
+
+				m_documents = BlockDocuments();
+			}
+
+		private:
+			const MongoTransactionRegistry& m_transactionRegistry;
+			const MongoReceiptRegistry& m_receiptRegistry;
+			MongoBlockStorage m_storage;
+			BlockDocuments m_documents;
+			std::optional<utils::StackTimer> m_batchTimer;
+		};
 	}
 
 	std::unique_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
@@ -293,4 +479,12 @@ namespace catapult { namespace mongo {
 			const MongoReceiptRegistry& receiptRegistry) {
 		return std::make_unique<MongoBlockStorage>(context, maxDropBatchSize, transactionRegistry, receiptRegistry);
 	}
+
+	std::unique_ptr<io::BlockChangeSubscriber> CreateMongoBlockChangeStorage(
+			MongoStorageContext& context,
+			uint32_t maxDropBatchSize,
+			const MongoTransactionRegistry& transactionRegistry,
+			const MongoReceiptRegistry& receiptRegistry) {
+		return std::make_unique<MongoBlockChangeStorage>(context, maxDropBatchSize, transactionRegistry, receiptRegistry);
+	}
 }}
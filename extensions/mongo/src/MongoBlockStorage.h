@@ -21,6 +21,7 @@
 
 #pragma once
 #include "MongoStorageContext.h"
+#include "catapult/io/BlockChangeSubscriber.h"
 #include "catapult/io/BlockStorage.h"
 
 namespace catapult {
@@ -38,4 +39,12 @@ namespace catapult { namespace mongo {
 			uint32_t maxDropBatchSize,
 			const MongoTransactionRegistry& transactionRegistry,
 			const MongoReceiptRegistry& receiptRegistry);
+
+	/// Creates a mongodb block change storage around \a context, \a maxDropBatchSize, \a transactionRegistry and \a receiptRegistry.
+	/// \note Consecutive blocks are buffered and saved using a single set of bulk writes when the storage is flushed.
+	std::unique_ptr<io::BlockChangeSubscriber> CreateMongoBlockChangeStorage(
+			MongoStorageContext& context,
+			uint32_t maxDropBatchSize,
+			const MongoTransactionRegistry& transactionRegistry,
+			const MongoReceiptRegistry& receiptRegistry);
 }}
@@ -43,14 +43,25 @@ namespace catapult { namespace mongo {
 	/// Class for writing bulk data to the mongo database.
 	/// \note The bulk writer supports inserting, upserting and deleting documents.
 	class MongoBulkWriter final : public std::enable_shared_from_this<MongoBulkWriter> {
+	public:
+		/// Order in which operations within a single bulk write are applied.
+		enum class BulkWriteOrder {
+			/// Operations are applied in order and processing stops at the first failing operation.
+			Ordered,
+
+			/// Operations are applied in any order and processing continues after failing operations.
+			/// \note This should only be used when operations within a bulk write are independent.
+			Unordered
+		};
+
 	private:
 		struct BulkWriteParams {
 		public:
-			BulkWriteParams(MongoBulkWriter& bulkWriter, const std::string& collectionName)
+			BulkWriteParams(MongoBulkWriter& bulkWriter, const std::string& collectionName, BulkWriteOrder order)
 					: pConnection(bulkWriter.m_connectionPool.acquire())
 					, Database(pConnection->database(bulkWriter.m_dbName))
 					, Collection(Database[collectionName])
-					, Bulk(Collection.create_bulk_write(GetBulkWriteOptions(bulkWriter)))
+					, Bulk(Collection.create_bulk_write(GetBulkWriteOptions(bulkWriter, order)))
 		{}
 
 		public:
@@ -60,8 +71,9 @@ namespace catapult { namespace mongo {
 			mongocxx::bulk_write Bulk;
 
 		private:
-			static mongocxx::options::bulk_write GetBulkWriteOptions(const MongoBulkWriter& bulkWriter) {
+			static mongocxx::options::bulk_write GetBulkWriteOptions(const MongoBulkWriter& bulkWriter, BulkWriteOrder order) {
 				mongocxx::options::bulk_write options;
+				options.ordered(BulkWriteOrder::Ordered == order);
 				options.write_concern(bulkWriter.writeOptions());
 				return options;
 			}
@@ -121,33 +133,35 @@ namespace catapult { namespace mongo {
 
 	public:
 		/// Inserts \a entities into the collection named \a collectionName using a one-to-one mapping of entities
-		/// to documents (\a createDocument).
+		/// to documents (\a createDocument) with the specified bulk write \a order.
 		template<typename TContainer>
 		BulkWriteResultFuture bulkInsert(
 				const std::string& collectionName,
 				const TContainer& entities,
-				const CreateDocument<typename TContainer::value_type>& createDocument) {
+				const CreateDocument<typename TContainer::value_type>& createDocument,
+				BulkWriteOrder order = BulkWriteOrder::Ordered) {
 			auto appendOperation = [createDocument](auto& bulk, const auto& entity, auto index) {
 				auto entityDocument = createDocument(entity, index);
 				bulk.append(mongocxx::model::insert_one(entityDocument.view()));
 			};
 
-			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
+			return bulkWrite<TContainer>(collectionName, entities, appendOperation, order);
 		}
 
 		/// Inserts \a entities into the collection named \a collectionName using a one-to-many mapping of entities
-		/// to documents (\a createDocuments).
+		/// to documents (\a createDocuments) with the specified bulk write \a order.
 		template<typename TContainer>
 		BulkWriteResultFuture bulkInsert(
 				const std::string& collectionName,
 				const TContainer& entities,
-				const CreateDocuments<typename TContainer::value_type>& createDocuments) {
+				const CreateDocuments<typename TContainer::value_type>& createDocuments,
+				BulkWriteOrder order = BulkWriteOrder::Ordered) {
 			auto appendOperation = [createDocuments](auto& bulk, const auto& entity, auto index) {
 				for (const auto& entityDocument : createDocuments(entity, index))
 					bulk.append(mongocxx::model::insert_one(entityDocument.view()));
 			};
 
-			return bulkWrite<TContainer>(collectionName, entities, appendOperation);
+			return bulkWrite<TContainer>(collectionName, entities, appendOperation, order);
 		}
 
 		/// Upserts \a entities into the collection named \a collectionName using a one-to-one mapping of entities
@@ -244,18 +258,19 @@ namespace catapult { namespace mongo {
 		BulkWriteResultFuture bulkWrite(
 				const std::string& collectionName,
 				const TContainer& entities,
-				const AppendOperation<typename TContainer::value_type>& appendOperation) {
+				const AppendOperation<typename TContainer::value_type>& appendOperation,
+				BulkWriteOrder order = BulkWriteOrder::Ordered) {
 			if (entities.empty())
 				return thread::make_ready_future(std::vector<thread::future<BulkWriteResult>>());
 
 			auto numThreads = m_pool.numWorkerThreads();
 			auto pContext = std::make_shared<BulkWriteContext>(std::min<size_t>(entities.size(), numThreads));
-			auto workCallback = [pThis = shared_from_this(), entitiesStart = entities.cbegin(), collectionName, appendOperation, pContext](
+			auto workCallback = [pThis = shared_from_this(), collectionName, appendOperation, order, pContext](
 					auto itBegin,
 					auto itEnd,
 					auto startIndex,
 					auto batchIndex) {
-				auto pBulkWriteParams = std::make_shared<BulkWriteParams>(*pThis, collectionName);
+				auto pBulkWriteParams = std::make_shared<BulkWriteParams>(*pThis, collectionName, order);
 
 				auto index = static_cast<uint32_t>(startIndex);
 				for (auto iter = itBegin; itEnd != iter; ++iter, ++index)
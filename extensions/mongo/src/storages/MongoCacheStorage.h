@@ -98,20 +98,21 @@ namespace catapult { namespace mongo { namespace storages {
 		using CacheChangesType = cache::SingleCacheChangesT<
 			typename TCacheTraits::CacheDeltaType,
 			typename TCacheTraits::CacheType::CacheValueType>;
+		using KeyType = typename TCacheTraits::KeyType;
+		using ModelType = typename TCacheTraits::ModelType;
 		using ElementContainerType = typename TCacheTraits::ElementContainerType;
 		using IdContainerType = typename TCacheTraits::IdContainerType;
 
 	public:
 		/// Creates a cache storage around \a storageContext and \a networkIdentifier.
 		MongoHistoricalCacheStorage(MongoStorageContext& storageContext, model::NetworkIdentifier networkIdentifier)
-				: m_database(storageContext.createDatabaseConnection())
-				, m_errorPolicy(storageContext.createCollectionErrorPolicy(TCacheTraits::Collection_Name))
+				: m_errorPolicy(storageContext.createCollectionErrorPolicy(TCacheTraits::Collection_Name))
 				, m_bulkWriter(storageContext.bulkWriter())
 				, m_networkIdentifier(networkIdentifier)
 		{}
 
 	private:
-		void saveDelta(const CacheChangesType& changes) override {
+		thread::future<bool> saveDeltaAsync(const CacheChangesType& changes) override {
 			auto addedElements = changes.addedElements();
 			auto modifiedElements = changes.modifiedElements();
 			auto removedElements = changes.removedElements();
@@ -120,48 +121,54 @@ namespace catapult { namespace mongo { namespace storages {
 			detail::MongoElementFilter<TCacheTraits, ElementContainerType>::RemoveCommonElements(addedElements, removedElements);
 
 			// 2. remove all modified and removed elements from db
-			auto modifiedIds = GetIds(modifiedElements);
+			auto pRemovedIds = std::make_shared<IdContainerType>(GetIds(modifiedElements));
 			auto removedIds = GetIds(removedElements);
-			modifiedIds.insert(removedIds.cbegin(), removedIds.cend());
-			removeAll(modifiedIds);
+			pRemovedIds->insert(removedIds.cbegin(), removedIds.cend());
 
-			// 3. insert new elements and modified elements into db
+			// 3. insert new elements and modified elements into db after all of their previous documents have been removed
 			modifiedElements.insert(addedElements.cbegin(), addedElements.cend());
-			insertAll(modifiedElements);
+			auto pModels = std::make_shared<std::vector<ModelType>>(mapToMongoModels(modifiedElements));
+			return thread::compose(removeAll(pRemovedIds), [this, pModels](auto&& removeFuture) {
+				removeFuture.get();
+				return insertAll(pModels);
+			});
 		}
 
 	private:
-		void removeAll(const IdContainerType& ids) {
-			if (ids.empty())
-				return;
-
-			auto collection = m_database[TCacheTraits::Collection_Name];
-
-			auto filter = CreateDeleteFilter(ids);
+		thread::future<bool> removeAll(const std::shared_ptr<const IdContainerType>& pIds) {
+			if (pIds->empty())
+				return thread::make_ready_future(true);
+
+			auto deleteResultsFuture = m_bulkWriter.bulkDelete(TCacheTraits::Collection_Name, *pIds, CreateFilterByKey);
+			return deleteResultsFuture.then([&errorPolicy = m_errorPolicy, pIds](auto&& resultsFuture) {
+				auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(resultsFuture.get()));
+				errorPolicy.checkDeletedAtLeast(pIds->size(), aggregateResult, "removed and modified elements");
+				return true;
+			});
+		}
 
-			mongocxx::options::delete_options options;
-			options.write_concern(m_bulkWriter.writeOptions());
+		thread::future<bool> insertAll(const std::shared_ptr<const std::vector<ModelType>>& pModels) {
+			if (pModels->empty())
+				return thread::make_ready_future(true);
 
-			auto deleteResult = collection.delete_many(filter.view(), options);
-			m_errorPolicy.checkDeletedAtLeast(ids.size(), BulkWriteResult(deleteResult.value().result()), "removed and modified elements");
+			auto insertResultsFuture = m_bulkWriter.bulkInsert(TCacheTraits::Collection_Name, *pModels, [](const auto& model, auto) {
+				return TCacheTraits::MapToMongoDocument(model);
+			});
+			return insertResultsFuture.then([&errorPolicy = m_errorPolicy, pModels](auto&& resultsFuture) {
+				auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(resultsFuture.get()));
+				errorPolicy.checkInserted(pModels->size(), aggregateResult, "modified and added elements");
+				return true;
+			});
 		}
 
-		void insertAll(const ElementContainerType& elements) {
-			if (elements.empty())
-				return;
-
-			std::vector<typename TCacheTraits::ModelType> allModels;
+		std::vector<ModelType> mapToMongoModels(const ElementContainerType& elements) const {
+			std::vector<ModelType> allModels;
 			for (const auto* pElement : elements) {
 				auto models = TCacheTraits::MapToMongoModels(*pElement, m_networkIdentifier);
 				std::move(models.begin(), models.end(), std::back_inserter(allModels));
 			}
 
-			auto insertResults = m_bulkWriter.bulkInsert(TCacheTraits::Collection_Name, allModels, [](const auto& model, auto) {
-				return TCacheTraits::MapToMongoDocument(model);
-			}).get();
-
-			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(insertResults)));
-			m_errorPolicy.checkInserted(allModels.size(), aggregateResult, "modified and added elements");
+			return allModels;
 		}
 
 	private:
@@ -173,28 +180,13 @@ namespace catapult { namespace mongo { namespace storages {
 			return ids;
 		}
 
-		static bsoncxx::document::value CreateDeleteFilter(const IdContainerType& ids) {
+		static bsoncxx::document::value CreateFilterByKey(const KeyType& key) {
 			using namespace bsoncxx::builder::stream;
 
-			if (ids.empty())
-				return document() << finalize;
-
-			document doc;
-			auto array = doc
-					<< std::string(TCacheTraits::Id_Property_Name) << open_document
-						<< "$in"
-						<< open_array;
-
-			for (auto id : ids)
-				array << TCacheTraits::MapToMongoId(id);
-
-			array << close_array;
-			doc << close_document;
-			return doc << finalize;
+			return document() << std::string(TCacheTraits::Id_Property_Name) << TCacheTraits::MapToMongoId(key) << finalize;
 		}
 
 	private:
-		MongoDatabase m_database;
 		MongoErrorPolicy m_errorPolicy;
 		MongoBulkWriter& m_bulkWriter;
 		model::NetworkIdentifier m_networkIdentifier;
@@ -219,42 +211,49 @@ namespace catapult { namespace mongo { namespace storages {
 		{}
 
 	private:
-		void saveDelta(const CacheChangesType& changes) override {
+		thread::future<bool> saveDeltaAsync(const CacheChangesType& changes) override {
 			auto addedElements = changes.addedElements();
-			auto modifiedElements = changes.modifiedElements();
-			auto removedElements = changes.removedElements();
+			auto pModifiedElements = std::make_shared<ElementContainerType>(changes.modifiedElements());
+			auto pRemovedElements = std::make_shared<ElementContainerType>(changes.removedElements());
 
 			// 1. remove elements common to both added and removed
-			detail::MongoElementFilter<TCacheTraits, ElementContainerType>::RemoveCommonElements(addedElements, removedElements);
-
-			// 2. remove all removed elements from db
-			removeAll(removedElements);
-
-			// 3. upsert new elements and modified elements into db
-			modifiedElements.insert(addedElements.cbegin(), addedElements.cend());
-			upsertAll(modifiedElements);
+			detail::MongoElementFilter<TCacheTraits, ElementContainerType>::RemoveCommonElements(addedElements, *pRemovedElements);
+
+			// 2. remove all removed elements from db and upsert new elements and modified elements into db
+			//    (both sets are disjoint, so they can be written concurrently)
+			pModifiedElements->insert(addedElements.cbegin(), addedElements.cend());
+			return thread::when_all(removeAll(pRemovedElements), upsertAll(pModifiedElements)).then([](auto&& resultsFuture) {
+				thread::get_all(resultsFuture.get());
+				return true;
+			});
 		}
 
 	private:
-		void removeAll(const ElementContainerType& elements) {
-			if (elements.empty())
-				return;
-
-			auto deleteResults = m_bulkWriter.bulkDelete(TCacheTraits::Collection_Name, elements, CreateFilter).get();
-			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(deleteResults)));
-			m_errorPolicy.checkDeleted(elements.size(), aggregateResult, "removed elements");
+		thread::future<bool> removeAll(const std::shared_ptr<const ElementContainerType>& pElements) {
+			if (pElements->empty())
+				return thread::make_ready_future(true);
+
+			auto deleteResultsFuture = m_bulkWriter.bulkDelete(TCacheTraits::Collection_Name, *pElements, CreateFilter);
+			return deleteResultsFuture.then([&errorPolicy = m_errorPolicy, pElements](auto&& resultsFuture) {
+				auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(resultsFuture.get()));
+				errorPolicy.checkDeleted(pElements->size(), aggregateResult, "removed elements");
+				return true;
+			});
 		}
 
-		void upsertAll(const ElementContainerType& elements) {
-			if (elements.empty())
-				return;
+		thread::future<bool> upsertAll(const std::shared_ptr<const ElementContainerType>& pElements) {
+			if (pElements->empty())
+				return thread::make_ready_future(true);
 
 			auto createDocument = [networkIdentifier = m_networkIdentifier](const auto* pModel, auto) {
 				return TCacheTraits::MapToMongoDocument(*pModel, networkIdentifier);
 			};
-			auto upsertResults = m_bulkWriter.bulkUpsert(TCacheTraits::Collection_Name, elements, createDocument, CreateFilter).get();
-			auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(std::move(upsertResults)));
-			m_errorPolicy.checkUpserted(elements.size(), aggregateResult, "modified and added elements");
+			auto upsertResultsFuture = m_bulkWriter.bulkUpsert(TCacheTraits::Collection_Name, *pElements, createDocument, CreateFilter);
+			return upsertResultsFuture.then([&errorPolicy = m_errorPolicy, pElements](auto&& resultsFuture) {
+				auto aggregateResult = BulkWriteResult::Aggregate(thread::get_all(resultsFuture.get()));
+				errorPolicy.checkUpserted(pElements->size(), aggregateResult, "modified and added elements");
+				return true;
+			});
 		}
 
 	private:
@@ -126,4 +126,87 @@ namespace catapult { namespace mongo {
 		AssertStorage<2>(*subStorages[1], 1, Height(0));
 		AssertStorage<3>(*subStorages[2], 1, Height(0));
 	}
+
+	namespace {
+		class PendingExternalCacheStorage : public ExternalCacheStorage {
+		public:
+			PendingExternalCacheStorage() : ExternalCacheStorage("PendingExternalCacheStorage", 0)
+			{}
+
+		public:
+			void complete() {
+				m_promise.set_value(true);
+			}
+
+			void fail() {
+				m_promise.set_exception(std::make_exception_ptr(catapult_runtime_error("pending storage failed")));
+			}
+
+		public:
+			thread::future<bool> saveDeltaAsync(const cache::CacheChanges&) override {
+				return m_promise.get_future();
+			}
+
+		private:
+			thread::promise<bool> m_promise;
+		};
+
+		template<typename TAction>
+		void RunPendingStoragesTest(TAction action) {
+			// Arrange:
+			std::vector<PendingExternalCacheStorage*> subStorages;
+			StorageContainer container;
+			for (auto i = 0u; i < 3; ++i) {
+				auto pSubStorage = std::make_unique<PendingExternalCacheStorage>();
+				subStorages.push_back(pSubStorage.get());
+				container.emplace_back(std::move(pSubStorage));
+			}
+
+			AggregateExternalCacheStorage storage(std::move(container));
+			auto catapultCache = CreateCatapultCache();
+			auto delta = catapultCache.createDelta();
+			cache::CacheChanges changes(delta);
+
+			// Act + Assert:
+			action(storage.saveDeltaAsync(changes), subStorages);
+		}
+	}
+
+	TEST(TEST_CLASS, AggregateExternalCacheStorage_SaveDeltaAsyncCompletesWhenAllSubStoragesComplete) {
+		// Arrange:
+		RunPendingStoragesTest([](auto&& future, const auto& subStorages) {
+			// Act: complete all sub storages except for the second one
+			subStorages[0]->complete();
+			subStorages[2]->complete();
+
+			// Assert:
+			EXPECT_FALSE(future.is_ready());
+
+			// Act: complete the remaining sub storage
+			subStorages[1]->complete();
+
+			// Assert:
+			ASSERT_TRUE(future.is_ready());
+			EXPECT_TRUE(future.get());
+		});
+	}
+
+	TEST(TEST_CLASS, AggregateExternalCacheStorage_SaveDeltaAsyncFailsWhenAnySubStorageFails) {
+		// Arrange:
+		RunPendingStoragesTest([](auto&& future, const auto& subStorages) {
+			// Act: fail one sub storage
+			subStorages[0]->complete();
+			subStorages[1]->fail();
+
+			// Assert: the aggregate waits for all sub storages to complete
+			EXPECT_FALSE(future.is_ready());
+
+			// Act: complete the remaining sub storage
+			subStorages[2]->complete();
+
+			// Assert:
+			ASSERT_TRUE(future.is_ready());
+			EXPECT_THROW(future.get(), catapult_runtime_error);
+		});
+	}
 }}
@@ -56,8 +56,9 @@ namespace catapult { namespace mongo {
 			}
 
 		public:
-			void saveDelta(const cache::CacheChanges& changes) override {
+			thread::future<bool> saveDeltaAsync(const cache::CacheChanges& changes) override {
 				m_capturedChanges.push_back(&changes);
+				return thread::make_ready_future(true);
 			}
 
 		private:
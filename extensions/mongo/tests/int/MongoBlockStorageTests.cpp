@@ -70,22 +70,47 @@ namespace catapult { namespace mongo {
 			}
 		};
 
-		std::shared_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
+		template<typename TStorage, typename TStorageFactory>
+		std::shared_ptr<TStorage> CreateStorage(
 				std::unique_ptr<MongoTransactionPlugin>&& pTransactionPlugin,
-				MongoErrorPolicy::Mode errorPolicyMode = MongoErrorPolicy::Mode::Strict) {
+				MongoErrorPolicy::Mode errorPolicyMode,
+				TStorageFactory storageFactory) {
 			auto pMongoReceiptRegistry = std::make_shared<MongoReceiptRegistry>();
 			auto mockReceiptType = utils::to_underlying_type(mocks::MockReceipt::Receipt_Type);
 			pMongoReceiptRegistry->registerPlugin(mocks::CreateMockReceiptMongoPlugin(mockReceiptType));
 			const auto& receiptRegistry = *pMongoReceiptRegistry;
-			auto pBlockStorage = test::CreateMongoStorage<io::LightBlockStorage>(
+			auto pStorage = test::CreateMongoStorage<TStorage>(
 					std::move(pTransactionPlugin),
 					test::DbInitializationType::None,
 					errorPolicyMode,
-					[&receiptRegistry](auto& context, const auto& transactionRegistry) {
-						return mongo::CreateMongoBlockStorage(context, Max_Drop_Batch_Size, transactionRegistry, receiptRegistry);
+					[&receiptRegistry, storageFactory](auto& context, const auto& transactionRegistry) {
+						return storageFactory(context, Max_Drop_Batch_Size, transactionRegistry, receiptRegistry);
 					});
 
-			return decltype(pBlockStorage)(pBlockStorage.get(), [pMongoReceiptRegistry, pBlockStorage](const auto*) {});
+			return decltype(pStorage)(pStorage.get(), [pMongoReceiptRegistry, pStorage](const auto*) {});
+		}
+
+		std::shared_ptr<io::LightBlockStorage> CreateMongoBlockStorage(
+				std::unique_ptr<MongoTransactionPlugin>&& pTransactionPlugin,
+				MongoErrorPolicy::Mode errorPolicyMode = MongoErrorPolicy::Mode::Strict) {
+			return CreateStorage<io::LightBlockStorage>(std::move(pTransactionPlugin), errorPolicyMode, [](
+					auto& context,
+					auto maxDropBatchSize,
+					const auto& transactionRegistry,
+					const auto& receiptRegistry) {
+				return mongo::CreateMongoBlockStorage(context, maxDropBatchSize, transactionRegistry, receiptRegistry);
+			});
+		}
+
+		std::shared_ptr<io::BlockChangeSubscriber> CreateMongoBlockChangeStorage(
+				MongoErrorPolicy::Mode errorPolicyMode = MongoErrorPolicy::Mode::Strict) {
+			return CreateStorage<io::BlockChangeSubscriber>(mocks::CreateMockTransactionMongoPlugin(), errorPolicyMode, [](
+					auto& context,
+					auto maxDropBatchSize,
+					const auto& transactionRegistry,
+					const auto& receiptRegistry) {
+				return mongo::CreateMongoBlockChangeStorage(context, maxDropBatchSize, transactionRegistry, receiptRegistry);
+			});
 		}
 
 		size_t GetNumEntitiesAtHeight(
@@ -726,4 +751,154 @@ namespace catapult { namespace mongo {
 	}
 
 	// endregion
+
+	// region block change storage (multiple blocks)
+
+	namespace {
+		void NotifyBlocks(
+				io::BlockChangeSubscriber& blockChangeStorage,
+				const std::vector<model::BlockElement>& blockElements,
+				size_t startIndex,
+				size_t endIndex) {
+			for (auto i = startIndex; i < endIndex; ++i)
+				blockChangeStorage.notifyBlock(blockElements[i]);
+		}
+
+		void AssertBlocksUpToHeight(const std::vector<model::BlockElement>& blockElements, Height height) {
+			BlockElementCounts blockElementCounts;
+			for (const auto& blockElement : blockElements) {
+				if (blockElement.Block.Height <= height) {
+					AssertEqual(blockElement, Default_Transactions_Per_Block);
+					blockElementCounts.AddCounts(blockElement);
+				} else {
+					AssertNoBlockOrTransactions(blockElement.Block.Height);
+				}
+			}
+
+			AssertCollectionSizes(blockElementCounts);
+		}
+	}
+
+	TEST(TEST_CLASS, BlockChangeStorage_FlushHasNoEffectWhenNoBlocksArePending) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		auto pBlockChangeStorage = CreateMongoBlockChangeStorage();
+
+		// Act:
+		pBlockChangeStorage->flush();
+
+		// Assert:
+		EXPECT_EQ(Height(), context.storage().chainHeight());
+		test::AssertCollectionSize("blocks", 0);
+	}
+
+	TEST(TEST_CLASS, BlockChangeStorage_DoesNotSaveBlocksBeforeFlush) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		auto pBlockChangeStorage = CreateMongoBlockChangeStorage();
+
+		// Act:
+		NotifyBlocks(*pBlockChangeStorage, context.elements(), 0, Multiple_Blocks_Count);
+
+		// Assert:
+		EXPECT_EQ(Height(), context.storage().chainHeight());
+		AssertBlocksUpToHeight(context.elements(), Height());
+	}
+
+	TEST(TEST_CLASS, BlockChangeStorage_CanSaveMultipleBlocksOnFlush) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		auto pBlockChangeStorage = CreateMongoBlockChangeStorage();
+		NotifyBlocks(*pBlockChangeStorage, context.elements(), 0, Multiple_Blocks_Count);
+
+		// Act:
+		pBlockChangeStorage->flush();
+
+		// Assert:
+		EXPECT_EQ(Height(Multiple_Blocks_Count), context.storage().chainHeight());
+		AssertBlocksUpToHeight(context.elements(), Height(Multiple_Blocks_Count));
+	}
+
+	TEST(TEST_CLASS, BlockChangeStorage_CanSaveMultipleBatchesOfBlocks) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		auto pBlockChangeStorage = CreateMongoBlockChangeStorage();
+
+		const auto& elements = context.elements();
+		NotifyBlocks(*pBlockChangeStorage, elements, 0, 4);
+		pBlockChangeStorage->flush();
+
+		// Act:
+		NotifyBlocks(*pBlockChangeStorage, elements, 4, elements.size());
+		pBlockChangeStorage->flush();
+
+		// Assert:
+		EXPECT_EQ(Height(Multiple_Blocks_Count), context.storage().chainHeight());
+		AssertBlocksUpToHeight(elements, Height(Multiple_Blocks_Count));
+	}
+
+	TEST(TEST_CLASS, BlockChangeStorage_CanSaveBlocksAfterExistingBlocks) {
+		// Arrange: save first blocks one by one
+		TestContext context(Multiple_Blocks_Count);
+		const auto& elements = context.elements();
+		for (auto i = 0u; i < 4; ++i)
+			context.storage().saveBlock(elements[i]);
+
+		auto pBlockChangeStorage = CreateMongoBlockChangeStorage();
+		NotifyBlocks(*pBlockChangeStorage, elements, 4, elements.size());
+
+		// Act:
+		pBlockChangeStorage->flush();
+
+		// Assert:
+		EXPECT_EQ(Height(Multiple_Blocks_Count), context.storage().chainHeight());
+		AssertBlocksUpToHeight(elements, Height(Multiple_Blocks_Count));
+	}
+
+	TEST(TEST_CLASS, BlockChangeStorage_CannotSaveBlocksNotFollowingStorageHeight) {
+		// Arrange: skip first block
+		TestContext context(Multiple_Blocks_Count);
+		auto pBlockChangeStorage = CreateMongoBlockChangeStorage();
+
+		const auto& elements = context.elements();
+		NotifyBlocks(*pBlockChangeStorage, elements, 1, elements.size());
+
+		// Act + Assert:
+		EXPECT_THROW(pBlockChangeStorage->flush(), catapult_invalid_argument);
+		EXPECT_EQ(Height(), context.storage().chainHeight());
+	}
+
+	TEST(TEST_CLASS, BlockChangeStorage_CanRewriteBlocksWhenErrorModeIsIdempotent) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count, MongoErrorPolicy::Mode::Idempotent);
+		context.saveBlocks();
+
+		auto pBlockChangeStorage = CreateMongoBlockChangeStorage(MongoErrorPolicy::Mode::Idempotent);
+
+		const auto& elements = context.elements();
+		NotifyBlocks(*pBlockChangeStorage, elements, 6, elements.size());
+
+		// Act:
+		pBlockChangeStorage->flush();
+
+		// Assert:
+		EXPECT_EQ(Height(Multiple_Blocks_Count), context.storage().chainHeight());
+		AssertBlocksUpToHeight(elements, Height(Multiple_Blocks_Count));
+	}
+
+	TEST(TEST_CLASS, BlockChangeStorage_DropBlocksAfterSavesPendingBlocksFirst) {
+		// Arrange:
+		TestContext context(Multiple_Blocks_Count);
+		auto pBlockChangeStorage = CreateMongoBlockChangeStorage();
+		NotifyBlocks(*pBlockChangeStorage, context.elements(), 0, Multiple_Blocks_Count);
+
+		// Act:
+		pBlockChangeStorage->notifyDropBlocksAfter(Height(7));
+
+		// Assert:
+		EXPECT_EQ(Height(7), context.storage().chainHeight());
+		AssertBlocksUpToHeight(context.elements(), Height(7));
+	}
+
+	// endregion
 }}
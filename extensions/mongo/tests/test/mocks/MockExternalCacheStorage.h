@@ -34,8 +34,9 @@ namespace catapult { namespace mocks {
 		{}
 
 	private:
-		void saveDelta(const cache::SingleCacheChangesT<test::SimpleCacheDelta, uint64_t>&) override {
+		thread::future<bool> saveDeltaAsync(const cache::SingleCacheChangesT<test::SimpleCacheDelta, uint64_t>&) override {
 			++m_numSaveDeltaCalls;
+			return thread::make_ready_future(true);
 		}
 
 	public:
@@ -60,6 +60,7 @@ namespace catapult { namespace partialtransaction {
 			options.DisruptorMaxMemorySize = config.TransactionDisruptorMaxMemorySize;
 			options.ElementTraceInterval = config.TransactionElementTraceInterval;
 			options.ShouldThrowWhenFull = config.EnableDispatcherAbortWhenFull;
+			options.WaitStrategy = config.DispatcherWaitStrategy;
 			return options;
 		}
 
@@ -191,15 +192,15 @@ namespace catapult { namespace partialtransaction {
 						[&batchRangeDispatcher](auto&& transactionRange) {
 							batchRangeDispatcher.queue(std::move(transactionRange), InputSource::Remote_Pull);
 						},
-						[&ptUpdater, &newCosignatures, pRecentHashCache](auto&& cosignature) {
-							if (pRecentHashCache->add(ToHash(cosignature))) {
-								ptUpdater.update(cosignature);
+						[&newCosignatures, pRecentHashCache](auto&& cosignature) {
+							if (pRecentHashCache->add(ToHash(cosignature)))
 								newCosignatures.push_back(cosignature);
-							}
 						});
 
-				if (!newCosignatures.empty())
+				if (!newCosignatures.empty()) {
+					ptUpdater.update(newCosignatures);
 					cosignaturesSink(newCosignatures);
+				}
 			});
 
 			auto shouldProcessTransactions = extensions::CreateShouldProcessTransactionsPredicate(state);
@@ -215,14 +216,14 @@ namespace catapult { namespace partialtransaction {
 			hooks.setCosignatureRangeConsumer([&ptUpdater, pRecentHashCache, cosignaturesSink](auto&& cosignatureRange) {
 				std::vector<model::DetachedCosignature> newCosignatures;
 				for (const auto& cosignature : cosignatureRange.Range) {
-					if (pRecentHashCache->add(ToHash(cosignature))) {
-						ptUpdater.update(cosignature);
+					if (pRecentHashCache->add(ToHash(cosignature)))
 						newCosignatures.push_back(cosignature);
-					}
 				}
 
-				if (!newCosignatures.empty())
+				if (!newCosignatures.empty()) {
+					ptUpdater.update(newCosignatures);
 					cosignaturesSink(newCosignatures);
+				}
 			});
 
 			state.tasks().push_back(extensions::CreateBatchTransactionTask(batchRangeDispatcher, "partial transaction"));
@@ -24,9 +24,11 @@
 #include "partialtransaction/src/PtUtils.h"
 #include "plugins/txes/aggregate/src/model/AggregateTransaction.h"
 #include "catapult/cache_tx/MemoryPtCache.h"
+#include "catapult/crypto/SecureRandomGenerator.h"
 #include "catapult/crypto/Signer.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/ArraySet.h"
 #include "catapult/utils/HexFormatter.h"
 #include "catapult/utils/MemoryUtils.h"
@@ -71,6 +73,10 @@ namespace catapult { namespace chain {
 
 			return cosignatures;
 		}
+
+		void FillSecureRandom(uint8_t* pOut, size_t count) {
+			crypto::SecureRandomGenerator().fill(pOut, count);
+		}
 	}
 
 	struct StaleTransactionInfo {
@@ -136,6 +142,7 @@ namespace catapult { namespace chain {
 				, m_completedTransactionSink(completedTransactionSink)
 				, m_failedTransactionSink(failedTransactionSink)
 				, m_ioContext(pool.ioContext())
+				, m_numWorkerThreads(pool.numWorkerThreads())
 		{}
 
 	private:
@@ -207,15 +214,71 @@ namespace catapult { namespace chain {
 			auto updateFuture = pPromise->get_future();
 
 			boost::asio::post(m_ioContext, [pThis = shared_from_this(), cosignature, pPromise{std::move(pPromise)}]() {
-				auto result = pThis->updateImpl(cosignature);
+				auto result = CosignatureUpdateResult::Error;
+				pThis->updateImpl(&cosignature, 1, &result);
 				pPromise->set_value(std::move(result));
 			});
 
 			return updateFuture;
 		}
 
+		thread::future<std::vector<CosignatureUpdateResult>> update(const DetachedCosignatures& cosignatures) {
+			if (cosignatures.empty())
+				return thread::make_ready_future(std::vector<CosignatureUpdateResult>());
+
+			// each partition captures pCosignatures and pResults by value, which keeps both objects alive
+			auto pCosignatures = std::make_shared<DetachedCosignatures>(cosignatures);
+			auto pResults = std::make_shared<std::vector<CosignatureUpdateResult>>(cosignatures.size(), CosignatureUpdateResult::Error);
+			auto partitionCallback = [pThis = shared_from_this(), pCosignatures, pResults](
+					auto itBegin,
+					auto itEnd,
+					auto startIndex,
+					auto) {
+				auto count = static_cast<size_t>(std::distance(itBegin, itEnd));
+				pThis->updateImpl(&*itBegin, count, &(*pResults)[startIndex]);
+			};
+
+			auto partitionsFuture = thread::ParallelForPartition(m_ioContext, *pCosignatures, m_numWorkerThreads, partitionCallback);
+			return partitionsFuture.then([pResults](auto&&) {
+				return std::move(*pResults);
+			});
+		}
+
 	private:
-		CosignatureUpdateResult updateImpl(const model::DetachedCosignature& cosignature) {
+		void updateImpl(const model::DetachedCosignature* pCosignatures, size_t count, CosignatureUpdateResult* pResults) {
+			// filter out all ineligible cosignatures before verifying any signatures
+			std::vector<size_t> eligibleIndexes;
+			std::vector<crypto::SignatureInput> signatureInputs;
+			for (auto i = 0u; i < count; ++i) {
+				const auto& cosignature = pCosignatures[i];
+				if (!isEligible(cosignature, pResults[i]))
+					continue;
+
+				eligibleIndexes.push_back(i);
+				signatureInputs.push_back({ cosignature.SignerPublicKey, { cosignature.ParentHash }, cosignature.Signature });
+			}
+
+			if (eligibleIndexes.empty())
+				return;
+
+			// verify all eligible cosignatures as a batch, which only falls back to individual verification when the batch fails
+			auto verifyResultsPair = crypto::VerifyMulti(FillSecureRandom, signatureInputs.data(), signatureInputs.size());
+			for (auto i = 0u; i < eligibleIndexes.size(); ++i) {
+				const auto& cosignature = pCosignatures[eligibleIndexes[i]];
+				auto& result = pResults[eligibleIndexes[i]];
+				if (!verifyResultsPair.first[i]) {
+					CATAPULT_LOG(debug)
+							<< "ignoring unverifiable cosignature (signer = " << cosignature.SignerPublicKey
+							<< ", parentHash = " << cosignature.ParentHash << ")";
+					result = CosignatureUpdateResult::Unverifiable;
+					continue;
+				}
+
+				result = addCosignature(cosignature);
+			}
+		}
+
+		bool isEligible(const model::DetachedCosignature& cosignature, CosignatureUpdateResult& result) {
 			auto eligiblityResult = checkEligibility(cosignature);
 
 			// proactively refresh the cache even if the new cosignature is invalid
@@ -226,31 +289,20 @@ namespace catapult { namespace chain {
 				if (eligiblityResult.isPurgeRequired())
 					remove(cosignature.ParentHash);
 
-				return eligiblityResult.updateResult();
+				result = eligiblityResult.updateResult();
+				return false;
 			}
 
-			if (!crypto::Verify(cosignature.SignerPublicKey, cosignature.ParentHash, cosignature.Signature)) {
-				CATAPULT_LOG(debug)
-						<< "ignoring unverifiable cosignature (signer = " << cosignature.SignerPublicKey
-						<< ", parentHash = " << cosignature.ParentHash << ")";
-				return CosignatureUpdateResult::Unverifiable;
-			}
-
-			return addCosignature(cosignature);
+			return true;
 		}
 
 		thread::future<PtUpdateResult> update(const DetachedCosignatures& cosignatures, PtUpdateResult::UpdateType updateType) {
 			if (cosignatures.empty())
 				return thread::make_ready_future(PtUpdateResult{ updateType, 0u });
 
-			std::vector<thread::future<CosignatureUpdateResult>> futures;
-			for (const auto& cosignature : cosignatures)
-				futures.emplace_back(update(cosignature));
-
-			return thread::when_all(std::move(futures)).then([updateType](auto&& resultsFuture) {
+			return update(cosignatures).then([updateType](auto&& resultsFuture) {
 				auto results = resultsFuture.get();
-				auto numCosignaturesAdded = std::count_if(results.begin(), results.end(), [](auto& resultFuture) {
-					auto result = resultFuture.get();
+				auto numCosignaturesAdded = std::count_if(results.cbegin(), results.cend(), [](auto result) {
 					return CosignatureUpdateResult::Added_Incomplete == result || CosignatureUpdateResult::Added_Complete == result;
 				});
 
@@ -395,6 +447,7 @@ namespace catapult { namespace chain {
 		CompletedTransactionSink m_completedTransactionSink;
 		FailedTransactionSink m_failedTransactionSink;
 		boost::asio::io_context& m_ioContext;
+		size_t m_numWorkerThreads;
 	};
 
 	PtUpdater::PtUpdater(
@@ -420,4 +473,8 @@ namespace catapult { namespace chain {
 	thread::future<CosignatureUpdateResult> PtUpdater::update(const model::DetachedCosignature& cosignature) {
 		return m_pImpl->update(cosignature);
 	}
+
+	thread::future<std::vector<CosignatureUpdateResult>> PtUpdater::update(const std::vector<model::DetachedCosignature>& cosignatures) {
+		return m_pImpl->update(cosignatures);
+	}
 }}
@@ -112,6 +112,10 @@ namespace catapult { namespace chain {
 		/// Updates this cache by adding a new \a cosignature.
 		thread::future<CosignatureUpdateResult> update(const model::DetachedCosignature& cosignature);
 
+		/// Updates this cache by adding all new \a cosignatures.
+		/// \note Signatures are verified in batches that are processed in parallel.
+		thread::future<std::vector<CosignatureUpdateResult>> update(const std::vector<model::DetachedCosignature>& cosignatures);
+
 	private:
 		class Impl;
 		std::shared_ptr<Impl> m_pImpl; // shared_ptr to allow use of enable_shared_from_this
@@ -1343,6 +1343,114 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region update cosignatures
+
+	TEST(TEST_CLASS, AddingZeroCosignaturesHasNoEffect) {
+		// Arrange:
+		RunTestWithTransactionInCache(3, [](auto& context, const auto& transactionInfo, const auto& transaction) {
+			// Act:
+			auto results = context.updater().update(std::vector<model::DetachedCosignature>()).get();
+
+			// Assert:
+			EXPECT_TRUE(results.empty());
+
+			const auto* pCosignatures = transaction.CosignaturesPtr();
+			context.assertSingleTransactionInCache(transactionInfo.EntityHash, transaction, {
+				pCosignatures[0], pCosignatures[1], pCosignatures[2]
+			});
+
+			EXPECT_TRUE(context.completedTransactions().empty());
+			EXPECT_TRUE(context.failedTransactionStatuses().empty());
+			context.validator().assertCalls(transaction, { 0, 0, 0 });
+		});
+	}
+
+	namespace {
+		template<typename TPrepareCosignatures>
+		void RunAddingManyCosignaturesTest(
+				const std::vector<CosignatureUpdateResult>& expectedResults,
+				TPrepareCosignatures prepareCosignatures) {
+			// Arrange:
+			RunTestWithTransactionInCache(3, [&](auto& context, const auto& transactionInfo, const auto& transaction) {
+				// - create compatible cosignatures (make sure there are more cosignatures than threads to batch some)
+				std::vector<model::DetachedCosignature> cosignatures;
+				for (auto i = 0u; i < expectedResults.size(); ++i)
+					cosignatures.push_back(test::GenerateValidCosignature(transactionInfo.EntityHash));
+
+				prepareCosignatures(context, cosignatures);
+
+				// Act:
+				auto results = context.updater().update(cosignatures).get();
+
+				// Assert:
+				EXPECT_EQ(expectedResults, results);
+
+				const auto* pCosignatures = transaction.CosignaturesPtr();
+				std::vector<model::Cosignature> expectedCosignatures{ pCosignatures[0], pCosignatures[1], pCosignatures[2] };
+				for (auto i = 0u; i < expectedResults.size(); ++i) {
+					if (CosignatureUpdateResult::Added_Incomplete == expectedResults[i])
+						expectedCosignatures.push_back(cosignatures[i]);
+				}
+
+				context.assertSingleTransactionInCache(transactionInfo.EntityHash, transaction, expectedCosignatures);
+				context.assertTransactionInCacheHasCorrectExtendedProperties(transactionInfo);
+
+				EXPECT_TRUE(context.completedTransactions().empty());
+				EXPECT_TRUE(context.failedTransactionStatuses().empty());
+			});
+		}
+
+		uint32_t GetNumBatchCosignatures() {
+			// make sure there are enough cosignatures for some to be batch verified on all threads
+			return 8 * test::GetNumDefaultPoolThreads();
+		}
+	}
+
+	TEST(TEST_CLASS, AddingManyCosignaturesWithMatchingTransactionAddsAllCosignatures) {
+		// Arrange:
+		std::vector<CosignatureUpdateResult> expectedResults(GetNumBatchCosignatures(), CosignatureUpdateResult::Added_Incomplete);
+
+		// Act + Assert:
+		RunAddingManyCosignaturesTest(expectedResults, [](const auto&, const auto&) {});
+	}
+
+	TEST(TEST_CLASS, AddingManyCosignaturesWithMatchingTransactionIgnoresUnverifiableCosignatures) {
+		// Arrange:
+		std::vector<CosignatureUpdateResult> expectedResults(GetNumBatchCosignatures(), CosignatureUpdateResult::Added_Incomplete);
+		expectedResults[1] = CosignatureUpdateResult::Unverifiable;
+		expectedResults[expectedResults.size() / 2] = CosignatureUpdateResult::Unverifiable;
+		expectedResults[expectedResults.size() - 1] = CosignatureUpdateResult::Unverifiable;
+
+		// Act + Assert:
+		RunAddingManyCosignaturesTest(expectedResults, [&expectedResults](const auto&, auto& cosignatures) {
+			// - make some cosignatures unverifiable
+			for (auto i = 0u; i < expectedResults.size(); ++i) {
+				if (CosignatureUpdateResult::Unverifiable == expectedResults[i])
+					cosignatures[i].Signature[0] ^= 0xFF;
+			}
+		});
+	}
+
+	TEST(TEST_CLASS, AddingManyCosignaturesWithMatchingTransactionIgnoresIneligibleCosignatures) {
+		// Arrange:
+		std::vector<CosignatureUpdateResult> expectedResults(GetNumBatchCosignatures(), CosignatureUpdateResult::Added_Incomplete);
+		expectedResults[0] = CosignatureUpdateResult::Ineligible;
+		expectedResults[expectedResults.size() - 2] = CosignatureUpdateResult::Ineligible;
+
+		// Act + Assert:
+		RunAddingManyCosignaturesTest(expectedResults, [&expectedResults](auto& context, const auto& cosignatures) {
+			// - mark some cosignatures as ineligible
+			for (auto i = 0u; i < expectedResults.size(); ++i) {
+				if (CosignatureUpdateResult::Ineligible == expectedResults[i]) {
+					auto result = CosignatoriesValidationResult::Ineligible;
+					context.validator().setValidateCosignatoriesResult(result, cosignatures[i].SignerPublicKey);
+				}
+			}
+		});
+	}
+
+	// endregion
+
 	// region threading
 
 	TEST(TEST_CLASS, FuturesAreFulfilledEvenWhenUpdaterIsDestroyed) {
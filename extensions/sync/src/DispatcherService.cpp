@@ -46,6 +46,7 @@
 #include "catapult/extensions/DispatcherUtils.h"
 #include "catapult/extensions/ExecutionConfigurationFactory.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
+#include "catapult/extensions/LocalNodeStateFileStorage.h"
 #include "catapult/extensions/NodeInteractionUtils.h"
 #include "catapult/extensions/PluginUtils.h"
 #include "catapult/extensions/ServiceLocator.h"
@@ -58,6 +59,7 @@
 #include "catapult/subscribers/StateChangeSubscriber.h"
 #include "catapult/subscribers/TransactionStatusSubscriber.h"
 #include "catapult/thread/MultiServicePool.h"
+#include "catapult/utils/StackTimer.h"
 #include <filesystem>
 
 using namespace catapult::consumers;
@@ -87,6 +89,7 @@ namespace catapult { namespace sync {
 			options.DisruptorMaxMemorySize = config.BlockDisruptorMaxMemorySize;
 			options.ElementTraceInterval = config.BlockElementTraceInterval;
 			options.ShouldThrowWhenFull = config.EnableDispatcherAbortWhenFull;
+			options.WaitStrategy = config.DispatcherWaitStrategy;
 			return options;
 		}
 
@@ -95,6 +98,7 @@ namespace catapult { namespace sync {
 			options.DisruptorMaxMemorySize = config.TransactionDisruptorMaxMemorySize;
 			options.ElementTraceInterval = config.TransactionElementTraceInterval;
 			options.ShouldThrowWhenFull = config.EnableDispatcherAbortWhenFull;
+			options.WaitStrategy = config.DispatcherWaitStrategy;
 			return options;
 		}
 
@@ -150,7 +154,8 @@ namespace catapult { namespace sync {
 
 		BlockChainProcessor CreateSyncProcessor(
 				const model::BlockChainConfiguration& blockChainConfig,
-				const chain::ExecutionConfiguration& executionConfig) {
+				const chain::ExecutionConfiguration& executionConfig,
+				thread::IoThreadPool& pool) {
 			BlockHitPredicateFactory blockHitPredicateFactory = [&blockChainConfig](const cache::ReadOnlyCatapultCache& cache) {
 				cache::ImportanceView view(cache.sub<cache::AccountStateCache>());
 				return chain::BlockHitPredicate(blockChainConfig, [view](const auto& publicKey, auto height) {
@@ -160,10 +165,31 @@ namespace catapult { namespace sync {
 			return CreateBlockChainProcessor(
 					blockHitPredicateFactory,
 					chain::CreateBatchEntityProcessor(executionConfig),
-					GetReceiptValidationMode(blockChainConfig));
+					GetReceiptValidationMode(blockChainConfig),
+					pool);
 		}
 
-		BlockChainSyncHandlers CreateBlockChainSyncHandlers(extensions::ServiceState& state, RollbackInfo& rollbackInfo) {
+		BlockChainSyncHandlers::CommitStepFunc CreateTimedCommitStepHandler(
+				const BlockChainSyncHandlers::CommitStepFunc& commitStepHandler,
+				utils::DiagnosticHistogram& commitHistogram) {
+			// commit steps are always executed sequentially by the sync consumer, so the timer doesn't need to be synchronized
+			auto pCommitTimer = std::make_shared<utils::StackTimer>();
+			return [commitStepHandler, &commitHistogram, pCommitTimer](auto step) {
+				if (CommitOperationStep::Blocks_Written == step)
+					*pCommitTimer = utils::StackTimer();
+
+				commitStepHandler(step);
+
+				if (CommitOperationStep::All_Updated == step)
+					commitHistogram.record(pCommitTimer->micros());
+			};
+		}
+
+		BlockChainSyncHandlers CreateBlockChainSyncHandlers(
+				extensions::ServiceState& state,
+				thread::IoThreadPool& validatorPool,
+				RollbackInfo& rollbackInfo,
+				utils::DiagnosticHistogram& commitHistogram) {
 			const auto& blockChainConfig = state.config().BlockChain;
 			const auto& pluginManager = state.pluginManager();
 
@@ -187,7 +213,8 @@ namespace catapult { namespace sync {
 				auto resolverContext = pluginManager.createResolverContext(readOnlyCache);
 				UndoBlock(blockElement, { *pUndoObserver, resolverContext, observerState }, undoBlockType);
 			};
-			syncHandlers.Processor = CreateSyncProcessor(blockChainConfig, extensions::CreateExecutionConfiguration(pluginManager));
+			auto executionConfig = extensions::CreateExecutionConfiguration(pluginManager);
+			syncHandlers.Processor = CreateSyncProcessor(blockChainConfig, executionConfig, validatorPool);
 
 			syncHandlers.StateChange = [&rollbackInfo, &localScore = state.score(), &subscriber = state.stateChangeSubscriber()](
 					const auto& changeInfo) {
@@ -203,11 +230,14 @@ namespace catapult { namespace sync {
 			auto dataDirectory = config::CatapultDataDirectory(state.config().User.DataDirectory);
 			syncHandlers.PreStateWritten = [](const auto&, auto) {};
 			syncHandlers.TransactionsChange = state.hooks().transactionsChangeHandler();
-			syncHandlers.CommitStep = extensions::CreateCommitStepHandler(dataDirectory);
+			syncHandlers.CommitStep = CreateTimedCommitStepHandler(extensions::CreateCommitStepHandler(dataDirectory), commitHistogram);
 
 			if (state.config().Node.EnableCacheDatabaseStorage)
 				AddSupplementalDataResiliency(syncHandlers, dataDirectory, state.cache(), state.score());
 
+			if (extensions::IsIncrementalStateCheckpointingEnabled(state.config().Node))
+				AddIncrementalStateCheckpointing(syncHandlers, dataDirectory, state.config().Node, state.cache(), state.score());
+
 			return syncHandlers;
 		}
 
@@ -219,16 +249,21 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
+			void addHashConsumers(thread::IoThreadPool& validatorPool) {
 				m_consumers.push_back(CreateBlockHashCalculatorConsumer(
 						m_state.config().BlockChain.Network.GenerationHashSeed,
-						m_state.pluginManager().transactionRegistry()));
+						m_state.pluginManager().transactionRegistry(),
+						validatorPool,
+						m_nodeConfig.MinHashCalculationBatchSize));
 				m_consumers.push_back(CreateBlockHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheBlockDuration, m_nodeConfig)));
 			}
 
-			std::shared_ptr<ConsumerDispatcher> build(thread::IoThreadPool& validatorPool, RollbackInfo& rollbackInfo) {
+			std::shared_ptr<ConsumerDispatcher> build(
+					thread::IoThreadPool& validatorPool,
+					RollbackInfo& rollbackInfo,
+					utils::DiagnosticHistogram& commitHistogram) {
 				const auto& utCache = const_cast<const extensions::ServiceState&>(m_state).utCache();
 				auto requiresValidationPredicate = ToRequiresValidationPredicate(m_state.hooks().knownHashPredicate(utCache));
 				m_consumers.push_back(CreateBlockChainCheckConsumer(
@@ -249,7 +284,7 @@ namespace catapult { namespace sync {
 						m_state.config().BlockChain.ImportanceGrouping,
 						m_state.cache(),
 						m_state.storage(),
-						CreateBlockChainSyncHandlers(m_state, rollbackInfo)));
+						CreateBlockChainSyncHandlers(m_state, validatorPool, rollbackInfo, commitHistogram)));
 
 				if (m_state.config().Node.EnableAutoSyncCleanup)
 					disruptorConsumers.push_back(CreateBlockChainSyncCleanupConsumer(m_state.config().User.DataDirectory));
@@ -307,11 +342,13 @@ namespace catapult { namespace sync {
 			{}
 
 		public:
-			void addHashConsumers() {
+			void addHashConsumers(thread::IoThreadPool& validatorPool) {
 				const auto& utCache = const_cast<const extensions::ServiceState&>(m_state).utCache();
 				m_consumers.push_back(CreateTransactionHashCalculatorConsumer(
 						m_state.config().BlockChain.Network.GenerationHashSeed,
-						m_state.pluginManager().transactionRegistry()));
+						m_state.pluginManager().transactionRegistry(),
+						validatorPool,
+						m_nodeConfig.MinHashCalculationBatchSize));
 				m_consumers.push_back(CreateTransactionHashCheckConsumer(
 						m_state.timeSupplier(),
 						extensions::CreateHashCheckOptions(m_nodeConfig.ShortLivedCacheTransactionDuration, m_nodeConfig),
@@ -446,6 +483,13 @@ namespace catapult { namespace sync {
 				AddRollbackCounter(locator, "RB COMMIT RCT", RollbackResult::Committed, RollbackCounterType::Recent);
 				AddRollbackCounter(locator, "RB IGNORE ALL", RollbackResult::Ignored, RollbackCounterType::All);
 				AddRollbackCounter(locator, "RB IGNORE RCT", RollbackResult::Ignored, RollbackCounterType::Recent);
+
+				locator.registerServiceHistogram<chain::UtUpdater>("dispatcher.utUpdater", "UT UPDATE", [](const auto& utUpdater) {
+					return utUpdater.updateHistogram().values();
+				});
+				locator.registerServiceHistogram<utils::DiagnosticHistogram>("dispatcher.commit", "BLK COMMIT", [](const auto& histogram) {
+					return histogram.values();
+				});
 			}
 
 			void registerServices(extensions::ServiceLocator& locator, extensions::ServiceState& state) override {
@@ -458,13 +502,15 @@ namespace catapult { namespace sync {
 				auto pServiceGroup = state.pool().pushServiceGroup("dispatcher service");
 
 				BlockDispatcherBuilder blockDispatcherBuilder(state);
-				blockDispatcherBuilder.addHashConsumers();
+				blockDispatcherBuilder.addHashConsumers(*pValidatorPool);
 
 				TransactionDispatcherBuilder transactionDispatcherBuilder(state);
-				transactionDispatcherBuilder.addHashConsumers();
+				transactionDispatcherBuilder.addHashConsumers(*pValidatorPool);
 
 				auto pRollbackInfo = CreateAndRegisterRollbackService(locator, state.timeSupplier(), state.config().BlockChain);
-				auto pBlockDispatcher = blockDispatcherBuilder.build(*pValidatorPool, *pRollbackInfo);
+				auto pCommitHistogram = std::make_shared<utils::DiagnosticHistogram>();
+				locator.registerRootedService("dispatcher.commit", pCommitHistogram);
+				auto pBlockDispatcher = blockDispatcherBuilder.build(*pValidatorPool, *pRollbackInfo, *pCommitHistogram);
 				RegisterBlockDispatcherService(pBlockDispatcher, *pServiceGroup, locator, state);
 
 				auto pTransactionDispatcher = transactionDispatcherBuilder.build(*pValidatorPool, utUpdater);
@@ -54,4 +54,21 @@ namespace catapult { namespace sync {
 			commitStepHandler(step);
 		};
 	}
+
+	void AddIncrementalStateCheckpointing(
+			consumers::BlockChainSyncHandlers& syncHandlers,
+			const config::CatapultDataDirectory& dataDirectory,
+			const config::NodeConfiguration& nodeConfig,
+			const cache::CatapultCache& cache,
+			const extensions::LocalNodeChainScore& score) {
+		// state change journal is appended when state changes are indicated, so it is complete once all changes are committed
+		// (cache lock is released by then, so a checkpoint can be saved from a cache view)
+		auto commitStepHandler = syncHandlers.CommitStep;
+		syncHandlers.CommitStep = [commitStepHandler, dataDirectory, &nodeConfig, &cache, &score](auto step) {
+			commitStepHandler(step);
+
+			if (consumers::CommitOperationStep::All_Updated == step)
+				extensions::TrySaveStateToDirectoryWithIncrementalCheckpointing(dataDirectory, nodeConfig, cache, score.get());
+		};
+	}
 }}
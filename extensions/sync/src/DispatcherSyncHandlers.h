@@ -23,7 +23,10 @@
 #include "catapult/consumers/BlockChainSyncHandlers.h"
 
 namespace catapult {
-	namespace config { class CatapultDataDirectory; }
+	namespace config {
+		class CatapultDataDirectory;
+		struct NodeConfiguration;
+	}
 	namespace extensions { class LocalNodeChainScore; }
 }
 
@@ -35,4 +38,13 @@ namespace catapult { namespace sync {
 			const config::CatapultDataDirectory& dataDirectory,
 			const cache::CatapultCache& cache,
 			const extensions::LocalNodeChainScore& score);
+
+	/// Updates \a syncHandlers to save incremental state checkpoints while running given \a dataDirectory, \a nodeConfig, \a cache
+	/// and \a score.
+	void AddIncrementalStateCheckpointing(
+			consumers::BlockChainSyncHandlers& syncHandlers,
+			const config::CatapultDataDirectory& dataDirectory,
+			const config::NodeConfiguration& nodeConfig,
+			const cache::CatapultCache& cache,
+			const extensions::LocalNodeChainScore& score);
 }}
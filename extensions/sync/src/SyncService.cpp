@@ -52,9 +52,34 @@ namespace catapult { namespace sync {
 			chainSynchronizerConfig.MaxBlocksPerSyncAttempt = config.Node.MaxBlocksPerSyncAttempt;
 			chainSynchronizerConfig.MaxChainBytesPerSyncAttempt = config.Node.MaxChainBytesPerSyncAttempt.bytes32();
 			chainSynchronizerConfig.MaxRollbackBlocks = config.BlockChain.MaxRollbackBlocks;
+			chainSynchronizerConfig.MaxParallelSyncPeers = config.Node.MaxParallelSyncPeers;
 			return chainSynchronizerConfig;
 		}
 
+		chain::RemoteChainApisSupplier CreateRemoteChainApisSupplier(
+				const extensions::ServiceState& state,
+				net::PacketIoPicker& packetIoPicker) {
+			const auto& transactionRegistry = state.pluginManager().transactionRegistry();
+			auto syncTimeout = state.config().Node.SyncTimeout;
+			return [&packetIoPicker, &transactionRegistry, syncTimeout](auto maxRemoteChainApis) {
+				std::vector<std::shared_ptr<const api::RemoteChainApi>> remoteChainApis;
+				while (remoteChainApis.size() < maxRemoteChainApis) {
+					auto packetIoPair = packetIoPicker.pickOne(syncTimeout);
+					if (!packetIoPair)
+						break;
+
+					// extend the lifetime of packetIoPair until the api is destroyed
+					const auto& remoteIdentity = packetIoPair.node().identity();
+					auto pRemoteChainApi = api::CreateRemoteChainApi(*packetIoPair.io(), remoteIdentity, transactionRegistry);
+					remoteChainApis.emplace_back(pRemoteChainApi.release(), [packetIoPair](const auto* pApi) {
+						delete pApi;
+					});
+				}
+
+				return remoteChainApis;
+			};
+		}
+
 		thread::Task CreateSynchronizerTask(const extensions::ServiceState& state, net::PacketWriters& packetWriters) {
 			const auto& config = state.config();
 			auto chainSynchronizer = chain::CreateChainSynchronizer(
@@ -64,6 +89,7 @@ namespace catapult { namespace sync {
 							extensions::CreateLocalFinalizedHeightSupplier(state)),
 					CreateChainSynchronizerConfiguration(config),
 					extensions::CreateLocalFinalizedHeightSupplier(state),
+					CreateRemoteChainApisSupplier(state, packetWriters),
 					state.hooks().completionAwareBlockRangeConsumerFactory()(Sync_Source));
 
 			thread::Task task;
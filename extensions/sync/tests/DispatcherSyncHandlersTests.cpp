@@ -22,7 +22,9 @@
 #include "sync/src/DispatcherSyncHandlers.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/config/NodeConfiguration.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
+#include "catapult/io/RawFile.h"
 #include "tests/test/nodeps/Filesystem.h"
 #include "tests/TestHarness.h"
 #include <filesystem>
@@ -142,4 +144,96 @@ namespace catapult { namespace sync {
 	}
 
 	// endregion
+
+	// region AddIncrementalStateCheckpointing
+
+	namespace {
+		class AddIncrementalStateCheckpointingTestContext {
+		public:
+			explicit AddIncrementalStateCheckpointingTestContext(size_t journalSize)
+					: m_dataDirectory(m_tempDir.name())
+					, m_nodeConfig(config::NodeConfiguration::Uninitialized())
+					, m_cache({})
+					, m_numCommitStepCalls(0) {
+				m_nodeConfig.EnableIncrementalStateCheckpoints = true;
+				m_nodeConfig.EnableCacheDatabaseStorage = false;
+				m_nodeConfig.StateChangeJournalCheckpointSize = utils::FileSize::FromKilobytes(1);
+
+				io::RawFile journalFile(journalFilename(), io::OpenMode::Read_Write);
+				journalFile.write(std::vector<uint8_t>(journalSize));
+
+				m_syncHandlers.CommitStep = [&numCommitStepCalls = m_numCommitStepCalls](auto) {
+					++numCommitStepCalls;
+				};
+
+				AddIncrementalStateCheckpointing(m_syncHandlers, m_dataDirectory, m_nodeConfig, m_cache, m_score);
+			}
+
+		public:
+			size_t numCommitStepCalls() const {
+				return m_numCommitStepCalls;
+			}
+
+			const auto& syncHandlers() const {
+				return m_syncHandlers;
+			}
+
+			std::string journalFilename() const {
+				return m_dataDirectory.rootDir().file("state_changes.dat");
+			}
+
+			std::string supplementalPath() const {
+				return m_dataDirectory.dir("state").file("supplemental.dat");
+			}
+
+		private:
+			test::TempDirectoryGuard m_tempDir;
+			config::CatapultDataDirectory m_dataDirectory;
+			config::NodeConfiguration m_nodeConfig;
+			cache::CatapultCache m_cache;
+			extensions::LocalNodeChainScore m_score;
+			size_t m_numCommitStepCalls;
+			consumers::BlockChainSyncHandlers m_syncHandlers;
+		};
+
+		void AssertAddIncrementalStateCheckpointingCommitStepDoesNothing(consumers::CommitOperationStep step, size_t journalSize) {
+			// Arrange:
+			AddIncrementalStateCheckpointingTestContext context(journalSize);
+
+			// Act:
+			context.syncHandlers().CommitStep(step);
+
+			// Assert:
+			EXPECT_EQ(1u, context.numCommitStepCalls());
+			EXPECT_TRUE(std::filesystem::exists(context.journalFilename()));
+			EXPECT_FALSE(std::filesystem::exists(context.supplementalPath()));
+		}
+	}
+
+	TEST(TEST_CLASS, AddIncrementalStateCheckpointing_CommitStepDoesNothingWhenOperationIsBlocksWritten) {
+		AssertAddIncrementalStateCheckpointingCommitStepDoesNothing(consumers::CommitOperationStep::Blocks_Written, 2048);
+	}
+
+	TEST(TEST_CLASS, AddIncrementalStateCheckpointing_CommitStepDoesNothingWhenOperationIsStateWritten) {
+		AssertAddIncrementalStateCheckpointingCommitStepDoesNothing(consumers::CommitOperationStep::State_Written, 2048);
+	}
+
+	TEST(TEST_CLASS, AddIncrementalStateCheckpointing_CommitStepDoesNothingWhenJournalIsSmallerThanCheckpointSize) {
+		AssertAddIncrementalStateCheckpointingCommitStepDoesNothing(consumers::CommitOperationStep::All_Updated, 1023);
+	}
+
+	TEST(TEST_CLASS, AddIncrementalStateCheckpointing_CommitStepSavesStateWhenJournalReachesCheckpointSize) {
+		// Arrange:
+		AddIncrementalStateCheckpointingTestContext context(1024);
+
+		// Act:
+		context.syncHandlers().CommitStep(consumers::CommitOperationStep::All_Updated);
+
+		// Assert: first checkpoint is a full snapshot, which discards the journal
+		EXPECT_EQ(1u, context.numCommitStepCalls());
+		EXPECT_FALSE(std::filesystem::exists(context.journalFilename()));
+		EXPECT_TRUE(std::filesystem::exists(context.supplementalPath()));
+	}
+
+	// endregion
 }}
@@ -47,6 +47,10 @@ namespace catapult { namespace zeromq {
 				m_publisher.publishDropBlocks(height);
 			}
 
+			void flush() override {
+				// empty because changes are published in notifyBlock and notifyDropBlocksAfter
+			}
+
 		private:
 			ZeroMqEntityPublisher& m_publisher;
 		};
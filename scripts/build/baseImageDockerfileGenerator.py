@@ -218,7 +218,8 @@ class UbuntuSystem:
             'pkg-config',
             'python3',
             'python3-ply',
-            'xz-utils'
+            'xz-utils',
+            'zlib1g-dev'
         ]
         print_line_with_continuation([
             'RUN apt-get -y update',
@@ -253,7 +254,8 @@ class FedoraSystem:
             'make',
             'ninja-build',
             'python3',
-            'xz'
+            'xz',
+            'zlib-devel'
         ]
         print_line_with_continuation([
             'RUN dnf update --assumeyes',
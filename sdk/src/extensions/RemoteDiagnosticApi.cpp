@@ -65,6 +65,23 @@ namespace catapult { namespace extensions {
 			}
 		};
 
+		struct DiagnosticHistogramsTraits {
+		public:
+			using ResultType = model::EntityRange<model::DiagnosticHistogramValue>;
+			static constexpr auto Packet_Type = ionet::PacketType::Diagnostic_Histograms;
+			static constexpr auto Friendly_Name = "diagnostic histograms";
+
+			static auto CreateRequestPacketPayload() {
+				return ionet::PacketPayload(Packet_Type);
+			}
+
+		public:
+			bool tryParseResult(const ionet::Packet& packet, ResultType& result) const {
+				result = ionet::ExtractFixedSizeStructuresFromPacket<model::DiagnosticHistogramValue>(packet);
+				return !result.empty();
+			}
+		};
+
 		struct ActiveNodeInfosTraits {
 		public:
 			using ResultType = model::EntityRange<ionet::PackedNodeInfo>;
@@ -159,6 +176,10 @@ namespace catapult { namespace extensions {
 				return m_impl.dispatch(DiagnosticCountersTraits());
 			}
 
+			FutureType<DiagnosticHistogramsTraits> diagnosticHistograms() const override {
+				return m_impl.dispatch(DiagnosticHistogramsTraits());
+			}
+
 			FutureType<ActiveNodeInfosTraits> activeNodeInfos() const override {
 				return m_impl.dispatch(ActiveNodeInfosTraits());
 			}
@@ -25,6 +25,7 @@
 #include "catapult/ionet/PackedNodeInfo.h"
 #include "catapult/model/CacheEntryInfo.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DiagnosticHistogramValue.h"
 #include "catapult/model/RangeTypes.h"
 #include "catapult/state/TimestampedHash.h"
 #include "catapult/thread/Future.h"
@@ -49,6 +50,9 @@ namespace catapult { namespace extensions {
 		/// Gets the current diagnostic counter values.
 		virtual future<model::EntityRange<model::DiagnosticCounterValue>> diagnosticCounters() const = 0;
 
+		/// Gets the current diagnostic histogram values.
+		virtual future<model::EntityRange<model::DiagnosticHistogramValue>> diagnosticHistograms() const = 0;
+
 		/// Gets the node infos for all active nodes
 		virtual future<model::EntityRange<ionet::PackedNodeInfo>> activeNodeInfos() const = 0;
 
@@ -132,6 +132,61 @@ namespace catapult { namespace extensions {
 
 		// endregion
 
+		// region DiagnosticHistogramsTraits
+
+		struct DiagnosticHistogramsTraits {
+			static constexpr auto Packet_Type = ionet::PacketType::Diagnostic_Histograms;
+
+			static auto Invoke(const RemoteDiagnosticApi& api) {
+				return api.diagnosticHistograms();
+			}
+
+			static auto CreateValidResponsePacket() {
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(2 * sizeof(model::DiagnosticHistogramValue));
+				pResponsePacket->Type = Packet_Type;
+
+				auto* pHistograms = reinterpret_cast<model::DiagnosticHistogramValue*>(pResponsePacket->Data());
+				pHistograms[0] = { 123u, 100u, 7u, 9u, 11u, 12u };
+				pHistograms[1] = { 777u, 200u, 15u, 20u, 25u, 30u };
+				return pResponsePacket;
+			}
+
+			static auto CreateMalformedResponsePacket() {
+				// just change the size because no responses are intrinsically invalid
+				auto pResponsePacket = CreateValidResponsePacket();
+				--pResponsePacket->Size;
+				return pResponsePacket;
+			}
+
+			static void ValidateRequest(const ionet::Packet& packet) {
+				EXPECT_TRUE(ionet::IsPacketValid(packet, Packet_Type));
+			}
+
+			static void ValidateResponse(
+					const ionet::Packet&,
+					const model::EntityRange<model::DiagnosticHistogramValue>& histogramValues) {
+				ASSERT_EQ(2u, histogramValues.size());
+
+				auto iter = histogramValues.cbegin();
+				EXPECT_EQ(123u, iter->Id);
+				EXPECT_EQ(100u, iter->Count);
+				EXPECT_EQ(7u, iter->P50);
+				EXPECT_EQ(9u, iter->P90);
+				EXPECT_EQ(11u, iter->P99);
+				EXPECT_EQ(12u, iter->Max);
+
+				++iter;
+				EXPECT_EQ(777u, iter->Id);
+				EXPECT_EQ(200u, iter->Count);
+				EXPECT_EQ(15u, iter->P50);
+				EXPECT_EQ(20u, iter->P90);
+				EXPECT_EQ(25u, iter->P99);
+				EXPECT_EQ(30u, iter->Max);
+			}
+		};
+
+		// endregion
+
 		// region ActiveNodeInfosTraits
 
 		struct ActiveNodeInfosTraits {
@@ -434,6 +489,7 @@ namespace catapult { namespace extensions {
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_VALID(RemoteDiagnosticApi, DiagnosticConfirmTimestampedHashes)
 
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, DiagnosticCounters)
+	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, DiagnosticHistograms)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, ActiveNodeInfos)
 	DEFINE_REMOTE_API_TESTS_EMPTY_RESPONSE_INVALID(RemoteDiagnosticApi, UnlockedAccounts)
 
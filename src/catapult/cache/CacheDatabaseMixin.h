@@ -76,9 +76,14 @@ namespace catapult { namespace cache {
 				const CacheConfiguration& config,
 				const std::vector<std::string>& columnFamilyNames) {
 			auto adjustedColumnFamilyNames = columnFamilyNames;
-			if (config.ShouldStorePatriciaTrees)
+			if (config.ShouldStorePatriciaTrees) {
 				adjustedColumnFamilyNames.push_back("patricia_tree");
 
+				// stale nodes column must immediately follow patricia tree column
+				if (0 != config.CacheDatabaseConfig.PatriciaTreeRetainedRoots)
+					adjustedColumnFamilyNames.push_back("patricia_tree_stale");
+			}
+
 			return adjustedColumnFamilyNames;
 		}
 
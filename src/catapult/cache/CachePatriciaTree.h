@@ -64,7 +64,8 @@ namespace catapult { namespace cache {
 		public:
 			Impl(CacheDatabase& database, size_t columnId)
 					: m_container(database, columnId)
-					, m_dataSource(m_container)
+					, m_pPruner(CreatePruner(m_container, database, columnId))
+					, m_dataSource(m_container, m_pPruner.get())
 					, m_pTree(std::make_unique<TTree>(m_dataSource)) {
 				Hash256 rootHash;
 				if (!m_container.prop("root", rootHash))
@@ -87,8 +88,12 @@ namespace catapult { namespace cache {
 
 		public:
 			void commit() {
+				auto previousRoot = m_pTree->root();
 				m_pTree->commit();
 
+				if (m_pPruner)
+					m_pPruner->commit(previousRoot, m_pTree->root());
+
 				// skip setProp if hash did not change
 				Hash256 rootHash;
 				if (m_container.prop("root", rootHash) && rootHash == m_pTree->root())
@@ -97,8 +102,23 @@ namespace catapult { namespace cache {
 				m_container.setProp("root", m_pTree->root());
 			}
 
+		private:
+			static std::unique_ptr<PatriciaTreeRdbPruner> CreatePruner(
+					PatriciaTreeContainer& container,
+					CacheDatabase& database,
+					size_t columnId) {
+				const auto& columnFamilyNames = database.columnFamilyNames();
+				auto staleNodesColumnId = columnId + 1;
+				if (staleNodesColumnId >= columnFamilyNames.size() || "patricia_tree_stale" != columnFamilyNames[staleNodesColumnId])
+					return nullptr;
+
+				auto numRetainedRoots = database.databaseConfig().PatriciaTreeRetainedRoots;
+				return std::make_unique<PatriciaTreeRdbPruner>(container, database, staleNodesColumnId, numRetainedRoots);
+			}
+
 		private:
 			PatriciaTreeContainer m_container;
+			std::unique_ptr<PatriciaTreeRdbPruner> m_pPruner;
 			PatriciaTreeRdbDataSource m_dataSource;
 			std::unique_ptr<TTree> m_pTree;
 		};
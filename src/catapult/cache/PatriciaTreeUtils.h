@@ -23,6 +23,8 @@
 #include "catapult/deltaset/DeltaElements.h"
 #include "catapult/tree/PatriciaTree.h"
 #include "catapult/exceptions.h"
+#include <functional>
+#include <vector>
 
 namespace catapult { namespace cache {
 
@@ -76,14 +78,21 @@ namespace catapult { namespace cache {
 			return minGenerationId <= generationId && generationId <= maxGenerationId;
 		};
 
-		auto handleModification = [&tree, height](const auto& pair) {
+		auto deltas = set.deltas();
+		using DeltaPair = typename std::remove_reference_t<decltype(deltas.Added)>::value_type;
+		using KeyValueRefPair = std::pair<
+				std::remove_const_t<typename DeltaPair::first_type>,
+				std::reference_wrapper<const typename DeltaPair::second_type>>;
+
+		// collect all values to set so that each affected tree branch is only updated once
+		std::vector<KeyValueRefPair> setPairs;
+		auto handleModification = [&tree, height, &setPairs](const auto& pair) {
 			if (detail::IsActiveAdapter::IsActive(pair.second, height))
-				tree.set(pair.first, pair.second);
+				setPairs.emplace_back(pair.first, std::cref(pair.second));
 			else
 				tree.unset(pair.first);
 		};
 
-		auto deltas = set.deltas();
 		for (const auto& pair : deltas.Added) {
 			if (needsApplication(pair.first)) {
 				// a value can be added and deactivated during the processing of a single chain part
@@ -96,6 +105,8 @@ namespace catapult { namespace cache {
 				handleModification(pair);
 		}
 
+		tree.setBatch(setPairs);
+
 		for (const auto& pair : deltas.Removed) {
 			if (needsApplication(pair.first))
 				tree.unset(pair.first);
@@ -100,6 +100,10 @@ namespace catapult { namespace cache {
 		return PrepareMutableIterator(AccountStateCacheDeltaMixins::MutableAccessorKey(*m_pKeyLookupAdapter).find(key), m_options);
 	}
 
+	void BasicAccountStateCacheDelta::prefetch(const std::vector<Address>& addresses) {
+		m_pStateByAddress->prefetch(addresses);
+	}
+
 	void BasicAccountStateCacheDelta::addAccount(const Address& address, Height height) {
 		if (contains(address))
 			return;
@@ -121,6 +121,10 @@ namespace catapult { namespace cache {
 		/// Finds the cache value identified by \a key.
 		AccountStateCacheDeltaMixins::MutableAccessorKey::iterator find(const Key& key);
 
+		/// Loads all accounts identified by \a addresses into memory with a single batched lookup.
+		/// \note This only has an effect when the cache is backed by a cache database.
+		void prefetch(const std::vector<Address>& addresses);
+
 	public:
 		/// If not present, adds an account to the cache with the specified \a address at \a height.
 		void addAccount(const Address& address, Height height);
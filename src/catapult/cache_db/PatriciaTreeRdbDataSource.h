@@ -21,6 +21,7 @@
 
 #pragma once
 #include "PatriciaTreeContainer.h"
+#include "PatriciaTreeRdbPruner.h"
 #include "catapult/types.h"
 
 namespace catapult { namespace cache {
@@ -29,7 +30,13 @@ namespace catapult { namespace cache {
 	class PatriciaTreeRdbDataSource {
 	public:
 		/// Creates data source around \a container.
-		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container) : m_container(container)
+		explicit PatriciaTreeRdbDataSource(PatriciaTreeContainer& container) : PatriciaTreeRdbDataSource(container, nullptr)
+		{}
+
+		/// Creates data source around \a container that notifies \a pPruner (optional) about all saved nodes.
+		PatriciaTreeRdbDataSource(PatriciaTreeContainer& container, PatriciaTreeRdbPruner* pPruner)
+				: m_container(container)
+				, m_pPruner(pPruner)
 		{}
 
 	public:
@@ -62,9 +69,12 @@ namespace catapult { namespace cache {
 	private:
 		void set(const tree::TreeNode& node) {
 			m_container.insert(std::make_pair(node.hash(), node.copy()));
+			if (m_pPruner)
+				m_pPruner->notifySaved(node);
 		}
 
 	private:
 		PatriciaTreeContainer& m_container;
+		PatriciaTreeRdbPruner* m_pPruner;
 	};
 }}
@@ -0,0 +1,242 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PatriciaTreeRdbPruner.h"
+#include "catapult/io/BufferInputStreamAdapter.h"
+#include "catapult/io/PodIoUtils.h"
+#include "catapult/io/StringOutputStream.h"
+
+namespace catapult { namespace cache {
+
+	// region PatriciaTreeStaleNodesSerializer
+
+	std::string PatriciaTreeStaleNodesSerializer::SerializeValue(const PatriciaTreeStaleNodes& value) {
+		// generation - uint64, count - uint32, node hashes - hashes
+		io::StringOutputStream out(sizeof(uint64_t) + sizeof(uint32_t) + value.NodeHashes.size() * Hash256::Size);
+		io::Write64(out, value.Generation);
+		io::Write32(out, static_cast<uint32_t>(value.NodeHashes.size()));
+		for (const auto& nodeHash : value.NodeHashes)
+			out.write(nodeHash);
+
+		return out.str();
+	}
+
+	PatriciaTreeStaleNodes PatriciaTreeStaleNodesSerializer::DeserializeValue(const RawBuffer& buffer) {
+		io::BufferInputStreamAdapter<RawBuffer> input(buffer);
+
+		PatriciaTreeStaleNodes staleNodes;
+		staleNodes.Generation = io::Read64(input);
+		staleNodes.NodeHashes.resize(io::Read32(input));
+		for (auto& nodeHash : staleNodes.NodeHashes)
+			input.read(nodeHash);
+
+		return staleNodes;
+	}
+
+	// endregion
+
+	// region PatriciaTreeRdbPruner
+
+	PatriciaTreeRdbPruner::PatriciaTreeRdbPruner(
+			PatriciaTreeContainer& container,
+			RocksDatabase& database,
+			size_t staleNodesColumnId,
+			uint32_t numRetainedRoots)
+			: m_container(container)
+			, m_staleNodesContainer(database, staleNodesColumnId)
+			, m_numRetainedRoots(numRetainedRoots)
+			, m_generation(0)
+			, m_prunedGeneration(0) {
+		if (0 == m_numRetainedRoots)
+			CATAPULT_THROW_INVALID_ARGUMENT("at least one previous root must be retained");
+
+		m_staleNodesContainer.prop("gen", m_generation);
+		m_staleNodesContainer.prop("pruned", m_prunedGeneration);
+
+		// reload all stale nodes that have not yet been pruned
+		for (auto generation = m_prunedGeneration + 1; generation <= m_generation; ++generation) {
+			auto iter = m_staleNodesContainer.find(generation);
+			if (m_staleNodesContainer.cend() == iter)
+				continue;
+
+			for (const auto& nodeHash : iter->NodeHashes)
+				m_staleNodeGenerations[nodeHash] = generation;
+		}
+	}
+
+	uint64_t PatriciaTreeRdbPruner::generation() const {
+		return m_generation;
+	}
+
+	size_t PatriciaTreeRdbPruner::numStaleNodes() const {
+		return m_staleNodeGenerations.size();
+	}
+
+	void PatriciaTreeRdbPruner::notifySaved(const tree::TreeNode& node) {
+		auto& links = m_savedNodeLinks[node.hash()];
+		if (!node.isBranch())
+			return;
+
+		const auto& branchNode = node.asBranchNode();
+		for (auto i = 0u; i < tree::BranchTreeNode::Max_Links; ++i) {
+			if (branchNode.hasLink(i))
+				links.push_back(branchNode.link(i));
+		}
+	}
+
+	size_t PatriciaTreeRdbPruner::commit(const Hash256& previousRoot, const Hash256& root) {
+		if (previousRoot == root && m_savedNodeLinks.empty())
+			return 0;
+
+		auto reachableNodeHashes = findReachableNodes(root);
+		reviveNodes(reachableNodeHashes);
+
+		auto staleNodeHashes = findStaleNodes(previousRoot, reachableNodeHashes);
+		m_savedNodeLinks.clear();
+
+		++m_generation;
+		if (!staleNodeHashes.empty()) {
+			for (const auto& nodeHash : staleNodeHashes)
+				m_staleNodeGenerations[nodeHash] = m_generation;
+
+			m_staleNodesContainer.insert({ m_generation, std::move(staleNodeHashes) });
+		}
+
+		auto numPrunedNodes = pruneStaleNodes();
+		m_staleNodesContainer.setProp("gen", m_generation);
+		m_staleNodesContainer.setProp("pruned", m_prunedGeneration);
+		return numPrunedNodes;
+	}
+
+	utils::ArraySet<Hash256> PatriciaTreeRdbPruner::findReachableNodes(const Hash256& root) const {
+		// saved nodes are not yet readable from the database, so only descend through them
+		// (any other reachable node is the root of a subtree that is unchanged from the previous tree)
+		utils::ArraySet<Hash256> reachableNodeHashes;
+		std::vector<Hash256> pendingNodeHashes{ root };
+		while (!pendingNodeHashes.empty()) {
+			auto nodeHash = pendingNodeHashes.back();
+			pendingNodeHashes.pop_back();
+			if (Hash256() == nodeHash || !reachableNodeHashes.insert(nodeHash).second)
+				continue;
+
+			auto iter = m_savedNodeLinks.find(nodeHash);
+			if (m_savedNodeLinks.cend() != iter)
+				pendingNodeHashes.insert(pendingNodeHashes.end(), iter->second.cbegin(), iter->second.cend());
+		}
+
+		return reachableNodeHashes;
+	}
+
+	void PatriciaTreeRdbPruner::reviveNodes(const utils::ArraySet<Hash256>& reachableNodeHashes) {
+		// unchanged subtrees were reachable from the previous root, so only saved nodes can be revived
+		std::set<uint64_t> changedGenerations;
+		for (const auto& pair : m_savedNodeLinks) {
+			if (reachableNodeHashes.cend() == reachableNodeHashes.find(pair.first))
+				continue;
+
+			auto iter = m_staleNodeGenerations.find(pair.first);
+			if (m_staleNodeGenerations.end() == iter)
+				continue;
+
+			changedGenerations.insert(iter->second);
+			m_staleNodeGenerations.erase(iter);
+		}
+
+		for (auto generation : changedGenerations) {
+			auto iter = m_staleNodesContainer.find(generation);
+			if (m_staleNodesContainer.cend() == iter)
+				continue;
+
+			PatriciaTreeStaleNodes staleNodes{ generation, {} };
+			for (const auto& nodeHash : iter->NodeHashes) {
+				auto generationIter = m_staleNodeGenerations.find(nodeHash);
+				if (m_staleNodeGenerations.end() != generationIter && generation == generationIter->second)
+					staleNodes.NodeHashes.push_back(nodeHash);
+			}
+
+			m_staleNodesContainer.insert(staleNodes);
+		}
+	}
+
+	std::vector<Hash256> PatriciaTreeRdbPruner::findStaleNodes(
+			const Hash256& previousRoot,
+			const utils::ArraySet<Hash256>& reachableNodeHashes) const {
+		// saved nodes that are not reachable were replaced before commit (e.g. by a later checkpoint)
+		utils::ArraySet<Hash256> staleNodeHashes;
+		for (const auto& pair : m_savedNodeLinks) {
+			if (reachableNodeHashes.cend() == reachableNodeHashes.find(pair.first))
+				staleNodeHashes.insert(pair.first);
+		}
+
+		// walk the previous tree but stop at any reachable node because its subtree is shared with the new tree
+		std::vector<Hash256> pendingNodeHashes{ previousRoot };
+		while (!pendingNodeHashes.empty()) {
+			auto nodeHash = pendingNodeHashes.back();
+			pendingNodeHashes.pop_back();
+			if (Hash256() == nodeHash || reachableNodeHashes.cend() != reachableNodeHashes.find(nodeHash))
+				continue;
+
+			staleNodeHashes.insert(nodeHash);
+			auto iter = m_container.find(nodeHash);
+			if (m_container.cend() == iter || !iter->second.isBranch())
+				continue;
+
+			const auto& branchNode = iter->second.asBranchNode();
+			for (auto i = 0u; i < tree::BranchTreeNode::Max_Links; ++i) {
+				if (branchNode.hasLink(i))
+					pendingNodeHashes.push_back(branchNode.link(i));
+			}
+		}
+
+		return std::vector<Hash256>(staleNodeHashes.cbegin(), staleNodeHashes.cend());
+	}
+
+	size_t PatriciaTreeRdbPruner::pruneStaleNodes() {
+		size_t numPrunedNodes = 0;
+		auto previousPrunedGeneration = m_prunedGeneration;
+		while (m_prunedGeneration + m_numRetainedRoots < m_generation) {
+			++m_prunedGeneration;
+
+			auto iter = m_staleNodesContainer.find(m_prunedGeneration);
+			if (m_staleNodesContainer.cend() == iter)
+				continue;
+
+			for (const auto& nodeHash : iter->NodeHashes) {
+				// skip nodes that were revived (and possibly became stale again) after being indexed
+				auto generationIter = m_staleNodeGenerations.find(nodeHash);
+				if (m_staleNodeGenerations.end() == generationIter || m_prunedGeneration != generationIter->second)
+					continue;
+
+				m_staleNodeGenerations.erase(generationIter);
+				m_container.remove(nodeHash);
+				++numPrunedNodes;
+			}
+		}
+
+		// index entries of pruned generations are removed by the compaction filter once per retained roots window
+		if (previousPrunedGeneration / m_numRetainedRoots != m_prunedGeneration / m_numRetainedRoots)
+			m_staleNodesContainer.prune(m_prunedGeneration + 1);
+
+		return numPrunedNodes;
+	}
+
+	// endregion
+}}
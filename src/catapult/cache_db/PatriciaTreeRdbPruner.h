@@ -0,0 +1,138 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PatriciaTreeContainer.h"
+#include "catapult/utils/ArraySet.h"
+
+namespace catapult { namespace cache {
+
+	// region PatriciaTreeStaleNodesContainer
+
+	/// Patricia tree nodes that became unreachable at the same generation.
+	struct PatriciaTreeStaleNodes {
+		/// Generation at which the nodes became unreachable.
+		uint64_t Generation;
+
+		/// Hashes of the unreachable nodes.
+		std::vector<Hash256> NodeHashes;
+	};
+
+	/// Serializer for stale patricia tree nodes.
+	struct PatriciaTreeStaleNodesSerializer {
+	public:
+		/// Serializes \a value to string.
+		static std::string SerializeValue(const PatriciaTreeStaleNodes& value);
+
+		/// Deserializes stale nodes from \a buffer.
+		static PatriciaTreeStaleNodes DeserializeValue(const RawBuffer& buffer);
+
+		/// Converts \a generation to pruning boundary.
+		static uint64_t KeyToBoundary(uint64_t generation) {
+			return generation;
+		}
+	};
+
+	/// Stale patricia tree nodes column descriptor.
+	struct PatriciaTreeStaleNodesColumnDescriptor {
+	public:
+		using KeyType = uint64_t;
+		using ValueType = PatriciaTreeStaleNodes;
+		using StorageType = PatriciaTreeStaleNodes;
+
+	public:
+		/// Converts a value type (\a staleNodes) to a storage type.
+		static auto ToStorage(const ValueType& staleNodes) {
+			return staleNodes;
+		}
+
+		/// Converts a storage type (\a element) to a key type.
+		static const auto& ToKey(const StorageType& element) {
+			return element.Generation;
+		}
+
+		/// Converts a storage type (\a element) to a value type.
+		static const auto& ToValue(const StorageType& element) {
+			return element;
+		}
+
+	public:
+		using Serializer = PatriciaTreeStaleNodesSerializer;
+	};
+
+	/// Stale patricia tree nodes typed container.
+	using PatriciaTreeStaleNodesContainer = RdbTypedColumnContainer<PatriciaTreeStaleNodesColumnDescriptor>;
+
+	// endregion
+
+	// region PatriciaTreeRdbPruner
+
+	/// Prunes patricia tree nodes that are not reachable from any retained root.
+	/// \note Every commit that saves nodes starts a new generation. Nodes that became unreachable are indexed by generation
+	///       and deleted once the generation is older than the number of retained roots.
+	class PatriciaTreeRdbPruner {
+	public:
+		/// Creates a pruner around \a container that indexes stale nodes in \a staleNodesColumnId of \a database
+		/// and retains all nodes reachable from the current root and \a numRetainedRoots previous roots.
+		PatriciaTreeRdbPruner(
+				PatriciaTreeContainer& container,
+				RocksDatabase& database,
+				size_t staleNodesColumnId,
+				uint32_t numRetainedRoots);
+
+	public:
+		/// Gets the current generation.
+		uint64_t generation() const;
+
+		/// Gets the number of stale nodes that have not yet been pruned.
+		size_t numStaleNodes() const;
+
+	public:
+		/// Notifies the pruner that \a node has been saved.
+		void notifySaved(const tree::TreeNode& node);
+
+		/// Notifies the pruner that all saved nodes have been committed and the root changed from \a previousRoot to \a root.
+		/// Returns the number of pruned nodes.
+		size_t commit(const Hash256& previousRoot, const Hash256& root);
+
+	private:
+		utils::ArraySet<Hash256> findReachableNodes(const Hash256& root) const;
+
+		void reviveNodes(const utils::ArraySet<Hash256>& reachableNodeHashes);
+
+		std::vector<Hash256> findStaleNodes(const Hash256& previousRoot, const utils::ArraySet<Hash256>& reachableNodeHashes) const;
+
+		size_t pruneStaleNodes();
+
+	private:
+		PatriciaTreeContainer& m_container;
+		PatriciaTreeStaleNodesContainer m_staleNodesContainer;
+		uint32_t m_numRetainedRoots;
+
+		uint64_t m_generation;
+		uint64_t m_prunedGeneration;
+		std::unordered_map<Hash256, uint64_t, utils::ArrayHasher<Hash256>> m_staleNodeGenerations;
+
+		std::unordered_map<Hash256, std::vector<Hash256>, utils::ArrayHasher<Hash256>> m_savedNodeLinks;
+	};
+
+	// endregion
+}}
@@ -127,6 +127,24 @@ namespace catapult { namespace cache {
 			return iter;
 		}
 
+		/// Finds all elements with \a keys in a single batched lookup.
+		/// Returns an iterator for each key, which is equal to cend() if the corresponding key has not been found.
+		std::vector<const_iterator> findAll(const std::vector<KeyType>& keys) const {
+			std::vector<RawBuffer> serializedKeys;
+			serializedKeys.reserve(keys.size());
+			for (const auto& key : keys)
+				serializedKeys.push_back(SerializeKey(key));
+
+			std::vector<RdbDataIterator> dbIterators;
+			TContainer::findAll(serializedKeys, dbIterators);
+
+			std::vector<const_iterator> iterators(dbIterators.size());
+			for (auto i = 0u; i < dbIterators.size(); ++i)
+				iterators[i].dbIterator() = std::move(dbIterators[i]);
+
+			return iterators;
+		}
+
 		/// Prunes elements with keys smaller than \a key. Returns number of pruned elements.
 		size_t prune(const KeyType& key) {
 			return TContainer::prune(TDescriptor::Serializer::KeyToBoundary(key));
@@ -129,18 +129,66 @@ namespace catapult { namespace cache {
 			return dbOptions;
 		}
 
+		using CacheDatabaseColumnConfiguration = config::NodeConfiguration::CacheDatabaseColumnSubConfiguration;
+
+		const CacheDatabaseColumnConfiguration& SelectColumnConfiguration(
+				const config::NodeConfiguration::CacheDatabaseSubConfiguration& config,
+				const std::string& columnFamilyName) {
+			if (rocksdb::kDefaultColumnFamilyName == columnFamilyName)
+				return config.PrimaryColumn;
+
+			if ("patricia_tree" == columnFamilyName)
+				return config.PatriciaTreeColumn;
+
+			return config.SecondaryColumn;
+		}
+
+		FilterPruningMode SelectColumnPruningMode(FilterPruningMode pruningMode, const std::string& columnFamilyName) {
+			// stale patricia tree nodes are indexed by generation, so that column is always prunable
+			return "patricia_tree_stale" == columnFamilyName ? FilterPruningMode::Enabled : pruningMode;
+		}
+
+		rocksdb::CompressionType ToRocksCompression(config::CacheDatabaseCompression compression) {
+			switch (compression) {
+			case config::CacheDatabaseCompression::Snappy:
+				return rocksdb::kSnappyCompression;
+			case config::CacheDatabaseCompression::Lz4:
+				return rocksdb::kLZ4Compression;
+			case config::CacheDatabaseCompression::Zstd:
+				return rocksdb::kZSTD;
+			default:
+				return rocksdb::kNoCompression;
+			}
+		}
+
 		rocksdb::ColumnFamilyOptions CreateColumnFamilyOptions(
 				const config::NodeConfiguration::CacheDatabaseSubConfiguration& config,
+				const CacheDatabaseColumnConfiguration& columnConfig,
+				const std::shared_ptr<rocksdb::Cache>& pBlockCache,
 				rocksdb::CompactionFilter* pCompactionFilter) {
 			rocksdb::ColumnFamilyOptions columnFamilyOptions;
 			columnFamilyOptions.compaction_filter = pCompactionFilter;
 
-			if (utils::FileSize() != config.BlockCacheSize)
-				columnFamilyOptions.OptimizeForPointLookup(config.BlockCacheSize.megabytes());
-
 			if (utils::FileSize() != config.MemtableMemoryBudget)
 				columnFamilyOptions.OptimizeLevelStyleCompaction(config.MemtableMemoryBudget.bytes());
 
+			// column settings are applied last so that they take precedence over the level style compaction defaults
+			if (utils::FileSize() != columnConfig.MemtableSize)
+				columnFamilyOptions.write_buffer_size = columnConfig.MemtableSize.bytes();
+
+			columnFamilyOptions.compression = ToRocksCompression(columnConfig.Compression);
+			columnFamilyOptions.compression_per_level.clear();
+
+			rocksdb::BlockBasedTableOptions tableOptions;
+			tableOptions.block_cache = pBlockCache;
+			if (columnConfig.BloomFilterBitsPerKey > 0) {
+				// full (not block based) filters allow point lookups to skip sst files that do not contain a key
+				tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(columnConfig.BloomFilterBitsPerKey, false));
+				columnFamilyOptions.memtable_whole_key_filtering = true;
+				columnFamilyOptions.memtable_prefix_bloom_size_ratio = 0.02;
+			}
+
+			columnFamilyOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
 			return columnFamilyOptions;
 		}
 	}
@@ -149,17 +197,32 @@ namespace catapult { namespace cache {
 
 	RocksDatabase::RocksDatabase(const RocksDatabaseSettings& settings)
 			: m_settings(settings)
-			, m_pruningFilter(m_settings.PruningMode)
 			, m_pWriteBatch(std::make_unique<rocksdb::WriteBatch>()) {
 		if (m_settings.ColumnFamilyNames.empty())
 			CATAPULT_THROW_INVALID_ARGUMENT("missing column family names");
 
 		config::CatapultDirectory(m_settings.DatabaseDirectory).createAll();
 
-		auto columnFamilyOptions = CreateColumnFamilyOptions(m_settings.DatabaseConfig, m_pruningFilter.compactionFilter());
+		// single block cache is shared by all columns so that memory is allocated to the hottest blocks across all columns
+		const auto& databaseConfig = m_settings.DatabaseConfig;
+		std::shared_ptr<rocksdb::Cache> pBlockCache;
+		if (utils::FileSize() != databaseConfig.BlockCacheSize)
+			pBlockCache = rocksdb::NewLRUCache(databaseConfig.BlockCacheSize.bytes());
+
 		std::vector<rocksdb::ColumnFamilyDescriptor> columnFamilies;
-		for (const auto& columnFamilyName : m_settings.ColumnFamilyNames)
+		for (const auto& columnFamilyName : m_settings.ColumnFamilyNames) {
+			// each column has its own filter so that pruning one column does not affect compactions of other columns
+			auto pruningMode = SelectColumnPruningMode(m_settings.PruningMode, columnFamilyName);
+			m_pruningFilters.push_back(std::make_unique<RocksPruningFilter>(pruningMode));
+
+			const auto& columnConfig = SelectColumnConfiguration(databaseConfig, columnFamilyName);
+			auto columnFamilyOptions = CreateColumnFamilyOptions(
+					databaseConfig,
+					columnConfig,
+					pBlockCache,
+					m_pruningFilters.back()->compactionFilter());
 			columnFamilies.push_back(rocksdb::ColumnFamilyDescriptor(columnFamilyName, columnFamilyOptions));
+		}
 
 		rocksdb::DB* pDb;
 		auto dbOptions = CreateDatabaseOptions(m_settings.DatabaseConfig);
@@ -178,6 +241,10 @@ namespace catapult { namespace cache {
 		return m_settings.ColumnFamilyNames;
 	}
 
+	const config::NodeConfiguration::CacheDatabaseSubConfiguration& RocksDatabase::databaseConfig() const {
+		return m_settings.DatabaseConfig;
+	}
+
 	bool RocksDatabase::canPrune() const {
 		return FilterPruningMode::Enabled == m_settings.PruningMode;
 	}
@@ -207,6 +274,34 @@ namespace catapult { namespace cache {
 			CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
 	}
 
+	void RocksDatabase::multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results) {
+		if (!m_pDb)
+			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
+
+		results.resize(keys.size());
+		if (keys.empty())
+			return;
+
+		std::vector<rocksdb::PinnableSlice> values(keys.size());
+		std::vector<rocksdb::Status> statuses(keys.size());
+		m_pDb->MultiGet(rocksdb::ReadOptions(), m_handles[columnId], keys.size(), keys.data(), values.data(), statuses.data());
+
+		for (auto i = 0u; i < keys.size(); ++i) {
+			const auto& key = keys[i];
+			const auto& status = statuses[i];
+			results[i].setFound(status.ok());
+
+			if (status.ok()) {
+				results[i].storage().PinSelf(values[i]);
+				continue;
+			}
+
+			// note: this is intentional, in case of not found status will be set via `setFound` above
+			if (!status.IsNotFound())
+				CATAPULT_THROW_DB_KEY_ERROR("could not retrieve value");
+		}
+	}
+
 	void RocksDatabase::put(size_t columnId, const rocksdb::Slice& key, const std::string& value) {
 		if (!m_pDb)
 			CATAPULT_THROW_INVALID_ARGUMENT("RocksDatabase has not been initialized");
@@ -232,12 +327,13 @@ namespace catapult { namespace cache {
 	}
 
 	size_t RocksDatabase::prune(size_t columnId, uint64_t boundary) {
-		if (!m_pruningFilter.compactionFilter())
+		if (columnId >= m_pruningFilters.size() || !m_pruningFilters[columnId]->compactionFilter())
 			return 0;
 
-		m_pruningFilter.setPruningBoundary(boundary);
+		auto& pruningFilter = *m_pruningFilters[columnId];
+		pruningFilter.setPruningBoundary(boundary);
 		m_pDb->CompactRange({}, m_handles[columnId], nullptr, nullptr);
-		return m_pruningFilter.numRemoved();
+		return pruningFilter.numRemoved();
 	}
 
 	void RocksDatabase::flush() {
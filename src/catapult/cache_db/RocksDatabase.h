@@ -146,6 +146,9 @@ namespace catapult { namespace cache {
 		/// Gets the database column family names.
 		const std::vector<std::string>& columnFamilyNames() const;
 
+		/// Gets the database configuration.
+		const config::NodeConfiguration::CacheDatabaseSubConfiguration& databaseConfig() const;
+
 		/// Returns \c true if pruning is enabled.
 		bool canPrune() const;
 
@@ -153,6 +156,10 @@ namespace catapult { namespace cache {
 		/// Gets the value associated with \a key from \a columnId and sets \a result.
 		void get(size_t columnId, const rocksdb::Slice& key, RdbDataIterator& result);
 
+		/// Gets the values associated with all \a keys from \a columnId in a single batched lookup and sets \a results.
+		/// \note \a results is resized to match \a keys.
+		void multiGet(size_t columnId, const std::vector<rocksdb::Slice>& keys, std::vector<RdbDataIterator>& results);
+
 		/// Puts the \a value associated with \a key in \a columnId.
 		void put(size_t columnId, const rocksdb::Slice& key, const std::string& value);
 
@@ -170,7 +177,7 @@ namespace catapult { namespace cache {
 
 	private:
 		const RocksDatabaseSettings m_settings;
-		RocksPruningFilter m_pruningFilter;
+		std::vector<std::unique_ptr<RocksPruningFilter>> m_pruningFilters;
 		std::unique_ptr<rocksdb::WriteBatch> m_pWriteBatch;
 
 		std::unique_ptr<rocksdb::DB> m_pDb;
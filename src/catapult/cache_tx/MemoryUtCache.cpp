@@ -24,6 +24,7 @@
 #include "CacheSizeLogger.h"
 #include "catapult/model/EntityInfo.h"
 #include "catapult/model/FeeUtils.h"
+#include "catapult/utils/MemoryUtils.h"
 
 namespace catapult { namespace cache {
 
@@ -32,11 +33,13 @@ namespace catapult { namespace cache {
 		explicit TransactionData(size_t id)
 				: model::TransactionInfo()
 				, Id(id)
+				, ShortHashSlot(0)
 		{}
 
 		TransactionData(const model::TransactionInfo& transactionInfo, size_t id)
 				: model::TransactionInfo(transactionInfo.copy())
 				, Id(id)
+				, ShortHashSlot(0)
 		{}
 
 	public:
@@ -46,8 +49,96 @@ namespace catapult { namespace cache {
 
 	public:
 		size_t Id;
+
+		/// Position of the transaction in the short hash index.
+		/// \note This is mutable because it is not part of the container ordering.
+		mutable size_t ShortHashSlot;
 	};
 
+	// region ShortHashIndex
+
+	/// Packed short hashes of all transactions in the cache ordered by insertion.
+	/// \note Removed transactions leave holes that are compacted once at least half of all slots are holes.
+	class ShortHashIndex {
+	public:
+		/// Gets the number of indexed transactions.
+		size_t size() const {
+			return m_shortHashes.size() - m_numHoles;
+		}
+
+	public:
+		/// Adds \a data to the index.
+		void add(const TransactionData& data) {
+			data.ShortHashSlot = m_shortHashes.size();
+			m_shortHashes.push_back(utils::ToShortHash(data.EntityHash));
+			m_transactions.push_back(&data);
+		}
+
+		/// Removes \a data from the index.
+		void remove(const TransactionData& data) {
+			m_transactions[data.ShortHashSlot] = nullptr;
+			++m_numHoles;
+
+			if (2 * m_numHoles >= m_shortHashes.size())
+				compact();
+		}
+
+		/// Removes all transactions from the index.
+		void clear() {
+			m_shortHashes.clear();
+			m_transactions.clear();
+			m_numHoles = 0;
+		}
+
+	public:
+		/// Copies all short hashes into \a pShortHashes.
+		void copyTo(utils::ShortHash* pShortHashes) const {
+			if (0 == m_numHoles) {
+				utils::memcpy_cond(pShortHashes, m_shortHashes.data(), m_shortHashes.size() * sizeof(utils::ShortHash));
+				return;
+			}
+
+			for (auto i = 0u; i < m_shortHashes.size(); ++i) {
+				if (m_transactions[i])
+					*pShortHashes++ = m_shortHashes[i];
+			}
+		}
+
+		/// Calls \a consumer with all short hashes and their transactions until all are consumed or \c false is returned by consumer.
+		template<typename TConsumer>
+		void forEach(TConsumer consumer) const {
+			for (auto i = 0u; i < m_shortHashes.size(); ++i) {
+				if (m_transactions[i] && !consumer(m_shortHashes[i], *m_transactions[i]))
+					return;
+			}
+		}
+
+	private:
+		void compact() {
+			auto numTransactions = 0u;
+			for (auto i = 0u; i < m_shortHashes.size(); ++i) {
+				if (!m_transactions[i])
+					continue;
+
+				m_shortHashes[numTransactions] = m_shortHashes[i];
+				m_transactions[numTransactions] = m_transactions[i];
+				m_transactions[numTransactions]->ShortHashSlot = numTransactions;
+				++numTransactions;
+			}
+
+			m_shortHashes.resize(numTransactions);
+			m_transactions.resize(numTransactions);
+			m_numHoles = 0;
+		}
+
+	private:
+		std::vector<utils::ShortHash> m_shortHashes;
+		std::vector<const TransactionData*> m_transactions;
+		size_t m_numHoles = 0;
+	};
+
+	// endregion
+
 	// region MemoryUtCacheView
 
 	MemoryUtCacheView::MemoryUtCacheView(
@@ -55,11 +146,13 @@ namespace catapult { namespace cache {
 			utils::FileSize cacheSize,
 			const TransactionDataContainer& transactionDataContainer,
 			const IdLookup& idLookup,
+			const ShortHashIndex& shortHashIndex,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock)
 			: m_maxResponseSize(maxResponseSize)
 			, m_cacheSize(cacheSize)
 			, m_transactionDataContainer(transactionDataContainer)
 			, m_idLookup(idLookup)
+			, m_shortHashIndex(shortHashIndex)
 			, m_readLock(std::move(readLock))
 	{}
 
@@ -83,11 +176,9 @@ namespace catapult { namespace cache {
 	}
 
 	model::ShortHashRange MemoryUtCacheView::shortHashes() const {
-		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_transactionDataContainer.size());
-		auto shortHashesIter = shortHashes.begin();
-		for (const auto& data : m_transactionDataContainer)
-			*shortHashesIter++ = utils::ToShortHash(data.EntityHash);
-
+		uint8_t* pShortHashesData;
+		auto shortHashes = model::EntityRange<utils::ShortHash>::PrepareFixed(m_shortHashIndex.size(), &pShortHashesData);
+		m_shortHashIndex.copyTo(reinterpret_cast<utils::ShortHash*>(pShortHashesData));
 		return shortHashes;
 	}
 
@@ -97,24 +188,28 @@ namespace catapult { namespace cache {
 			const utils::ShortHashesSet& knownShortHashes) const {
 		uint64_t totalSize = 0;
 		UnknownTransactions transactions;
-		for (const auto& data : m_transactionDataContainer) {
+		auto maxResponseSize = m_maxResponseSize;
+		m_shortHashIndex.forEach([minDeadline, minFeeMultiplier, &knownShortHashes, maxResponseSize, &totalSize, &transactions](
+				auto shortHash,
+				const auto& data) {
+			// check known short hashes first because most transactions are usually known and this avoids touching them
+			if (knownShortHashes.cend() != knownShortHashes.find(shortHash))
+				return true;
+
 			if (data.pEntity->Deadline < minDeadline)
-				continue;
+				return true;
 
 			if (data.pEntity->MaxFee < model::CalculateTransactionFee(minFeeMultiplier, *data.pEntity))
-				continue;
+				return true;
 
-			auto shortHash = utils::ToShortHash(data.EntityHash);
-			auto iter = knownShortHashes.find(shortHash);
-			if (knownShortHashes.cend() == iter) {
-				auto pTransaction = data.pEntity;
-				totalSize += pTransaction->Size;
-				if (totalSize > m_maxResponseSize.bytes())
-					break;
+			auto pTransaction = data.pEntity;
+			totalSize += pTransaction->Size;
+			if (totalSize > maxResponseSize.bytes())
+				return false;
 
-				transactions.push_back(pTransaction);
-			}
-		}
+			transactions.push_back(pTransaction);
+			return true;
+		});
 
 		return transactions;
 	}
@@ -135,6 +230,7 @@ namespace catapult { namespace cache {
 					size_t& idSequence,
 					TransactionDataContainer& transactionDataContainer,
 					IdLookup& idLookup,
+					ShortHashIndex& shortHashIndex,
 					AccountWeights& weights,
 					utils::SpinReaderWriterLock::WriterLockGuard&& writeLock)
 					: m_maxCacheSize(maxCacheSize)
@@ -142,6 +238,7 @@ namespace catapult { namespace cache {
 					, m_idSequence(idSequence)
 					, m_transactionDataContainer(transactionDataContainer)
 					, m_idLookup(idLookup)
+					, m_shortHashIndex(shortHashIndex)
 					, m_weights(weights)
 					, m_writeLock(std::move(writeLock))
 			{}
@@ -164,7 +261,8 @@ namespace catapult { namespace cache {
 					return false;
 
 				m_idLookup.emplace(transactionInfo.EntityHash, ++m_idSequence);
-				m_transactionDataContainer.emplace(transactionInfo, m_idSequence);
+				auto dataIter = m_transactionDataContainer.emplace(transactionInfo, m_idSequence).first;
+				m_shortHashIndex.add(*dataIter);
 
 				m_weights.increment(transactionInfo.pEntity->SignerPublicKey, transactionSize);
 
@@ -186,6 +284,7 @@ namespace catapult { namespace cache {
 				m_weights.decrement(dataIter->pEntity->SignerPublicKey, transactionSize);
 				m_cacheSize = utils::FileSize::FromBytes(m_cacheSize.bytes() - transactionSize);
 
+				m_shortHashIndex.remove(*dataIter);
 				m_transactionDataContainer.erase(dataIter);
 				m_idLookup.erase(iter);
 				return erasedInfo;
@@ -209,6 +308,7 @@ namespace catapult { namespace cache {
 				m_cacheSize = utils::FileSize();
 				m_transactionDataContainer.clear();
 				m_idLookup.clear();
+				m_shortHashIndex.clear();
 				m_weights.reset();
 				return transactionInfosCopy;
 			}
@@ -219,6 +319,7 @@ namespace catapult { namespace cache {
 			size_t& m_idSequence;
 			TransactionDataContainer& m_transactionDataContainer;
 			IdLookup& m_idLookup;
+			ShortHashIndex& m_shortHashIndex;
 			AccountWeights& m_weights;
 			utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 		};
@@ -233,6 +334,7 @@ namespace catapult { namespace cache {
 		utils::FileSize CacheSize;
 
 		std::unordered_map<Hash256, size_t, utils::ArrayHasher<Hash256>> IdLookup;
+		cache::ShortHashIndex ShortHashIndex;
 		AccountWeights Weights;
 	};
 
@@ -251,6 +353,7 @@ namespace catapult { namespace cache {
 				m_pImpl->CacheSize,
 				m_pImpl->TransactionDataContainer,
 				m_pImpl->IdLookup,
+				m_pImpl->ShortHashIndex,
 				std::move(readLock));
 	}
 
@@ -262,6 +365,7 @@ namespace catapult { namespace cache {
 				m_idSequence,
 				m_pImpl->TransactionDataContainer,
 				m_pImpl->IdLookup,
+				m_pImpl->ShortHashIndex,
 				m_pImpl->Weights,
 				std::move(writeLock)));
 	}
@@ -29,7 +29,12 @@
 #include <set>
 #include <unordered_map>
 
-namespace catapult { namespace cache { struct TransactionData; } }
+namespace catapult {
+	namespace cache {
+		class ShortHashIndex;
+		struct TransactionData;
+	}
+}
 
 namespace catapult { namespace cache {
 
@@ -46,12 +51,14 @@ namespace catapult { namespace cache {
 
 	public:
 		/// Creates a view around a maximum response size (\a maxResponseSize), current cache size (\a cacheSize),
-		/// a transaction data container (\a transactionDataContainer) and an id lookup (\a idLookup) with lock context \a readLock.
+		/// a transaction data container (\a transactionDataContainer), an id lookup (\a idLookup) and
+		/// a short hash index (\a shortHashIndex) with lock context \a readLock.
 		MemoryUtCacheView(
 				utils::FileSize maxResponseSize,
 				utils::FileSize cacheSize,
 				const TransactionDataContainer& transactionDataContainer,
 				const IdLookup& idLookup,
+				const ShortHashIndex& shortHashIndex,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock);
 
 	public:
@@ -83,6 +90,7 @@ namespace catapult { namespace cache {
 		utils::FileSize m_cacheSize;
 		const TransactionDataContainer& m_transactionDataContainer;
 		const IdLookup& m_idLookup;
+		const ShortHashIndex& m_shortHashIndex;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 	};
 
@@ -23,12 +23,29 @@
 #include "ProcessContextsBuilder.h"
 #include "ProcessingNotificationSubscriber.h"
 #include "catapult/cache/CatapultCache.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/model/TransactionUtils.h"
 
 using namespace catapult::validators;
 
 namespace catapult { namespace chain {
 
 	namespace {
+		void PrefetchAccounts(
+				const model::WeakEntityInfos& entityInfos,
+				const model::NotificationPublisher& notificationPublisher,
+				cache::CatapultCacheDelta& cache) {
+			// aliased addresses cannot be resolved before execution, so they are prefetched as is and will simply not be found
+			auto unresolvedAddresses = model::ExtractAddresses(entityInfos, notificationPublisher);
+
+			std::vector<Address> addresses;
+			addresses.reserve(unresolvedAddresses.size());
+			for (const auto& unresolvedAddress : unresolvedAddresses)
+				addresses.push_back(unresolvedAddress.copyTo<Address>());
+
+			cache.sub<cache::AccountStateCache>().prefetch(addresses);
+		}
+
 		class DefaultBatchEntityProcessor {
 		public:
 			explicit DefaultBatchEntityProcessor(const ExecutionConfiguration& config) : m_config(config)
@@ -43,6 +60,9 @@ namespace catapult { namespace chain {
 				if (entityInfos.empty())
 					return ValidationResult::Neutral;
 
+				if (m_config.EnableAccountPrefetch)
+					PrefetchAccounts(entityInfos, *m_config.pNotificationPublisher, state.Cache);
+
 				ProcessContextsBuilder contextBuilder(height, timestamp, m_config);
 				contextBuilder.setObserverState(state); // this uses contents of ObserverState to initialize the builder
 				auto validatorContext = contextBuilder.buildValidatorContext();
@@ -23,6 +23,7 @@
 #include "CompareChains.h"
 #include "catapult/api/RemoteChainApi.h"
 #include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/thread/FutureUtils.h"
 #include "catapult/utils/SpinLock.h"
 #include <queue>
@@ -60,6 +61,11 @@ namespace catapult { namespace chain {
 				return m_numBytes;
 			}
 
+			size_t numAvailableBytes() {
+				utils::SpinLockGuard guard(m_spinLock);
+				return m_numBytes < m_maxSize ? m_maxSize - m_numBytes : 0;
+			}
+
 			bool shouldStartSync() {
 				utils::SpinLockGuard guard(m_spinLock);
 				if (m_numBytes >= m_maxSize || m_hasPendingSync || m_dirty)
@@ -238,8 +244,174 @@ namespace catapult { namespace chain {
 
 		// endregion
 
+		// region parallel download
+
+		bool IsChainContinuation(const model::BlockRange& range, Height startHeight, const Hash256* pPreviousBlockHash) {
+			const auto& firstBlock = *range.cbegin();
+			const auto& lastBlock = *--range.cend();
+			if (startHeight != firstBlock.Height || startHeight + Height(range.size() - 1) != lastBlock.Height)
+				return false;
+
+			return !pPreviousBlockHash || *pPreviousBlockHash == firstBlock.PreviousBlockHash;
+		}
+
+		using RemoteChainApis = std::vector<std::shared_ptr<const api::RemoteChainApi>>;
+
+		thread::future<bool> AdditionalChainBlocksFrom(
+				const RemoteChainApis& additionalRemoteChainApis,
+				Height startHeight,
+				const Hash256& previousBlockHash,
+				const api::BlocksFromOptions& options,
+				UnprocessedElements& unprocessedElements) {
+			// split the heights following the first chunk into consecutive chunks and request one chunk per additional peer
+			std::vector<model::NodeIdentity> sourceIdentities;
+			std::vector<thread::future<model::BlockRange>> blocksFutures;
+			for (const auto& pAdditionalRemoteChainApi : additionalRemoteChainApis) {
+				auto chunkStartHeight = startHeight + Height(sourceIdentities.size() * options.NumBlocks);
+				sourceIdentities.push_back(pAdditionalRemoteChainApi->remoteIdentity());
+				blocksFutures.push_back(pAdditionalRemoteChainApi->blocksFrom(chunkStartHeight, options));
+			}
+
+			// additional apis are captured in order to keep their connections checked out until all chunks are downloaded
+			auto allBlocksFuture = thread::when_all(std::move(blocksFutures));
+			return allBlocksFuture.then([
+					additionalRemoteChainApis,
+					sourceIdentities,
+					startHeight,
+					previousBlockHash,
+					options,
+					&unprocessedElements](auto&& chunkFuturesFuture) {
+				auto chunkFutures = chunkFuturesFuture.get();
+
+				// consume chunks in height order and stop at the first chunk that does not extend the chain
+				auto nextHeight = startHeight;
+				auto lastBlockHash = previousBlockHash;
+				for (auto i = 0u; i < chunkFutures.size(); ++i) {
+					model::BlockRange range;
+					try {
+						range = chunkFutures[i].get();
+					} catch (const catapult_runtime_error& e) {
+						CATAPULT_LOG(warning)
+								<< "exception thrown while requesting blocks from " << sourceIdentities[i] << ": " << e.what();
+						break;
+					}
+
+					if (range.empty()) {
+						CATAPULT_LOG(info) << "peer " << sourceIdentities[i] << " returned 0 blocks";
+						break;
+					}
+
+					if (!IsChainContinuation(range, nextHeight, &lastBlockHash)) {
+						CATAPULT_LOG(warning)
+								<< "ignoring blocks from " << sourceIdentities[i]
+								<< " that do not extend the chain at height " << nextHeight;
+						break;
+					}
+
+					const auto& lastBlock = *--range.cend();
+					auto numBlocks = range.size();
+					nextHeight = lastBlock.Height + Height(1);
+					lastBlockHash = model::CalculateHash(lastBlock);
+
+					CATAPULT_LOG(info)
+							<< "peer " << sourceIdentities[i] << " returned " << numBlocks
+							<< " blocks (heights " << range.cbegin()->Height << " - " << lastBlock.Height << ")";
+
+					if (!unprocessedElements.add(model::AnnotatedBlockRange(std::move(range), sourceIdentities[i])))
+						break;
+
+					// the following chunk starts at a fixed height, so it can only extend a complete chunk
+					if (numBlocks < options.NumBlocks)
+						break;
+				}
+
+				return true;
+			});
+		}
+
+		NodeInteractionFuture ParallelChainBlocksFrom(
+				const api::RemoteChainApi& remoteChainApi,
+				const supplier<RemoteChainApis>& additionalRemoteChainApisSupplier,
+				Height startHeight,
+				const api::BlocksFromOptions& options,
+				UnprocessedElements& unprocessedElements) {
+			// the first chunk is always requested from the peer that agreed on the common block
+			auto sourceIdentity = remoteChainApi.remoteIdentity();
+			auto blocksFuture = remoteChainApi.blocksFrom(startHeight, options);
+			return thread::compose(std::move(blocksFuture), [
+					additionalRemoteChainApisSupplier,
+					sourceIdentity,
+					startHeight,
+					options,
+					&unprocessedElements](auto&& rangeFuture) {
+				model::BlockRange range;
+				try {
+					range = rangeFuture.get();
+				} catch (const catapult_runtime_error& e) {
+					CATAPULT_LOG(warning)
+							<< "exception thrown while requesting blocks from " << sourceIdentity << ": " << e.what();
+					return thread::make_ready_future(ionet::NodeInteractionResultCode::Failure);
+				}
+
+				if (range.empty()) {
+					CATAPULT_LOG(info) << "peer " << sourceIdentity << " returned 0 blocks";
+					return thread::make_ready_future(ionet::NodeInteractionResultCode::Neutral);
+				}
+
+				if (!IsChainContinuation(range, startHeight, nullptr)) {
+					CATAPULT_LOG(warning)
+							<< "ignoring blocks from " << sourceIdentity << " that do not extend the chain at height " << startHeight;
+					return thread::make_ready_future(ionet::NodeInteractionResultCode::Neutral);
+				}
+
+				const auto& lastBlock = *--range.cend();
+				auto numBlocks = range.size();
+				auto nextHeight = lastBlock.Height + Height(1);
+				auto lastBlockHash = model::CalculateHash(lastBlock);
+
+				CATAPULT_LOG(info)
+						<< "peer " << sourceIdentity << " returned " << numBlocks
+						<< " blocks (heights " << range.cbegin()->Height << " - " << lastBlock.Height << ")";
+
+				if (!unprocessedElements.add(model::AnnotatedBlockRange(std::move(range), sourceIdentity)))
+					return thread::make_ready_future(ionet::NodeInteractionResultCode::Neutral);
+
+				// only fan out when the remote is known to be at least one full chunk ahead
+				// (otherwise, additional peers would be asked for heights past the remote tip)
+				if (numBlocks < options.NumBlocks)
+					return thread::make_ready_future(ionet::NodeInteractionResultCode::Success);
+
+				auto additionalRemoteChainApis = additionalRemoteChainApisSupplier();
+				if (additionalRemoteChainApis.empty())
+					return thread::make_ready_future(ionet::NodeInteractionResultCode::Success);
+
+				CATAPULT_LOG(debug)
+						<< "pulling blocks starting at " << nextHeight
+						<< " from " << additionalRemoteChainApis.size() << " additional peers";
+				auto additionalFuture = AdditionalChainBlocksFrom(
+						additionalRemoteChainApis,
+						nextHeight,
+						lastBlockHash,
+						options,
+						unprocessedElements);
+
+				// the interaction result only reflects the primary peer
+				return additionalFuture.then([](auto&&) {
+					return ionet::NodeInteractionResultCode::Success;
+				});
+			});
+		}
+
+		// endregion
+
 		// region DefaultChainSynchronizer
 
+		size_t CalculateMaxUnprocessedBytes(const ChainSynchronizerConfiguration& config) {
+			// leave room for one chunk per parallel sync peer in addition to the chunk downloaded from the primary peer
+			auto maxChunks = std::max<size_t>(2, config.MaxParallelSyncPeers) + 1;
+			return maxChunks * config.MaxChainBytesPerSyncAttempt;
+		}
+
 		class DefaultChainSynchronizer {
 		public:
 			using RemoteApiType = api::RemoteChainApi;
@@ -249,13 +421,16 @@ namespace catapult { namespace chain {
 					const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
 					const ChainSynchronizerConfiguration& config,
 					const supplier<Height>& localFinalizedHeightSupplier,
+					const RemoteChainApisSupplier& remoteChainApisSupplier,
 					const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer)
 					: m_pLocalChainApi(pLocalChainApi)
 					, m_compareChainOptions{ config.MaxHashesPerSyncAttempt, localFinalizedHeightSupplier }
 					, m_blocksFromOptions(config.MaxBlocksPerSyncAttempt, config.MaxChainBytesPerSyncAttempt)
+					, m_maxParallelSyncPeers(config.MaxParallelSyncPeers)
+					, m_remoteChainApisSupplier(remoteChainApisSupplier)
 					, m_pUnprocessedElements(std::make_shared<UnprocessedElements>(
 							blockRangeConsumer,
-							3 * config.MaxChainBytesPerSyncAttempt))
+							CalculateMaxUnprocessedBytes(config)))
 			{}
 
 		public:
@@ -306,21 +481,53 @@ namespace catapult { namespace chain {
 					return thread::make_ready_future(std::move(code));
 				}
 
+				// blocks can only be downloaded in parallel when the local chain does not need to be rolled back
+				// because the disruptor requires all blocks replacing a fork to be part of a single range
+				auto startHeight = compareResult.CommonBlockHeight + Height(1);
+				if (0 == compareResult.ForkDepth && 0 != m_maxParallelSyncPeers) {
+					CATAPULT_LOG(debug)
+							<< "pulling blocks from remote with common height " << compareResult.CommonBlockHeight
+							<< " from " << remoteChainApi.remoteIdentity()
+							<< " and up to " << m_maxParallelSyncPeers << " additional peers";
+					return ParallelChainBlocksFrom(
+							remoteChainApi,
+							[this]() { return this->checkoutAdditionalRemoteChainApis(); },
+							startHeight,
+							m_blocksFromOptions,
+							*m_pUnprocessedElements);
+				}
+
 				CATAPULT_LOG(debug)
 						<< "pulling blocks from remote with common height " << compareResult.CommonBlockHeight
 						<< " (fork depth = " << compareResult.ForkDepth << ") from " << remoteChainApi.remoteIdentity();
 				return ChainBlocksFrom(
 						CreateFutureSupplier(remoteChainApi, m_blocksFromOptions),
-						compareResult.CommonBlockHeight + Height(1),
+						startHeight,
 						compareResult.ForkDepth,
 						std::make_shared<RangeAggregator>(remoteChainApi.remoteIdentity()),
 						*m_pUnprocessedElements);
 			}
 
+			RemoteChainApis checkoutAdditionalRemoteChainApis() const {
+				if (0 == m_blocksFromOptions.NumBytes)
+					return RemoteChainApis();
+
+				// every additional peer downloads up to one chunk, so only use as many additional peers as there are chunks fitting
+				// into the unprocessed elements budget (the chunk downloaded from the primary peer has already been added)
+				auto numAvailableChunks = m_pUnprocessedElements->numAvailableBytes() / m_blocksFromOptions.NumBytes;
+				auto maxAdditionalPeers = std::min<size_t>(m_maxParallelSyncPeers, numAvailableChunks);
+				if (0 == maxAdditionalPeers)
+					return RemoteChainApis();
+
+				return m_remoteChainApisSupplier(maxAdditionalPeers);
+			}
+
 		private:
 			std::shared_ptr<const api::ChainApi> m_pLocalChainApi;
 			CompareChainsOptions m_compareChainOptions;
 			api::BlocksFromOptions m_blocksFromOptions;
+			uint32_t m_maxParallelSyncPeers;
+			RemoteChainApisSupplier m_remoteChainApisSupplier;
 			std::shared_ptr<UnprocessedElements> m_pUnprocessedElements;
 		};
 
@@ -332,10 +539,21 @@ namespace catapult { namespace chain {
 			const ChainSynchronizerConfiguration& config,
 			const supplier<Height>& localFinalizedHeightSupplier,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
+		auto remoteChainApisSupplier = [](auto) { return std::vector<std::shared_ptr<const api::RemoteChainApi>>(); };
+		return CreateChainSynchronizer(pLocalChainApi, config, localFinalizedHeightSupplier, remoteChainApisSupplier, blockRangeConsumer);
+	}
+
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const supplier<Height>& localFinalizedHeightSupplier,
+			const RemoteChainApisSupplier& remoteChainApisSupplier,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer) {
 		auto pSynchronizer = std::make_shared<DefaultChainSynchronizer>(
 				pLocalChainApi,
 				config,
 				localFinalizedHeightSupplier,
+				remoteChainApisSupplier,
 				blockRangeConsumer);
 		return CreateRemoteNodeSynchronizer(pSynchronizer);
 	}
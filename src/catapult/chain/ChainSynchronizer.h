@@ -24,6 +24,7 @@
 #include "catapult/disruptor/DisruptorTypes.h"
 #include "catapult/model/AnnotatedEntityRange.h"
 #include "catapult/model/RangeTypes.h"
+#include <vector>
 
 namespace catapult {
 	namespace api {
@@ -43,6 +44,10 @@ namespace catapult { namespace chain {
 			model::AnnotatedBlockRange&&,
 			const disruptor::ProcessingCompleteFunc&)>;
 
+	/// Function signature for supplying up to the specified number of remote chain apis of additional peers.
+	/// \note Each returned api keeps its underlying connection checked out until it is destroyed.
+	using RemoteChainApisSupplier = std::function<std::vector<std::shared_ptr<const api::RemoteChainApi>> (size_t)>;
+
 	/// Configuration for customizing a chain synchronizer.
 	struct ChainSynchronizerConfiguration {
 		/// Maximum number of hashes per sync attempt.
@@ -56,6 +61,10 @@ namespace catapult { namespace chain {
 
 		/// Maximum number of blocks that can be rolled back.
 		uint32_t MaxRollbackBlocks;
+
+		/// Maximum number of additional peers from which blocks are downloaded in parallel.
+		/// \note Unprocessed blocks are bounded by (max(2, MaxParallelSyncPeers) + 1) * MaxChainBytesPerSyncAttempt bytes.
+		uint32_t MaxParallelSyncPeers;
 	};
 
 	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), block chain \a config,
@@ -65,4 +74,14 @@ namespace catapult { namespace chain {
 			const ChainSynchronizerConfiguration& config,
 			const supplier<Height>& localFinalizedHeightSupplier,
 			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
+
+	/// Creates a chain synchronizer around the specified local chain api (\a pLocalChainApi), block chain \a config,
+	/// local finalized height supplier (\a localFinalizedHeightSupplier) and block range consumer (\a blockRangeConsumer).
+	/// When the local chain is not forked, \a remoteChainApisSupplier is used to download blocks from additional peers in parallel.
+	RemoteNodeSynchronizer<api::RemoteChainApi> CreateChainSynchronizer(
+			const std::shared_ptr<const api::ChainApi>& pLocalChainApi,
+			const ChainSynchronizerConfiguration& config,
+			const supplier<Height>& localFinalizedHeightSupplier,
+			const RemoteChainApisSupplier& remoteChainApisSupplier,
+			const CompletionAwareBlockRangeConsumerFunc& blockRangeConsumer);
 }}
@@ -57,5 +57,8 @@ namespace catapult { namespace chain {
 
 		/// Notification publisher.
 		PublisherPointer pNotificationPublisher;
+
+		/// \c true if accounts involved in a batch should be prefetched from the cache database before execution.
+		bool EnableAccountPrefetch = false;
 	};
 }}
@@ -29,6 +29,7 @@
 #include "catapult/cache_tx/UtCache.h"
 #include "catapult/model/FeeUtils.h"
 #include "catapult/utils/HexFormatter.h"
+#include "catapult/utils/StackTimer.h"
 
 namespace catapult { namespace chain {
 
@@ -264,10 +265,19 @@ namespace catapult { namespace chain {
 	UtUpdater::~UtUpdater() = default;
 
 	std::vector<UtUpdateResult> UtUpdater::update(const std::vector<model::TransactionInfo>& utInfos) {
-		return m_pImpl->update(utInfos);
+		utils::StackTimer timer;
+		auto updateResults = m_pImpl->update(utInfos);
+		m_updateHistogram.record(timer.micros());
+		return updateResults;
 	}
 
 	void UtUpdater::update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos) {
+		utils::StackTimer timer;
 		m_pImpl->update(confirmedTransactionHashes, utInfos);
+		m_updateHistogram.record(timer.micros());
+	}
+
+	const utils::DiagnosticHistogram& UtUpdater::updateHistogram() const {
+		return m_updateHistogram;
 	}
 }}
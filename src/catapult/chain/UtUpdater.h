@@ -25,6 +25,7 @@
 #include "catapult/model/EntityInfo.h"
 #include "catapult/observers/ObserverTypes.h"
 #include "catapult/utils/ArraySet.h"
+#include "catapult/utils/DiagnosticHistogram.h"
 
 namespace catapult {
 	namespace cache {
@@ -117,8 +118,13 @@ namespace catapult { namespace chain {
 		/// removing transactions with hashes in \a confirmedTransactionHashes.
 		void update(const utils::HashPointerSet& confirmedTransactionHashes, const std::vector<model::TransactionInfo>& utInfos);
 
+	public:
+		/// Gets the histogram of update durations (in microseconds).
+		const utils::DiagnosticHistogram& updateHistogram() const;
+
 	private:
 		class Impl;
 		std::unique_ptr<Impl> m_pImpl;
+		utils::DiagnosticHistogram m_updateHistogram;
 	};
 }}
@@ -0,0 +1,44 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include <string>
+
+namespace catapult { namespace config {
+
+	/// Compression applied to cache database data blocks.
+	enum class CacheDatabaseCompression {
+		/// Data blocks are not compressed.
+		None,
+
+		/// Data blocks are compressed with snappy.
+		Snappy,
+
+		/// Data blocks are compressed with lz4.
+		Lz4,
+
+		/// Data blocks are compressed with zstd.
+		Zstd
+	};
+
+	/// Tries to parse \a compressionName into a cache database \a compression.
+	bool TryParseValue(const std::string& compressionName, CacheDatabaseCompression& compression);
+}}
@@ -90,6 +90,10 @@ namespace catapult { namespace config {
 		metadata.Version = ionet::NodeVersion(localNodeConfig.Version);
 		metadata.Roles = localNodeConfig.Roles;
 
+		// advertise compression support so that remote nodes know they can send compressed packets to the local node
+		if (config.Node.EnablePacketCompression)
+			metadata.Roles |= ionet::NodeRoles::Compression;
+
 		return ionet::Node({ identityKey, "_local_" }, endpoint, metadata);
 	}
 }}
@@ -43,8 +43,12 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(EnableSingleThreadPool);
 		LOAD_NODE_PROPERTY(EnableCacheDatabaseStorage);
 		LOAD_NODE_PROPERTY(EnableAutoSyncCleanup);
+		LOAD_NODE_PROPERTY(EnableIncrementalStateCheckpoints);
+		LOAD_NODE_PROPERTY(StateChangeJournalCheckpointSize);
 
 		LOAD_NODE_PROPERTY(FileDatabaseBatchSize);
+		LOAD_NODE_PROPERTY(EnableFileDatabaseMemoryMapping);
+		LOAD_NODE_PROPERTY(HotBlocksCacheMaxMemorySize);
 
 		LOAD_NODE_PROPERTY(EnableTransactionSpamThrottling);
 		LOAD_NODE_PROPERTY(TransactionSpamThrottlingMaxBoostFee);
@@ -52,6 +56,7 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(MaxHashesPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxBlocksPerSyncAttempt);
 		LOAD_NODE_PROPERTY(MaxChainBytesPerSyncAttempt);
+		LOAD_NODE_PROPERTY(MaxParallelSyncPeers);
 
 		LOAD_NODE_PROPERTY(ShortLivedCacheTransactionDuration);
 		LOAD_NODE_PROPERTY(ShortLivedCacheBlockDuration);
@@ -70,6 +75,8 @@ namespace catapult { namespace config {
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSize);
 		LOAD_NODE_PROPERTY(SocketWorkingBufferSensitivity);
 		LOAD_NODE_PROPERTY(MaxPacketDataSize);
+		LOAD_NODE_PROPERTY(EnablePacketCompression);
+		LOAD_NODE_PROPERTY(PacketCompressionThreshold);
 
 		LOAD_NODE_PROPERTY(BlockDisruptorSlotCount);
 		LOAD_NODE_PROPERTY(BlockDisruptorMaxMemorySize);
@@ -81,6 +88,8 @@ namespace catapult { namespace config {
 
 		LOAD_NODE_PROPERTY(EnableDispatcherAbortWhenFull);
 		LOAD_NODE_PROPERTY(EnableDispatcherInputAuditing);
+		LOAD_NODE_PROPERTY(DispatcherWaitStrategy);
+		LOAD_NODE_PROPERTY(MinHashCalculationBatchSize);
 
 		LOAD_NODE_PROPERTY(MaxTrackedNodes);
 
@@ -104,8 +113,27 @@ namespace catapult { namespace config {
 
 		LOAD_CACHE_DATABASE_PROPERTY(MaxWriteBatchSize);
 
+		LOAD_CACHE_DATABASE_PROPERTY(PatriciaTreeRetainedRoots);
+
 #undef LOAD_CACHE_DATABASE_PROPERTY
 
+#define LOAD_CACHE_DATABASE_COLUMN_PROPERTY(SECTION, COLUMN, NAME) \
+	utils::LoadIniProperty(bag, "cache_database." SECTION, #NAME, config.CacheDatabase.COLUMN.NAME)
+
+		LOAD_CACHE_DATABASE_COLUMN_PROPERTY("primary", PrimaryColumn, BloomFilterBitsPerKey);
+		LOAD_CACHE_DATABASE_COLUMN_PROPERTY("primary", PrimaryColumn, Compression);
+		LOAD_CACHE_DATABASE_COLUMN_PROPERTY("primary", PrimaryColumn, MemtableSize);
+
+		LOAD_CACHE_DATABASE_COLUMN_PROPERTY("patricia_tree", PatriciaTreeColumn, BloomFilterBitsPerKey);
+		LOAD_CACHE_DATABASE_COLUMN_PROPERTY("patricia_tree", PatriciaTreeColumn, Compression);
+		LOAD_CACHE_DATABASE_COLUMN_PROPERTY("patricia_tree", PatriciaTreeColumn, MemtableSize);
+
+		LOAD_CACHE_DATABASE_COLUMN_PROPERTY("secondary", SecondaryColumn, BloomFilterBitsPerKey);
+		LOAD_CACHE_DATABASE_COLUMN_PROPERTY("secondary", SecondaryColumn, Compression);
+		LOAD_CACHE_DATABASE_COLUMN_PROPERTY("secondary", SecondaryColumn, MemtableSize);
+
+#undef LOAD_CACHE_DATABASE_COLUMN_PROPERTY
+
 #define LOAD_LOCALNODE_PROPERTY(NAME) utils::LoadIniProperty(bag, "localnode", #NAME, config.Local.NAME)
 
 		LOAD_LOCALNODE_PROPERTY(Host);
@@ -150,7 +178,7 @@ namespace catapult { namespace config {
 
 #undef LOAD_BANNING_PROPERTY
 
-		utils::VerifyBagSizeExact(bag, 40 + 7 + 4 + 4 + 5 + 9);
+		utils::VerifyBagSizeExact(bag, 49 + 8 + 3 * 3 + 4 + 4 + 5 + 9);
 		return config;
 	}
 
@@ -20,6 +20,8 @@
 **/
 
 #pragma once
+#include "CacheDatabaseCompression.h"
+#include "catapult/disruptor/ConsumerWaitStrategy.h"
 #include "catapult/ionet/NodeRoles.h"
 #include "catapult/ionet/NodeVersion.h"
 #include "catapult/model/TransactionSelectionStrategy.h"
@@ -53,10 +55,24 @@ namespace catapult { namespace config {
 		/// \note This should be \c false if broker process is running.
 		bool EnableAutoSyncCleanup;
 
+		/// \c true if state changes should be journaled so that state checkpoints only need to save the changes since the previous one.
+		/// \note Incremental checkpoints are disabled when cache database storage is enabled.
+		bool EnableIncrementalStateCheckpoints;
+
+		/// Size of the state change journal that triggers an incremental state checkpoint while the node is running.
+		utils::FileSize StateChangeJournalCheckpointSize;
+
 		/// Maximum number of payloads to store in each file database disk file.
 		/// \note This is recommended to be a factor of 10000.
 		uint32_t FileDatabaseBatchSize;
 
+		/// \c true if blocks should be read from memory mapped file database files.
+		bool EnableFileDatabaseMemoryMapping;
+
+		/// Maximum memory of all recently saved or loaded blocks cached by the block storage cache.
+		/// \note \c 0 will disable caching of these blocks.
+		utils::FileSize HotBlocksCacheMaxMemorySize;
+
 		/// \c true if transaction spam throttling should be enabled.
 		bool EnableTransactionSpamThrottling;
 
@@ -72,6 +88,10 @@ namespace catapult { namespace config {
 		/// Maximum chain bytes per sync attempt.
 		utils::FileSize MaxChainBytesPerSyncAttempt;
 
+		/// Maximum number of additional peers from which blocks are downloaded in parallel per sync attempt.
+		/// \note Parallel download is disabled when \c 0.
+		uint32_t MaxParallelSyncPeers;
+
 		/// Duration of a transaction in the short lived cache.
 		utils::TimeSpan ShortLivedCacheTransactionDuration;
 
@@ -116,6 +136,13 @@ namespace catapult { namespace config {
 		/// Maximum packet data size.
 		utils::FileSize MaxPacketDataSize;
 
+		/// \c true if block and transaction packets should be compressed when sent to peers that support compression.
+		/// \note When set, the local node advertises compression support via its roles.
+		bool EnablePacketCompression;
+
+		/// Minimum data size of a block or transaction packet that is compressed.
+		utils::FileSize PacketCompressionThreshold;
+
 		/// Number of slots in the block disruptor circular buffer.
 		uint32_t BlockDisruptorSlotCount;
 
@@ -140,6 +167,13 @@ namespace catapult { namespace config {
 		/// \c true if all dispatcher inputs should be audited.
 		bool EnableDispatcherInputAuditing;
 
+		/// Strategy used by dispatcher consumers when waiting for elements.
+		disruptor::ConsumerWaitStrategy DispatcherWaitStrategy;
+
+		/// Minimum number of entities assigned to each thread when dispatcher entity hashes are calculated in parallel.
+		/// \note \c 0 will disable parallel hash calculation.
+		uint32_t MinHashCalculationBatchSize;
+
 		/// Maximum number of nodes to track in memory.
 		uint32_t MaxTrackedNodes;
 
@@ -159,6 +193,20 @@ namespace catapult { namespace config {
 		std::string ListenInterface;
 
 	public:
+		/// Cache database column tuning configuration.
+		struct CacheDatabaseColumnSubConfiguration {
+			/// Number of bloom filter bits per key.
+			/// \note Bloom filters are disabled when zero.
+			uint32_t BloomFilterBitsPerKey;
+
+			/// Compression applied to data blocks.
+			CacheDatabaseCompression Compression;
+
+			/// Memtable (write buffer) size.
+			/// \note Default size is used when zero.
+			utils::FileSize MemtableSize;
+		};
+
 		/// Cache database configuration.
 		struct CacheDatabaseSubConfiguration {
 			/// \c true if operational statistics should be captured and logged.
@@ -173,8 +221,8 @@ namespace catapult { namespace config {
 			/// Maximum number of threads that will concurrently perform a compaction.
 			uint32_t MaxSubcompactionThreads;
 
-			/// Block cache size.
-			/// \note Optimizes for point lookup when nonzero.
+			/// Size of block cache shared by all columns.
+			/// \note Default per column block caches are used when zero.
 			utils::FileSize BlockCacheSize;
 
 			/// Memtable memory budget.
@@ -183,6 +231,19 @@ namespace catapult { namespace config {
 
 			/// Maximum write batch size.
 			utils::FileSize MaxWriteBatchSize;
+
+			/// Number of previous patricia tree roots (in addition to the current root) with retained nodes.
+			/// \note Unreachable patricia tree nodes are never pruned when zero.
+			uint32_t PatriciaTreeRetainedRoots;
+
+			/// Tuning of primary (default) columns.
+			CacheDatabaseColumnSubConfiguration PrimaryColumn;
+
+			/// Tuning of patricia tree columns.
+			CacheDatabaseColumnSubConfiguration PatriciaTreeColumn;
+
+			/// Tuning of all other secondary columns (e.g. height grouping).
+			CacheDatabaseColumnSubConfiguration SecondaryColumn;
 		};
 
 	public:
@@ -97,10 +97,12 @@ namespace catapult { namespace consumers {
 			DefaultBlockChainProcessor(
 					const BlockHitPredicateFactory& blockHitPredicateFactory,
 					const chain::BatchEntityProcessor& batchEntityProcessor,
-					ReceiptValidationMode receiptValidationMode)
+					ReceiptValidationMode receiptValidationMode,
+					thread::IoThreadPool* pPool)
 					: m_blockHitPredicateFactory(blockHitPredicateFactory)
 					, m_batchEntityProcessor(batchEntityProcessor)
 					, m_receiptValidationMode(receiptValidationMode)
+					, m_pPool(pPool)
 			{}
 
 		public:
@@ -122,7 +124,7 @@ namespace catapult { namespace consumers {
 
 				// initial cache state will be either last cache state or unwound cache state
 				std::vector<std::string> cacheStateLogs;
-				cacheStateLogs.push_back(FormatCacheStateLog(pParent->Height, state.Cache.calculateStateHash(pParent->Height)));
+				cacheStateLogs.push_back(FormatCacheStateLog(pParent->Height, calculateStateHash(state.Cache, pParent->Height)));
 
 				for (auto& element : elements) {
 					// 1. check generation hash
@@ -142,7 +144,7 @@ namespace catapult { namespace consumers {
 					}
 
 					// 3. check state hash
-					if (!CheckStateHash(element, state.Cache, cacheStateLogs))
+					if (!CheckStateHash(element, calculateStateHash(state.Cache, block.Height), cacheStateLogs))
 						return chain::Failure_Chain_Block_Inconsistent_State_Hash;
 
 					// 4. check receipts hash
@@ -166,6 +168,10 @@ namespace catapult { namespace consumers {
 						: observers::ObserverState(state.Cache, blockStatementBuilder);
 			}
 
+			cache::StateHashInfo calculateStateHash(const cache::CatapultCacheDelta& cacheDelta, Height height) const {
+				return m_pPool ? cacheDelta.calculateStateHash(height, *m_pPool) : cacheDelta.calculateStateHash(height);
+			}
+
 		private:
 			static Key GetVrfPublicKey(const cache::ReadOnlyAccountStateCache& accountStateCache, const Address& blockHarvester) {
 				Key vrfPublicKey;
@@ -211,10 +217,9 @@ namespace catapult { namespace consumers {
 
 			static bool CheckStateHash(
 					model::BlockElement& element,
-					cache::CatapultCacheDelta& cacheDelta,
+					const cache::StateHashInfo& cacheStateHashInfo,
 					std::vector<std::string>& cacheStateLogs) {
 				const auto& block = element.Block;
-				auto cacheStateHashInfo = cacheDelta.calculateStateHash(block.Height);
 				cacheStateLogs.push_back(FormatCacheStateLog(block.Height, cacheStateHashInfo));
 
 				if (block.StateHash != cacheStateHashInfo.StateHash) {
@@ -264,6 +269,7 @@ namespace catapult { namespace consumers {
 			BlockHitPredicateFactory m_blockHitPredicateFactory;
 			chain::BatchEntityProcessor m_batchEntityProcessor;
 			ReceiptValidationMode m_receiptValidationMode;
+			thread::IoThreadPool* m_pPool;
 		};
 	}
 
@@ -271,6 +277,14 @@ namespace catapult { namespace consumers {
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
 			const chain::BatchEntityProcessor& batchEntityProcessor,
 			ReceiptValidationMode receiptValidationMode) {
-		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode);
+		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode, nullptr);
+	}
+
+	BlockChainProcessor CreateBlockChainProcessor(
+			const BlockHitPredicateFactory& blockHitPredicateFactory,
+			const chain::BatchEntityProcessor& batchEntityProcessor,
+			ReceiptValidationMode receiptValidationMode,
+			thread::IoThreadPool& pool) {
+		return DefaultBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode, &pool);
 	}
 }}
@@ -28,6 +28,7 @@
 namespace catapult {
 	namespace cache { class ReadOnlyCatapultCache; }
 	namespace chain { struct ObserverState; }
+	namespace thread { class IoThreadPool; }
 }
 
 namespace catapult { namespace consumers {
@@ -83,4 +84,13 @@ namespace catapult { namespace consumers {
 			const BlockHitPredicateFactory& blockHitPredicateFactory,
 			const chain::BatchEntityProcessor& batchEntityProcessor,
 			ReceiptValidationMode receiptValidationMode);
+
+	/// Creates a block chain processor around the specified block hit predicate factory (\a blockHitPredicateFactory)
+	/// and batch entity processor (\a batchEntityProcessor) with \a receiptValidationMode.
+	/// Sub cache merkle roots are updated in parallel using \a pool.
+	BlockChainProcessor CreateBlockChainProcessor(
+			const BlockHitPredicateFactory& blockHitPredicateFactory,
+			const chain::BatchEntityProcessor& batchEntityProcessor,
+			ReceiptValidationMode receiptValidationMode,
+			thread::IoThreadPool& pool);
 }}
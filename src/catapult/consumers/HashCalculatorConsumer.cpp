@@ -25,17 +25,70 @@
 #include "catapult/crypto/Hashes.h"
 #include "catapult/crypto/MerkleHashBuilder.h"
 #include "catapult/model/EntityHasher.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 
 namespace catapult { namespace consumers {
 
+	namespace {
+		// region HashCalculatorPartitioner
+
+		class HashCalculatorPartitioner {
+		public:
+			HashCalculatorPartitioner() : HashCalculatorPartitioner(nullptr, 0)
+			{}
+
+			HashCalculatorPartitioner(thread::IoThreadPool* pPool, uint32_t minBatchSize)
+					: m_pPool(pPool)
+					, m_minBatchSize(minBatchSize)
+			{}
+
+		public:
+			template<typename TItems, typename TAction>
+			void forEach(TItems& items, TAction action) const {
+				auto numPartitions = calculateNumPartitions(items.size());
+				if (numPartitions <= 1) {
+					for (auto& item : items)
+						action(item);
+
+					return;
+				}
+
+				// note: action can be captured by reference because all partitions are processed before returning
+				thread::ParallelFor(m_pPool->ioContext(), items, numPartitions, [&action](auto& item, auto) {
+					action(item);
+					return true;
+				}).get();
+			}
+
+		private:
+			size_t calculateNumPartitions(size_t numItems) const {
+				if (!m_pPool || 0 == m_minBatchSize)
+					return 1;
+
+				return std::min<size_t>(m_pPool->numWorkerThreads(), numItems / m_minBatchSize);
+			}
+
+		private:
+			thread::IoThreadPool* m_pPool;
+			uint32_t m_minBatchSize;
+		};
+
+		// endregion
+	}
+
+	// region BlockHashCalculatorConsumer
+
 	namespace {
 		class BlockHashCalculatorConsumer {
 		public:
 			BlockHashCalculatorConsumer(
 					const GenerationHashSeed& generationHashSeed,
-					const model::TransactionRegistry& transactionRegistry)
+					const model::TransactionRegistry& transactionRegistry,
+					const HashCalculatorPartitioner& partitioner)
 					: m_generationHashSeed(generationHashSeed)
 					, m_transactionRegistry(transactionRegistry)
+					, m_partitioner(partitioner)
 			{}
 
 		public:
@@ -43,49 +96,78 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
+				// note that disruptor input elements have been extracted from a packet (or created within this
+				// process), so their sizes have already been validated
+				// (transactions are iterated on the calling thread so that any iteration failure is propagated to the caller)
+				std::vector<model::TransactionElement*> transactionElementPointers;
 				for (auto& element : elements) {
-					// note that disruptor input elements have been extracted from a packet (or created within this
-					// process), so their sizes have already been validated
-					crypto::MerkleHashBuilder transactionsHashBuilder;
-					for (const auto& transaction : element.Block.Transactions()) {
-						model::TransactionElement transactionElement(transaction);
-						model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, transactionElement);
-						element.Transactions.push_back(transactionElement);
+					for (const auto& transaction : element.Block.Transactions())
+						element.Transactions.push_back(model::TransactionElement(transaction));
+
+					for (auto& transactionElement : element.Transactions)
+						transactionElementPointers.push_back(&transactionElement);
+				}
+
+				// calculate all transaction hashes, which are independent of each other
+				m_partitioner.forEach(transactionElementPointers, [this](auto* pTransactionElement) {
+					model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, *pTransactionElement);
+				});
 
+				// check all block transactions hashes and calculate all block hashes
+				std::atomic_bool hasTransactionsHashMismatch(false);
+				m_partitioner.forEach(elements, [&hasTransactionsHashMismatch](auto& element) {
+					crypto::MerkleHashBuilder transactionsHashBuilder(element.Transactions.size());
+					for (const auto& transactionElement : element.Transactions)
 						transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
-					}
 
 					Hash256 transactionsHash;
 					transactionsHashBuilder.final(transactionsHash);
-					if (element.Block.TransactionsHash != transactionsHash)
-						return Abort(Failure_Consumer_Block_Transactions_Hash_Mismatch);
+					if (element.Block.TransactionsHash != transactionsHash) {
+						hasTransactionsHashMismatch = true;
+						return;
+					}
 
 					element.EntityHash = model::CalculateHash(element.Block);
-				}
+				});
 
-				return Continue();
+				return hasTransactionsHashMismatch ? Abort(Failure_Consumer_Block_Transactions_Hash_Mismatch) : Continue();
 			}
 
 		private:
 			GenerationHashSeed m_generationHashSeed;
 			const model::TransactionRegistry& m_transactionRegistry;
+			HashCalculatorPartitioner m_partitioner;
 		};
 	}
 
 	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
 			const GenerationHashSeed& generationHashSeed,
 			const model::TransactionRegistry& transactionRegistry) {
-		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry);
+		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry, HashCalculatorPartitioner());
+	}
+
+	disruptor::BlockConsumer CreateBlockHashCalculatorConsumer(
+			const GenerationHashSeed& generationHashSeed,
+			const model::TransactionRegistry& transactionRegistry,
+			thread::IoThreadPool& pool,
+			uint32_t minBatchSize) {
+		return BlockHashCalculatorConsumer(generationHashSeed, transactionRegistry, HashCalculatorPartitioner(&pool, minBatchSize));
 	}
 
+	// endregion
+
+	// region TransactionHashCalculatorConsumer
+
 	namespace {
 		class TransactionHashCalculatorConsumer {
 		public:
 			TransactionHashCalculatorConsumer(
 					const GenerationHashSeed& generationHashSeed,
-					const model::TransactionRegistry& transactionRegistry)
+					const model::TransactionRegistry& transactionRegistry,
+					const HashCalculatorPartitioner& partitioner)
 					: m_generationHashSeed(generationHashSeed)
 					, m_transactionRegistry(transactionRegistry)
+					, m_partitioner(partitioner)
 			{}
 
 		public:
@@ -93,8 +175,9 @@ namespace catapult { namespace consumers {
 				if (elements.empty())
 					return Abort(Failure_Consumer_Empty_Input);
 
-				for (auto& element : elements)
+				m_partitioner.forEach(elements, [this](auto& element) {
 					model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, element);
+				});
 
 				return Continue();
 			}
@@ -102,12 +185,23 @@ namespace catapult { namespace consumers {
 		private:
 			GenerationHashSeed m_generationHashSeed;
 			const model::TransactionRegistry& m_transactionRegistry;
+			HashCalculatorPartitioner m_partitioner;
 		};
 	}
 
 	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
 			const GenerationHashSeed& generationHashSeed,
 			const model::TransactionRegistry& transactionRegistry) {
-		return TransactionHashCalculatorConsumer(generationHashSeed, transactionRegistry);
+		return TransactionHashCalculatorConsumer(generationHashSeed, transactionRegistry, HashCalculatorPartitioner());
 	}
+
+	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
+			const GenerationHashSeed& generationHashSeed,
+			const model::TransactionRegistry& transactionRegistry,
+			thread::IoThreadPool& pool,
+			uint32_t minBatchSize) {
+		return TransactionHashCalculatorConsumer(generationHashSeed, transactionRegistry, HashCalculatorPartitioner(&pool, minBatchSize));
+	}
+
+	// endregion
 }}
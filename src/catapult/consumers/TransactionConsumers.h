@@ -39,6 +39,15 @@ namespace catapult { namespace consumers {
 			const GenerationHashSeed& generationHashSeed,
 			const model::TransactionRegistry& transactionRegistry);
 
+	/// Creates a consumer that calculates hashes of all entities using \a transactionRegistry for the network with the specified
+	/// generation hash seed (\a generationHashSeed).
+	/// Hashes are calculated in parallel using \a pool when each thread can be assigned at least \a minBatchSize entities.
+	disruptor::TransactionConsumer CreateTransactionHashCalculatorConsumer(
+			const GenerationHashSeed& generationHashSeed,
+			const model::TransactionRegistry& transactionRegistry,
+			thread::IoThreadPool& pool,
+			uint32_t minBatchSize);
+
 	/// Creates a consumer that checks entities for previous processing based on their hash.
 	/// \a timeSupplier is used for generating timestamps and \a options specifies additional cache options.
 	/// \a knownHashPredicate returns \c true for known hashes.
@@ -391,5 +391,41 @@ namespace catapult { namespace crypto {
 		return true;
 	}
 
+	std::vector<bool> VerifyMulti(const RandomFiller& randomFiller, const BmTreeSignatureInput* pSignatureInputs, size_t count) {
+		// batch verification operates on ed25519 keys and signatures, so copy the (root, bottom) pairs of each input upfront;
+		// all vectors are sized before taking references to their elements, which must remain stable
+		std::vector<Key> publicKeys(2 * count);
+		std::vector<Signature> signatures(2 * count);
+		std::vector<uint64_t> keyIds(count);
+		for (auto i = 0u; i < count; ++i) {
+			const auto& signature = pSignatureInputs[i].Signature;
+			publicKeys[2 * i] = signature.Root.ParentPublicKey.copyTo<Key>();
+			publicKeys[2 * i + 1] = signature.Bottom.ParentPublicKey.copyTo<Key>();
+			signatures[2 * i] = signature.Root.Signature.copyTo<Signature>();
+			signatures[2 * i + 1] = signature.Bottom.Signature.copyTo<Signature>();
+			keyIds[i] = pSignatureInputs[i].KeyIdentifier.KeyId;
+		}
+
+		std::vector<SignatureInput> signatureInputs;
+		signatureInputs.reserve(2 * count);
+		for (auto i = 0u; i < count; ++i) {
+			const auto& input = pSignatureInputs[i];
+			const auto& bottomPublicKey = input.Signature.Bottom.ParentPublicKey;
+			signatureInputs.push_back({ publicKeys[2 * i], { bottomPublicKey, ToBuffer(keyIds[i]) }, signatures[2 * i] });
+			signatureInputs.push_back({ publicKeys[2 * i + 1], { input.Buffer }, signatures[2 * i + 1] });
+		}
+
+		auto verifyResultsPair = crypto::VerifyMulti(randomFiller, signatureInputs.data(), signatureInputs.size());
+
+		std::vector<bool> results(count, true);
+		if (verifyResultsPair.second)
+			return results;
+
+		for (auto i = 0u; i < count; ++i)
+			results[i] = verifyResultsPair.first[2 * i] && verifyResultsPair.first[2 * i + 1];
+
+		return results;
+	}
+
 	// endregion
 }}
@@ -22,7 +22,7 @@
 #pragma once
 #include "BmOptions.h"
 #include "BmTreeSignature.h"
-#include "catapult/crypto/KeyPair.h"
+#include "catapult/crypto/Signer.h"
 #include "catapult/io/SeekableStream.h"
 #include <memory>
 
@@ -88,4 +88,22 @@ namespace catapult { namespace crypto {
 
 	/// Verifies \a signature of \a buffer at \a keyIdentifier.
 	bool Verify(const BmTreeSignature& signature, const BmKeyIdentifier& keyIdentifier, const RawBuffer& buffer);
+
+	/// Bellare-Miner tree signature input.
+	struct BmTreeSignatureInput {
+		/// Signature.
+		const BmTreeSignature& Signature;
+
+		/// Key identifier.
+		BmKeyIdentifier KeyIdentifier;
+
+		/// Data buffer.
+		RawBuffer Buffer;
+	};
+
+	/// Verifies that all \a count signatures pointed to by \a pSignatureInputs are valid.
+	/// \a randomFiller is used to generate random bytes.
+	/// Returns a vector of bools that indicates the verification result for each individual signature.
+	/// \note Root and bottom signatures of all inputs are verified together as a single batch.
+	std::vector<bool> VerifyMulti(const RandomFiller& randomFiller, const BmTreeSignatureInput* pSignatureInputs, size_t count);
 }}
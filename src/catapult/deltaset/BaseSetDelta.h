@@ -28,6 +28,7 @@
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -64,6 +65,12 @@ namespace catapult { namespace deltaset {
 		Removed
 	};
 
+	/// Loads all elements in \a set identified by \a keys in a single batched lookup and passes each found element to \a consumer.
+	/// \note Default implementation is a no-op because lookups in memory based sets are already fast.
+	template<typename TSet, typename TKey, typename TConsumer>
+	void PrefetchBaseSet(const TSet&, const std::vector<TKey>&, TConsumer) {
+	}
+
 	template<typename TSetTraits>
 	class BaseSetDeltaIterationView;
 
@@ -163,6 +170,10 @@ namespace catapult { namespace deltaset {
 		}
 
 		FindConstIterator find(const KeyType& key, ImmutableTypeTag) const {
+			auto prefetchedIter = m_prefetchedElements.find(key);
+			if (m_prefetchedElements.cend() != prefetchedIter)
+				return FindConstIterator(std::move(prefetchedIter));
+
 			auto originalIter = m_originalElements.find(key);
 			return m_originalElements.cend() != originalIter ? FindConstIterator(std::move(originalIter)) : FindConstIterator();
 		}
@@ -179,7 +190,7 @@ namespace catapult { namespace deltaset {
 		/// Searches for \a key in this set.
 		/// Returns \c true if it is found or \c false if it is not found.
 		bool contains(const KeyType& key) const {
-			return !Contains(m_removedElements, key) && (Contains(m_addedElements, key) || Contains(m_originalElements, key));
+			return !Contains(m_removedElements, key) && (Contains(m_addedElements, key) || containsOriginal(key));
 		}
 
 	private:
@@ -188,6 +199,34 @@ namespace catapult { namespace deltaset {
 			return set.cend() != set.find(key);
 		}
 
+		bool containsOriginal(const KeyType& key) const {
+			return Contains(m_prefetchedElements, key) || Contains(m_originalElements, key);
+		}
+
+	public:
+		/// Loads all original elements identified by \a keys into memory so that subsequent lookups of them
+		/// do not need to access the original set.
+		/// \note This only has an effect when the original set supports batched lookups (e.g. storage based sets).
+		void prefetch(const std::vector<KeyType>& keys) {
+			std::vector<KeyType> pendingKeys;
+			for (const auto& key : keys) {
+				if (Contains(m_removedElements, key) || Contains(m_addedElements, key))
+					continue;
+
+				if (Contains(m_copiedElements, key) || Contains(m_prefetchedElements, key))
+					continue;
+
+				pendingKeys.push_back(key);
+			}
+
+			if (pendingKeys.empty())
+				return;
+
+			PrefetchBaseSet(m_originalElements, pendingKeys, [this](const auto& element) {
+				m_prefetchedElements.insert(element);
+			});
+		}
+
 	public:
 		/// Inserts \a element into this set.
 		/// \note The algorithm relies on the data used for comparing elements being immutable.
@@ -215,7 +254,7 @@ namespace catapult { namespace deltaset {
 				m_removedElements.erase(removedIter);
 				pTargetElements = Contains(m_addedElements, key) ? &m_addedElements : &m_copiedElements;
 				insertResult = InsertResult::Unremoved;
-			} else if (Contains(m_originalElements, key)) {
+			} else if (containsOriginal(key)) {
 				pTargetElements = &m_copiedElements; // original element, possibly modified
 				insertResult = InsertResult::Updated;
 			} else {
@@ -243,7 +282,7 @@ namespace catapult { namespace deltaset {
 				return InsertResult::Unremoved;
 			}
 
-			if (Contains(m_originalElements, key) || Contains(m_addedElements, key))
+			if (containsOriginal(key) || Contains(m_addedElements, key))
 				return InsertResult::Redundant;
 
 			markKey(key);
@@ -311,6 +350,7 @@ namespace catapult { namespace deltaset {
 			m_addedElements.clear();
 			m_removedElements.clear();
 			m_copiedElements.clear();
+			m_prefetchedElements.clear();
 
 			m_generationId = 1;
 			m_keyGenerationIdMap.clear();
@@ -361,6 +401,7 @@ namespace catapult { namespace deltaset {
 		MemorySetType m_addedElements;
 		MemorySetType m_removedElements;
 		MemorySetType m_copiedElements;
+		MemorySetType m_prefetchedElements;
 
 		uint32_t m_generationId;
 		typename KeyGenerationIdMap<SetType>::Type m_keyGenerationIdMap;
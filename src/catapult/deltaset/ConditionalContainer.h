@@ -23,6 +23,7 @@
 #include "BaseSetCommitPolicy.h"
 #include "DeltaElements.h"
 #include <memory>
+#include <vector>
 
 namespace catapult { namespace deltaset {
 
@@ -155,6 +156,20 @@ namespace catapult { namespace deltaset {
 					: ConditionalIterator(m_pContainer2->find(key), MemoryFlag());
 		}
 
+		/// Loads all elements identified by \a keys in a single batched lookup and passes each found element to \a consumer.
+		/// \note This only has an effect for storage based containers.
+		template<typename TConsumer>
+		void prefetch(const std::vector<typename TKeyTraits::KeyType>& keys, TConsumer consumer) const {
+			if (!m_pContainer1)
+				return;
+
+			auto iterators = m_pContainer1->findAll(keys);
+			for (const auto& iter : iterators) {
+				if (m_pContainer1->cend() != iter)
+					consumer(*iter);
+			}
+		}
+
 	public:
 		/// Applies all changes in \a deltas to the underlying container.
 		void update(const DeltaElements<MemorySetType>& deltas) {
@@ -210,6 +225,17 @@ namespace catapult { namespace deltaset {
 		container.update(deltas);
 	}
 
+	/// Loads all elements in \a container identified by \a keys in a single batched lookup and passes each found element
+	/// to \a consumer.
+	/// \note Specialization for ConditionalContainer.
+	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TKey, typename TConsumer>
+	void PrefetchBaseSet(
+			const ConditionalContainer<TKeyTraits, TStorageSet, TMemorySet>& container,
+			const std::vector<TKey>& keys,
+			TConsumer consumer) {
+		container.prefetch(keys, consumer);
+	}
+
 	/// Optionally prunes \a elements using \a pruningBoundary, which indicates the upper bound of elements to remove.
 	/// \note Specialization for ConditionalContainer.
 	template<typename TKeyTraits, typename TStorageSet, typename TMemorySet, typename TPruningBoundary>
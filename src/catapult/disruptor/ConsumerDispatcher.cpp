@@ -23,11 +23,15 @@
 #include "ConsumerEntry.h"
 #include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/Functional.h"
+#include "catapult/utils/StackTimer.h"
 #include <thread>
 
 namespace catapult { namespace disruptor {
 
 	namespace {
+		constexpr auto Sleep_Duration = std::chrono::milliseconds(10);
+		constexpr uint32_t Num_Spins_Before_Park = 1000;
+
 		const ConsumerDispatcherOptions& CheckOptions(const ConsumerDispatcherOptions& options) {
 			if (!options.DispatcherName || 0 == options.DisruptorSlotCount || utils::FileSize() == options.DisruptorMaxMemorySize)
 				CATAPULT_THROW_INVALID_ARGUMENT("consumer dispatcher options are invalid");
@@ -35,7 +39,11 @@ namespace catapult { namespace disruptor {
 			return options;
 		}
 
-		void LogCompletion(const DisruptorElement& element, const DisruptorBarriers& barriers, size_t elementTraceInterval) {
+		void LogCompletion(
+				const DisruptorElement& element,
+				const DisruptorBarriers& barriers,
+				const StageTimingInspector& stageTimingInspector,
+				size_t elementTraceInterval) {
 			if (!IsIntervalElementId(element.id(), elementTraceInterval))
 				return;
 
@@ -43,7 +51,14 @@ namespace catapult { namespace disruptor {
 			auto maxPosition = barriers[0].position();
 			CATAPULT_LOG(info)
 					<< "completing processing of " << element
-					<< ", last consumer is " << (maxPosition - minPosition) << " elements behind";
+					<< ", last consumer is " << (maxPosition - minPosition) << " elements behind" << std::endl
+					<< stageTimingInspector;
+		}
+
+		void UpdateMax(std::atomic<uint64_t>& maxValue, uint64_t value) {
+			auto currentMaxValue = maxValue.load();
+			while (currentMaxValue < value && !maxValue.compare_exchange_weak(currentMaxValue, value))
+			{}
 		}
 	}
 
@@ -59,23 +74,31 @@ namespace catapult { namespace disruptor {
 			, m_options(options)
 			, m_keepRunning(true)
 			, m_barriers(consumers.size() + 1)
-			, m_disruptor(m_options.DisruptorSlotCount, m_options.ElementTraceInterval)
+			, m_disruptor(m_options.DisruptorSlotCount, m_options.ElementTraceInterval, consumers.size())
 			, m_inspector(inspector)
+			, m_stageTimingInspector(consumers.size())
 			, m_numActiveElements(0)
-			, m_memorySize(0) {
+			, m_memorySize(0)
+			, m_lastElementLatencyMicros(0)
+			, m_maxElementLatencyMicros(0)
+			, m_numParkedConsumers(0) {
 		auto currentLevel = 0u;
 		for (const auto& consumer : consumers) {
 			ConsumerEntry consumerEntry(currentLevel++);
 			m_threads.spawn([pThis = this, consumerEntry, consumer]() mutable {
 				thread::SetThreadName(std::to_string(consumerEntry.level()) + " " + pThis->name());
+				auto numIdleIterations = 0u;
 				while (pThis->m_keepRunning) {
 					auto* pDisruptorElement = pThis->tryNext(consumerEntry);
 					if (!pDisruptorElement) {
-						std::this_thread::sleep_for(std::chrono::milliseconds(10));
+						pThis->wait(consumerEntry, numIdleIterations++);
 						continue;
 					}
 
+					numIdleIterations = 0;
+					pDisruptorElement->markStageEntered(consumerEntry.level());
 					auto result = consumer(pDisruptorElement->input());
+					pDisruptorElement->markStageExited(consumerEntry.level());
 					if (CompletionStatus::Aborted == result.CompletionStatus)
 						pThis->m_disruptor.markSkipped(consumerEntry.position(), result);
 
@@ -93,6 +116,7 @@ namespace catapult { namespace disruptor {
 
 	void ConsumerDispatcher::shutdown() {
 		m_keepRunning = false;
+		notifyParkedConsumers();
 		m_threads.join();
 	}
 
@@ -116,6 +140,22 @@ namespace catapult { namespace disruptor {
 		return utils::FileSize::FromBytes(m_memorySize.load());
 	}
 
+	uint64_t ConsumerDispatcher::lastElementLatencyMicros() const {
+		return m_lastElementLatencyMicros.load();
+	}
+
+	uint64_t ConsumerDispatcher::maxElementLatencyMicros() const {
+		return m_maxElementLatencyMicros.load();
+	}
+
+	const utils::DiagnosticHistogram& ConsumerDispatcher::elementLatencyHistogram() const {
+		return m_elementLatencyHistogram;
+	}
+
+	const StageTimingInspector& ConsumerDispatcher::stageTimingInspector() const {
+		return m_stageTimingInspector;
+	}
+
 	DisruptorElement* ConsumerDispatcher::tryNext(ConsumerEntry& consumerEntry) {
 		while (true) {
 			auto consumerBarrierPosition = m_barriers[consumerEntry.level()].position();
@@ -134,17 +174,61 @@ namespace catapult { namespace disruptor {
 		auto consumerPosition = consumerEntry.position();
 		consumerEntry.advance();
 		m_barriers[consumerEntry.level() + 1].advance();
+		notifyParkedConsumers();
 
 		// if advance was called by the last consumer, then run the inspector on the (current) thread of the last consumer
 		if (consumerEntry.level() + 1 != m_barriers.size() - 1)
 			return;
 
 		auto& element = m_disruptor.elementAt(consumerPosition);
-		LogCompletion(element, m_barriers, m_options.ElementTraceInterval);
+		m_stageTimingInspector.inspect(element);
+		LogCompletion(element, m_barriers, m_stageTimingInspector, m_options.ElementTraceInterval);
 		m_inspector(element.input(), element.completionResult());
 		element.markProcessingComplete();
 	}
 
+	void ConsumerDispatcher::wait(const ConsumerEntry& consumerEntry, uint32_t numIdleIterations) {
+		switch (m_options.WaitStrategy) {
+		case ConsumerWaitStrategy::Spin:
+			std::this_thread::yield();
+			break;
+
+		case ConsumerWaitStrategy::Spin_Then_Park:
+			if (numIdleIterations < Num_Spins_Before_Park)
+				std::this_thread::yield();
+			else
+				park(consumerEntry);
+
+			break;
+
+		default:
+			std::this_thread::sleep_for(Sleep_Duration);
+			break;
+		}
+	}
+
+	void ConsumerDispatcher::park(const ConsumerEntry& consumerEntry) {
+		// register as parked before checking the barrier so that a concurrent barrier advance either is observed by the predicate
+		// or observes the registration and notifies
+		++m_numParkedConsumers;
+		{
+			std::unique_lock<std::mutex> lock(m_parkMutex);
+			m_parkCondition.wait(lock, [this, &consumerEntry]() {
+				return !m_keepRunning || consumerEntry.position() != m_barriers[consumerEntry.level()].position();
+			});
+		}
+
+		--m_numParkedConsumers;
+	}
+
+	void ConsumerDispatcher::notifyParkedConsumers() {
+		if (0 == m_numParkedConsumers)
+			return;
+
+		std::lock_guard<std::mutex> lock(m_parkMutex);
+		m_parkCondition.notify_all();
+	}
+
 	bool ConsumerDispatcher::canProcessNextElement() const {
 		auto minPosition = m_barriers[m_barriers.size() - 1].position();
 		auto maxPosition = m_barriers[0].position();
@@ -159,7 +243,12 @@ namespace catapult { namespace disruptor {
 	}
 
 	ProcessingCompleteFunc ConsumerDispatcher::wrap(const ProcessingCompleteFunc& processingComplete, utils::FileSize inputMemorySize) {
-		return [this, processingComplete, inputMemorySize](auto elementId, const auto& result) {
+		return [this, processingComplete, inputMemorySize, timer = utils::StackTimer()](auto elementId, const auto& result) {
+			auto elementLatencyMicros = timer.micros();
+			m_lastElementLatencyMicros = elementLatencyMicros;
+			UpdateMax(m_maxElementLatencyMicros, elementLatencyMicros);
+			m_elementLatencyHistogram.record(elementLatencyMicros);
+
 			processingComplete(elementId, result);
 
 			m_memorySize -= inputMemorySize.bytes();
@@ -175,28 +264,33 @@ namespace catapult { namespace disruptor {
 
 		auto inputMemorySize = input.memorySize();
 
-		// need to atomically check spare capacity AND add element
-		utils::SpinLockGuard guard(m_addSpinLock);
-		auto isFull = !canProcessNextElement();
-		if (m_options.DisruptorMaxMemorySize.bytes() - m_memorySize < inputMemorySize.bytes()) {
-			CATAPULT_LOG(warning)
-					<< "disruptor memory is full (max = " << m_options.DisruptorMaxMemorySize
-					<< ", current = " << utils::FileSize::FromBytes(m_memorySize) << ")";
-			isFull = true;
-		}
-
-		if (isFull) {
-			if (m_options.ShouldThrowWhenFull)
-				CATAPULT_THROW_RUNTIME_ERROR("consumer is too far behind");
-
-			return 0;
+		DisruptorElementId id;
+		{
+			// need to atomically check spare capacity AND add element
+			utils::SpinLockGuard guard(m_addSpinLock);
+			auto isFull = !canProcessNextElement();
+			if (m_options.DisruptorMaxMemorySize.bytes() - m_memorySize < inputMemorySize.bytes()) {
+				CATAPULT_LOG(warning)
+						<< "disruptor memory is full (max = " << m_options.DisruptorMaxMemorySize
+						<< ", current = " << utils::FileSize::FromBytes(m_memorySize) << ")";
+				isFull = true;
+			}
+
+			if (isFull) {
+				if (m_options.ShouldThrowWhenFull)
+					CATAPULT_THROW_RUNTIME_ERROR("consumer is too far behind");
+
+				return 0;
+			}
+
+			m_memorySize += inputMemorySize.bytes();
+			++m_numActiveElements;
+
+			id = m_disruptor.add(std::move(input), wrap(processingComplete, inputMemorySize));
+			m_barriers[0].advance();
 		}
 
-		m_memorySize += inputMemorySize.bytes();
-		++m_numActiveElements;
-
-		auto id = m_disruptor.add(std::move(input), wrap(processingComplete, inputMemorySize));
-		m_barriers[0].advance();
+		notifyParkedConsumers();
 		return id;
 	}
 
@@ -24,9 +24,13 @@
 #include "Disruptor.h"
 #include "DisruptorConsumer.h"
 #include "DisruptorInspector.h"
+#include "StageTimingInspector.h"
 #include "catapult/thread/ThreadGroup.h"
+#include "catapult/utils/DiagnosticHistogram.h"
 #include "catapult/utils/NamedObject.h"
 #include <atomic>
+#include <condition_variable>
+#include <mutex>
 
 namespace catapult { namespace disruptor { class ConsumerEntry; } }
 
@@ -74,11 +78,29 @@ namespace catapult { namespace disruptor {
 		/// Gets the cumulative size of all elements currently in the disruptor.
 		utils::FileSize memorySize() const;
 
+		/// Gets the time (in microseconds) between adding and completing the most recently completed element.
+		uint64_t lastElementLatencyMicros() const;
+
+		/// Gets the maximum time (in microseconds) between adding and completing any element.
+		uint64_t maxElementLatencyMicros() const;
+
+		/// Gets the histogram of times (in microseconds) between adding and completing elements.
+		const utils::DiagnosticHistogram& elementLatencyHistogram() const;
+
+		/// Gets the inspector aggregating per-consumer queue wait and processing times.
+		const StageTimingInspector& stageTimingInspector() const;
+
 	private:
 		DisruptorElement* tryNext(ConsumerEntry& consumerEntry);
 
 		void advance(ConsumerEntry& consumerEntry);
 
+		void wait(const ConsumerEntry& consumerEntry, uint32_t numIdleIterations);
+
+		void park(const ConsumerEntry& consumerEntry);
+
+		void notifyParkedConsumers();
+
 		bool canProcessNextElement() const;
 
 		ProcessingCompleteFunc wrap(const ProcessingCompleteFunc& processingComplete, utils::FileSize inputMemorySize);
@@ -89,10 +111,18 @@ namespace catapult { namespace disruptor {
 		DisruptorBarriers m_barriers;
 		Disruptor m_disruptor;
 		DisruptorInspector m_inspector;
+		StageTimingInspector m_stageTimingInspector;
 		thread::ThreadGroup m_threads;
 		std::atomic<size_t> m_numActiveElements;
 		std::atomic<uint64_t> m_memorySize;
+		std::atomic<uint64_t> m_lastElementLatencyMicros;
+		std::atomic<uint64_t> m_maxElementLatencyMicros;
+		utils::DiagnosticHistogram m_elementLatencyHistogram;
 
 		utils::SpinLock m_addSpinLock; // lock to serialize access to Disruptor::add
+
+		std::atomic<size_t> m_numParkedConsumers;
+		std::mutex m_parkMutex;
+		std::condition_variable m_parkCondition;
 	};
 }}
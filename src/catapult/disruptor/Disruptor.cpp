@@ -31,14 +31,15 @@ namespace catapult { namespace disruptor {
 	//  2. add is guarded by a lock inside ConsumerDispatcher, which checks if the Disruptor is full
 	//  3. markSkipped and isSkipped are guarded by a lock inside DisruptorElement
 
-	Disruptor::Disruptor(size_t disruptorSize, size_t elementTraceInterval)
+	Disruptor::Disruptor(size_t disruptorSize, size_t elementTraceInterval, size_t numStages)
 			: m_elementTraceInterval(elementTraceInterval)
+			, m_numStages(numStages)
 			, m_container(disruptorSize)
 			, m_allElementsCount(0)
 	{}
 
 	DisruptorElementId Disruptor::add(ConsumerInput&& input, const ProcessingCompleteFunc& processingComplete) {
-		auto element = DisruptorElement(std::move(input), ++m_allElementsCount, processingComplete);
+		auto element = DisruptorElement(std::move(input), ++m_allElementsCount, processingComplete, m_numStages);
 		if (IsIntervalElementId(element.id(), m_elementTraceInterval))
 			CATAPULT_LOG(debug) << "disruptor queuing " << element;
 
@@ -35,8 +35,8 @@ namespace catapult { namespace disruptor {
 	class Disruptor : utils::NonCopyable {
 	public:
 		/// Creates disruptor container able to hold \a disruptorSize elements with optional queue logging every
-		/// \a elementTraceInterval elements.
-		explicit Disruptor(size_t disruptorSize, size_t elementTraceInterval = 1);
+		/// \a elementTraceInterval elements. Each element tracks the enter and exit times of \a numStages stages.
+		explicit Disruptor(size_t disruptorSize, size_t elementTraceInterval = 1, size_t numStages = 0);
 
 	public:
 		/// Adds \a input to the underlying container and returns the assigned disruptor element id.
@@ -71,6 +71,7 @@ namespace catapult { namespace disruptor {
 
 	private:
 		size_t m_elementTraceInterval;
+		size_t m_numStages;
 		utils::CircularBuffer<DisruptorElement> m_container;
 		std::atomic<uint64_t> m_allElementsCount;
 	};
@@ -22,9 +22,23 @@
 #pragma once
 #include "ConsumerInput.h"
 #include "catapult/utils/SpinLock.h"
+#include <chrono>
+#include <vector>
 
 namespace catapult { namespace disruptor {
 
+	/// Clock used for timing disruptor stages.
+	using DisruptorClock = std::chrono::steady_clock;
+
+	/// Times at which a disruptor stage (consumer) started and finished processing an element.
+	struct DisruptorStageTimes {
+		/// Time at which the stage started processing the element.
+		DisruptorClock::time_point EnterTime;
+
+		/// Time at which the stage finished processing the element.
+		DisruptorClock::time_point ExitTime;
+	};
+
 	/// Augments consumer input with disruptor metadata.
 	class DisruptorElement {
 	public:
@@ -33,14 +47,22 @@ namespace catapult { namespace disruptor {
 				: m_id(static_cast<uint64_t>(-1))
 				, m_processingComplete([](auto, auto) {})
 				, m_pSpinLock(std::make_unique<utils::SpinLock>())
+				, m_addTime(DisruptorClock::now())
 		{}
 
 		/// Creates a disruptor element around \a input with \a id and a completion handler \a processingComplete.
-		DisruptorElement(ConsumerInput&& input, DisruptorElementId id, const ProcessingCompleteFunc& processingComplete)
+		/// Enter and exit times are tracked for \a numStages stages.
+		DisruptorElement(
+				ConsumerInput&& input,
+				DisruptorElementId id,
+				const ProcessingCompleteFunc& processingComplete,
+				size_t numStages = 0)
 				: m_input(std::move(input))
 				, m_id(id)
 				, m_processingComplete(processingComplete)
 				, m_pSpinLock(std::make_unique<utils::SpinLock>())
+				, m_addTime(DisruptorClock::now())
+				, m_stageTimes(numStages)
 		{}
 
 	public:
@@ -71,6 +93,17 @@ namespace catapult { namespace disruptor {
 			return m_result;
 		}
 
+		/// Gets the time at which the element was created (added).
+		DisruptorClock::time_point addTime() const {
+			return m_addTime;
+		}
+
+		/// Gets the enter and exit times of all stages.
+		/// \note Times of stages that did not process the element are default (epoch) time points.
+		const std::vector<DisruptorStageTimes>& stageTimes() const {
+			return m_stageTimes;
+		}
+
 	public:
 		/// Marks the element as skipped at \a position with \a result.
 		void markSkipped(PositionType position, const ConsumerResult& result) {
@@ -81,6 +114,19 @@ namespace catapult { namespace disruptor {
 			m_result.FinalConsumerPosition = position;
 		}
 
+		/// Marks the start of processing by \a stage.
+		/// \note Each stage only modifies its own times, so no lock is required.
+		void markStageEntered(size_t stage) {
+			if (stage < m_stageTimes.size())
+				m_stageTimes[stage].EnterTime = DisruptorClock::now();
+		}
+
+		/// Marks the end of processing by \a stage.
+		void markStageExited(size_t stage) {
+			if (stage < m_stageTimes.size())
+				m_stageTimes[stage].ExitTime = DisruptorClock::now();
+		}
+
 		/// Calls the completion handler for the element.
 		void markProcessingComplete() {
 			m_processingComplete(m_id, m_result);
@@ -92,6 +138,8 @@ namespace catapult { namespace disruptor {
 		ProcessingCompleteFunc m_processingComplete;
 		ConsumerCompletionResult m_result;
 		std::unique_ptr<utils::SpinLock> m_pSpinLock; // unique_ptr to allow moving of element
+		DisruptorClock::time_point m_addTime;
+		std::vector<DisruptorStageTimes> m_stageTimes;
 	};
 
 	/// Insertion operator for outputting \a element to \a out.
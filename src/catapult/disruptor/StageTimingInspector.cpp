@@ -0,0 +1,125 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "StageTimingInspector.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <atomic>
+#include <ostream>
+
+namespace catapult { namespace disruptor {
+
+	namespace {
+		uint64_t ToMicros(DisruptorClock::duration duration) {
+			return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+		}
+
+		uint64_t Average(uint64_t total, uint64_t count) {
+			return 0 == count ? 0 : total / count;
+		}
+
+		uint64_t PerSecond(uint64_t count, uint64_t micros) {
+			return 0 == micros ? 0 : count * 1'000'000 / micros;
+		}
+
+		uint64_t Percentage(uint64_t part, uint64_t total) {
+			return 0 == total ? 0 : part * 100 / total;
+		}
+	}
+
+	struct StageTimingInspector::StageTimings {
+		std::atomic<uint64_t> NumElements{};
+		std::atomic<uint64_t> TotalWaitMicros{};
+		std::atomic<uint64_t> TotalProcessingMicros{};
+		utils::DiagnosticHistogram WaitMicros;
+		utils::DiagnosticHistogram ProcessingMicros;
+	};
+
+	StageTimingInspector::StageTimingInspector(size_t numStages)
+			: m_numStages(numStages)
+			, m_pStageTimings(std::make_unique<StageTimings[]>(numStages))
+			, m_startTime(DisruptorClock::now())
+	{}
+
+	StageTimingInspector::~StageTimingInspector() = default;
+
+	size_t StageTimingInspector::numStages() const {
+		return m_numStages;
+	}
+
+	uint64_t StageTimingInspector::elapsedMicros() const {
+		return ToMicros(DisruptorClock::now() - m_startTime);
+	}
+
+	StageTimingStatistics StageTimingInspector::statistics(size_t stage) const {
+		if (stage >= m_numStages)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("stage is out of range", stage);
+
+		const auto& stageTimings = m_pStageTimings[stage];
+		StageTimingStatistics statistics;
+		statistics.NumElements = stageTimings.NumElements;
+		statistics.TotalWaitMicros = stageTimings.TotalWaitMicros;
+		statistics.TotalProcessingMicros = stageTimings.TotalProcessingMicros;
+		statistics.WaitMicros = stageTimings.WaitMicros.values();
+		statistics.ProcessingMicros = stageTimings.ProcessingMicros.values();
+		return statistics;
+	}
+
+	void StageTimingInspector::inspect(const DisruptorElement& element) {
+		const auto& stageTimes = element.stageTimes();
+		auto previousExitTime = element.addTime();
+		for (auto i = 0u; i < std::min(m_numStages, stageTimes.size()); ++i) {
+			// skip stages that did not process the element (e.g. stages following an aborting stage)
+			const auto& times = stageTimes[i];
+			if (DisruptorClock::time_point() == times.EnterTime || DisruptorClock::time_point() == times.ExitTime)
+				continue;
+
+			auto waitMicros = ToMicros(times.EnterTime - previousExitTime);
+			auto processingMicros = ToMicros(times.ExitTime - times.EnterTime);
+			previousExitTime = times.ExitTime;
+
+			auto& stageTimings = m_pStageTimings[i];
+			++stageTimings.NumElements;
+			stageTimings.TotalWaitMicros += waitMicros;
+			stageTimings.TotalProcessingMicros += processingMicros;
+			stageTimings.WaitMicros.record(waitMicros);
+			stageTimings.ProcessingMicros.record(processingMicros);
+		}
+	}
+
+	std::ostream& operator<<(std::ostream& out, const StageTimingInspector& inspector) {
+		auto elapsedMicros = inspector.elapsedMicros();
+		out << "stage timings over " << elapsedMicros / 1000 << "ms (wait and processing avg/p99 in us)";
+		for (auto i = 0u; i < inspector.numStages(); ++i) {
+			auto statistics = inspector.statistics(i);
+			out
+					<< std::endl << " stage " << i << ": " << statistics.NumElements << " elements"
+					<< " (" << PerSecond(statistics.NumElements, elapsedMicros) << "/s)"
+					<< ", wait " << Average(statistics.TotalWaitMicros, statistics.NumElements)
+					<< "/" << statistics.WaitMicros.percentile(99)
+					<< ", processing " << Average(statistics.TotalProcessingMicros, statistics.NumElements)
+					<< "/" << statistics.ProcessingMicros.percentile(99)
+					<< ", busy " << Percentage(statistics.TotalProcessingMicros, elapsedMicros) << "%";
+		}
+
+		return out;
+	}
+}}
@@ -0,0 +1,84 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "DisruptorElement.h"
+#include "catapult/utils/DiagnosticHistogram.h"
+#include "catapult/utils/NonCopyable.h"
+#include <iosfwd>
+#include <memory>
+
+namespace catapult { namespace disruptor {
+
+	/// Aggregated timing statistics of a single disruptor stage (consumer).
+	struct StageTimingStatistics {
+		/// Number of elements processed by the stage.
+		uint64_t NumElements = 0;
+
+		/// Total time (in microseconds) elements waited in the queue before being processed by the stage.
+		uint64_t TotalWaitMicros = 0;
+
+		/// Total time (in microseconds) the stage spent processing elements.
+		uint64_t TotalProcessingMicros = 0;
+
+		/// Queue wait times (in microseconds).
+		utils::DiagnosticHistogramValues WaitMicros;
+
+		/// Processing times (in microseconds).
+		utils::DiagnosticHistogramValues ProcessingMicros;
+	};
+
+	/// Inspector that aggregates per-stage queue wait and processing times of completed disruptor elements.
+	/// \note The queue wait time of a stage is measured from the exit of the closest preceding stage that processed the element
+	///       (or from the time the element was added).
+	class StageTimingInspector : public utils::NonCopyable {
+	public:
+		/// Creates an inspector for \a numStages stages.
+		explicit StageTimingInspector(size_t numStages);
+
+		/// Destroys the inspector.
+		~StageTimingInspector();
+
+	public:
+		/// Gets the number of stages.
+		size_t numStages() const;
+
+		/// Gets the time (in microseconds) since the inspector was created.
+		uint64_t elapsedMicros() const;
+
+		/// Gets the statistics for \a stage.
+		StageTimingStatistics statistics(size_t stage) const;
+
+	public:
+		/// Aggregates the stage times of (completed) \a element.
+		void inspect(const DisruptorElement& element);
+
+	private:
+		struct StageTimings;
+
+		size_t m_numStages;
+		std::unique_ptr<StageTimings[]> m_pStageTimings;
+		DisruptorClock::time_point m_startTime;
+	};
+
+	/// Insertion operator for outputting a summary of the statistics of all stages of \a inspector to \a out.
+	std::ostream& operator<<(std::ostream& out, const StageTimingInspector& inspector);
+}}
@@ -53,6 +53,15 @@ namespace catapult { namespace extensions {
 		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " ELEM MEM", [](const auto& dispatcher) {
 			return dispatcher.memorySize().megabytes();
 		});
+		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " ELEM LAT", [](const auto& dispatcher) {
+			return dispatcher.lastElementLatencyMicros();
+		});
+		locator.registerServiceCounter<ConsumerDispatcher>(dispatcherName, counterPrefix + " ELEM LATM", [](const auto& dispatcher) {
+			return dispatcher.maxElementLatencyMicros();
+		});
+		locator.registerServiceHistogram<ConsumerDispatcher>(dispatcherName, counterPrefix + " ELEM HIST", [](const auto& dispatcher) {
+			return dispatcher.elementLatencyHistogram().values();
+		});
 	}
 
 	thread::Task CreateBatchTransactionTask(TransactionBatchRangeDispatcher& dispatcher, const std::string& name) {
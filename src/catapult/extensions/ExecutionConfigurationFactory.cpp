@@ -31,6 +31,7 @@ namespace catapult { namespace extensions {
 		executionConfig.pObserver = pluginManager.createObserver();
 		executionConfig.pValidator = pluginManager.createStatefulValidator();
 		executionConfig.pNotificationPublisher = pluginManager.createNotificationPublisher();
+		executionConfig.EnableAccountPrefetch = pluginManager.storageConfig().PreferCacheDatabase;
 		executionConfig.ResolverContextFactory = [&pluginManager](const auto& cache) {
 			return pluginManager.createResolverContext(cache);
 		};
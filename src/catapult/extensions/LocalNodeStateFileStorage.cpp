@@ -23,6 +23,7 @@
 #include "LocalNodeChainScore.h"
 #include "LocalNodeStateRef.h"
 #include "NemesisBlockLoader.h"
+#include "catapult/cache/CacheChangesStorage.h"
 #include "catapult/cache/CacheStorage.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/SupplementalDataStorage.h"
@@ -34,7 +35,15 @@
 #include "catapult/io/FilesystemUtils.h"
 #include "catapult/io/IndexFile.h"
 #include "catapult/plugins/PluginManager.h"
+#include "catapult/subscribers/StateChangeInfo.h"
+#include "catapult/subscribers/StateChangeReader.h"
+#include "catapult/subscribers/StateChangeSubscriber.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ParallelFor.h"
 #include "catapult/utils/StackLogger.h"
+#include "catapult/utils/StackTimer.h"
+#include <algorithm>
+#include <thread>
 
 namespace catapult { namespace extensions {
 
@@ -43,10 +52,61 @@ namespace catapult { namespace extensions {
 	namespace {
 		constexpr size_t Default_Loader_Batch_Size = 100'000;
 		constexpr auto Supplemental_Data_Filename = "supplemental.dat";
+		constexpr auto State_Change_Journal_Filename = "state_changes.dat";
+		constexpr auto State_Changes_Filename_Prefix = "changes_";
 
 		std::string GetStorageFilename(const cache::CacheStorage& storage) {
 			return storage.name() + ".dat";
 		}
+
+		std::string GetStateChangesFilename(size_t index) {
+			return State_Changes_Filename_Prefix + std::to_string(index) + ".dat";
+		}
+
+		size_t CountStateChangesFiles(const config::CatapultDirectory& directory) {
+			size_t numFiles = 0;
+			while (std::filesystem::exists(directory.file(GetStateChangesFilename(numFiles + 1))))
+				++numFiles;
+
+			return numFiles;
+		}
+
+		bool IsStateChangesFilename(const std::string& filename) {
+			return 0 == filename.rfind(State_Changes_Filename_Prefix, 0);
+		}
+
+		// sub cache storages are independent files, so process each one on a separate thread of a temporary pool
+		// (exceptions are captured on the worker threads and the first one is rethrown on the calling thread)
+		template<typename TStorages, typename TAction>
+		void ForEachStorageParallel(const TStorages& storages, const char* operationName, TAction action) {
+			if (storages.empty())
+				return;
+
+			auto numThreads = std::min<size_t>(storages.size(), std::max(1u, std::thread::hardware_concurrency()));
+			auto pPool = thread::CreateIoThreadPool(numThreads, "state io");
+			pPool->start();
+
+			std::vector<std::exception_ptr> exceptions(storages.size());
+			auto processStorage = [operationName, action, &exceptions](const auto& pStorage, auto index) {
+				try {
+					utils::StackTimer stopwatch;
+					action(*pStorage);
+					CATAPULT_LOG(info) << operationName << " " << pStorage->name() << " in " << stopwatch.millis() << "ms";
+				} catch (...) {
+					exceptions[index] = std::current_exception();
+				}
+
+				return true;
+			};
+
+			thread::ParallelFor(pPool->ioContext(), storages, storages.size(), processStorage).get();
+			pPool->join();
+
+			for (const auto& pException : exceptions) {
+				if (pException)
+					std::rethrow_exception(pException);
+			}
+		}
 	}
 
 	// endregion
@@ -94,6 +154,50 @@ namespace catapult { namespace extensions {
 	// region LoadStateFromDirectory
 
 	namespace {
+		class StateChangeApplyingSubscriber : public subscribers::StateChangeSubscriber {
+		public:
+			explicit StateChangeApplyingSubscriber(cache::CatapultCache& cache)
+					: m_cache(cache)
+					, m_changesStorages(cache.changesStorages())
+			{}
+
+		public:
+			const subscribers::CacheChangesStorages& changesStorages() const {
+				return m_changesStorages;
+			}
+
+		public:
+			void notifyScoreChange(const model::ChainScore&) override {
+				// chain score is restored from supplemental data
+			}
+
+			void notifyStateChange(const subscribers::StateChangeInfo& stateChangeInfo) override {
+				for (const auto& pStorage : m_changesStorages)
+					pStorage->apply(stateChangeInfo.CacheChanges);
+
+				auto delta = m_cache.createDelta();
+				m_cache.commit(stateChangeInfo.Height);
+			}
+
+		private:
+			cache::CatapultCache& m_cache;
+			subscribers::CacheChangesStorages m_changesStorages;
+		};
+
+		void ApplyStateChangesFromDirectory(const config::CatapultDirectory& directory, cache::CatapultCache& cache) {
+			auto numStateChangesFiles = CountStateChangesFiles(directory);
+			if (0 == numStateChangesFiles)
+				return;
+
+			utils::StackLogger stopwatch("apply incremental state checkpoints", utils::LogLevel::important);
+			StateChangeApplyingSubscriber subscriber(cache);
+			for (auto i = 1u; i <= numStateChangesFiles; ++i) {
+				auto inputStream = OpenInputStream(directory, GetStateChangesFilename(i));
+				while (!inputStream.eof())
+					subscribers::ReadNextStateChange(inputStream, subscriber.changesStorages(), subscriber);
+			}
+		}
+
 		bool LoadStateFromDirectory(
 				const config::CatapultDirectory& directory,
 				cache::CatapultCache& cache,
@@ -103,12 +207,15 @@ namespace catapult { namespace extensions {
 
 			// 1. load cache data
 			utils::StackLogger stopwatch("load state", utils::LogLevel::important);
-			for (const auto& pStorage : cache.storages()) {
-				auto inputStream = OpenInputStream(directory, GetStorageFilename(*pStorage));
-				pStorage->loadAll(inputStream, Default_Loader_Batch_Size);
-			}
+			ForEachStorageParallel(cache.storages(), "loaded", [&directory](auto& storage) {
+				auto inputStream = OpenInputStream(directory, GetStorageFilename(storage));
+				storage.loadAll(inputStream, Default_Loader_Batch_Size);
+			});
 
-			// 2. load supplemental data
+			// 2. apply incremental state checkpoints
+			ApplyStateChangesFromDirectory(directory, cache);
+
+			// 3. load supplemental data
 			LoadDependentStateFromDirectory(directory, cache, supplementalData);
 			return true;
 		}
@@ -154,10 +261,10 @@ namespace catapult { namespace extensions {
 			config::CatapultDirectory(directory.path()).create();
 
 			// 2. save cache data
-			for (const auto& pStorage : cacheStorages) {
-				auto outputStream = OpenOutputStream(directory, GetStorageFilename(*pStorage));
-				save(*pStorage, outputStream);
-			}
+			ForEachStorageParallel(cacheStorages, "saved", [&directory, &save](const auto& storage) {
+				auto outputStream = OpenOutputStream(directory, GetStorageFilename(storage));
+				save(storage, outputStream);
+			});
 
 			// 3. save supplemental data
 			cache::SupplementalData supplementalData{ state, score };
@@ -190,7 +297,23 @@ namespace catapult { namespace extensions {
 		});
 	}
 
+	namespace {
+		bool IsIncrementalCheckpoint(const config::CatapultDirectory& directory) {
+			auto begin = std::filesystem::directory_iterator(directory.path());
+			auto end = std::filesystem::directory_iterator();
+			return std::any_of(begin, end, [](const auto& entry) {
+				return IsStateChangesFilename(entry.path().filename().string());
+			});
+		}
+	}
+
 	void LocalNodeStateSerializer::moveTo(const config::CatapultDirectory& destinationDirectory) {
+		if (IsIncrementalCheckpoint(m_directory)) {
+			io::MoveAllFiles(m_directory.str(), destinationDirectory.str());
+			std::filesystem::remove(m_directory.path());
+			return;
+		}
+
 		io::PurgeDirectory(destinationDirectory.str());
 		std::filesystem::remove(destinationDirectory.path());
 		std::filesystem::rename(m_directory.path(), destinationDirectory.path());
@@ -236,4 +359,143 @@ namespace catapult { namespace extensions {
 	}
 
 	// endregion
+
+	// region incremental checkpointing
+
+	namespace {
+		// buffers each state change record in memory and appends it to the journal on flush
+		// (journal is reopened by every flush so that checkpointing can move it without coordinating with the writer)
+		class StateChangeJournalOutputStream : public io::OutputStream {
+		public:
+			explicit StateChangeJournalOutputStream(const std::string& filename) : m_filename(filename) {
+				io::RawFile(m_filename, io::OpenMode::Read_Write);
+			}
+
+		public:
+			void write(const RawBuffer& buffer) override {
+				m_buffer.insert(m_buffer.end(), buffer.pData, buffer.pData + buffer.Size);
+			}
+
+			void flush() override {
+				if (m_buffer.empty())
+					return;
+
+				io::RawFile journalFile(m_filename, io::OpenMode::Read_Append);
+				journalFile.seek(journalFile.size());
+				journalFile.write(m_buffer);
+				m_buffer.clear();
+			}
+
+		private:
+			std::string m_filename;
+			std::vector<uint8_t> m_buffer;
+		};
+	}
+
+	bool IsIncrementalStateCheckpointingEnabled(const config::NodeConfiguration& nodeConfig) {
+		return nodeConfig.EnableIncrementalStateCheckpoints && !nodeConfig.EnableCacheDatabaseStorage;
+	}
+
+	std::unique_ptr<io::OutputStream> CreateStateChangeJournalOutputStream(const config::CatapultDataDirectory& dataDirectory) {
+		return std::make_unique<StateChangeJournalOutputStream>(dataDirectory.rootDir().file(State_Change_Journal_Filename));
+	}
+
+	namespace {
+		struct StateDirectorySizes {
+			uint64_t FullSnapshot = 0;
+			uint64_t IncrementalCheckpoints = 0;
+		};
+
+		StateDirectorySizes GetStateDirectorySizes(const config::CatapultDirectory& directory) {
+			StateDirectorySizes sizes;
+			for (const auto& entry : std::filesystem::directory_iterator(directory.path())) {
+				auto filename = entry.path().filename().string();
+				if (Supplemental_Data_Filename == filename)
+					continue;
+
+				auto& size = IsStateChangesFilename(filename) ? sizes.IncrementalCheckpoints : sizes.FullSnapshot;
+				size += entry.file_size();
+			}
+
+			return sizes;
+		}
+
+		bool RequiresCompaction(const config::CatapultDirectory& stateDirectory, const std::string& journalFilename) {
+			// loading state needs to read the full snapshot and replay all incremental checkpoints, so compact them once they
+			// (including the journaled changes about to be checkpointed) are larger than the full snapshot itself
+			auto sizes = GetStateDirectorySizes(stateDirectory);
+			auto incrementalSize = sizes.IncrementalCheckpoints + std::filesystem::file_size(journalFilename);
+			if (incrementalSize < sizes.FullSnapshot)
+				return false;
+
+			CATAPULT_LOG(info)
+					<< "compacting incremental state checkpoints (" << incrementalSize << " bytes) into full snapshot ("
+					<< sizes.FullSnapshot << " bytes)";
+			return true;
+		}
+	}
+
+	void SaveStateToDirectoryWithIncrementalCheckpointing(
+			const config::CatapultDataDirectory& dataDirectory,
+			const config::NodeConfiguration& nodeConfig,
+			const cache::CatapultCache& cache,
+			const model::ChainScore& score) {
+		auto stateDirectory = dataDirectory.dir("state");
+		auto journalFilename = dataDirectory.rootDir().file(State_Change_Journal_Filename);
+		auto isIncremental = IsIncrementalStateCheckpointingEnabled(nodeConfig)
+				&& HasSerializedState(stateDirectory)
+				&& std::filesystem::exists(journalFilename)
+				&& !RequiresCompaction(stateDirectory, journalFilename);
+
+		if (!isIncremental) {
+			// full snapshot compacts all previous checkpoints, so journaled state changes are no longer needed
+			// (journal is removed first because replaying a state change that is also part of the snapshot is harmless)
+			std::filesystem::remove(journalFilename);
+			SaveStateToDirectoryWithCheckpointing(dataDirectory, nodeConfig, cache, score);
+			return;
+		}
+
+		SetCommitStep(dataDirectory, consumers::CommitOperationStep::Blocks_Written);
+
+		// 1. save supplemental data
+		auto numStateChangesFiles = CountStateChangesFiles(stateDirectory);
+		auto tempDirectory = dataDirectory.dir("state.tmp");
+		io::PurgeDirectory(tempDirectory.str());
+		config::CatapultDirectory(tempDirectory.path()).create();
+		{
+			auto cacheView = cache.createView();
+			cache::SupplementalData supplementalData{ cacheView.dependentState(), score };
+			auto outputStream = OpenOutputStream(tempDirectory, Supplemental_Data_Filename);
+			cache::SaveSupplementalData(supplementalData, cacheView.height(), outputStream);
+		}
+
+		// 2. save journaled state changes
+		std::filesystem::rename(journalFilename, tempDirectory.file(GetStateChangesFilename(numStateChangesFiles + 1)));
+		CATAPULT_LOG(info) << "saved incremental state checkpoint " << numStateChangesFiles + 1;
+
+		SetCommitStep(dataDirectory, consumers::CommitOperationStep::State_Written);
+
+		LocalNodeStateSerializer(tempDirectory).moveTo(stateDirectory);
+
+		SetCommitStep(dataDirectory, consumers::CommitOperationStep::All_Updated);
+	}
+
+	bool TrySaveStateToDirectoryWithIncrementalCheckpointing(
+			const config::CatapultDataDirectory& dataDirectory,
+			const config::NodeConfiguration& nodeConfig,
+			const cache::CatapultCache& cache,
+			const model::ChainScore& score) {
+		auto journalFilename = dataDirectory.rootDir().file(State_Change_Journal_Filename);
+		if (!IsIncrementalStateCheckpointingEnabled(nodeConfig) || !std::filesystem::exists(journalFilename))
+			return false;
+
+		if (std::filesystem::file_size(journalFilename) < nodeConfig.StateChangeJournalCheckpointSize.bytes())
+			return false;
+
+		utils::StackLogger stopwatch("save incremental state checkpoint", utils::LogLevel::info);
+		SaveStateToDirectoryWithIncrementalCheckpointing(dataDirectory, nodeConfig, cache, score);
+		return true;
+	}
+
+	// endregion
 }}
@@ -32,6 +32,7 @@ namespace catapult {
 	}
 	namespace config { struct NodeConfiguration; }
 	namespace extensions { struct LocalNodeStateRef; }
+	namespace io { class OutputStream; }
 	namespace model { class ChainScore; }
 	namespace plugins { class PluginManager; }
 }
@@ -54,6 +55,7 @@ namespace catapult { namespace extensions {
 	void LoadDependentStateFromDirectory(const config::CatapultDirectory& directory, cache::CatapultCache& cache);
 
 	/// Loads catapult state into \a stateRef from \a directory given \a pluginManager.
+	/// \note Any incremental state checkpoints present in \a directory are applied on top of the full state snapshot.
 	StateHeights LoadStateFromDirectory(
 			const config::CatapultDirectory& directory,
 			const LocalNodeStateRef& stateRef,
@@ -77,6 +79,7 @@ namespace catapult { namespace extensions {
 				Height height) const;
 
 		/// Moves serialized state to \a destinationDirectory.
+		/// \note Incremental checkpoints are merged into \a destinationDirectory instead of replacing it.
 		void moveTo(const config::CatapultDirectory& destinationDirectory);
 
 	private:
@@ -89,4 +92,31 @@ namespace catapult { namespace extensions {
 			const config::NodeConfiguration& nodeConfig,
 			const cache::CatapultCache& cache,
 			const model::ChainScore& score);
+
+	/// Returns \c true if incremental state checkpointing is enabled by \a nodeConfig.
+	bool IsIncrementalStateCheckpointingEnabled(const config::NodeConfiguration& nodeConfig);
+
+	/// Creates an output stream that journals state changes in \a dataDirectory for incremental state checkpointing.
+	/// \note Any previously journaled state changes are discarded.
+	std::unique_ptr<io::OutputStream> CreateStateChangeJournalOutputStream(const config::CatapultDataDirectory& dataDirectory);
+
+	/// Serializes state composed of \a cache and \a score with checkpointing to \a dataDirectory given \a nodeConfig.
+	/// When possible, only the state changes journaled since the previous checkpoint are saved.
+	/// \note A full snapshot is saved instead when replaying all incremental checkpoints would read more data than the full snapshot.
+	/// \note State changes must not be committed while the checkpoint is being written.
+	void SaveStateToDirectoryWithIncrementalCheckpointing(
+			const config::CatapultDataDirectory& dataDirectory,
+			const config::NodeConfiguration& nodeConfig,
+			const cache::CatapultCache& cache,
+			const model::ChainScore& score);
+
+	/// Serializes state composed of \a cache and \a score with incremental checkpointing to \a dataDirectory given \a nodeConfig
+	/// when the state change journal is at least as large as the configured checkpoint size.
+	/// Returns \c true if state was serialized.
+	/// \note State changes must not be committed while the checkpoint is being written.
+	bool TrySaveStateToDirectoryWithIncrementalCheckpointing(
+			const config::CatapultDataDirectory& dataDirectory,
+			const config::NodeConfiguration& nodeConfig,
+			const cache::CatapultCache& cache,
+			const model::ChainScore& score);
 }}
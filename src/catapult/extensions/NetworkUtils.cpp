@@ -21,6 +21,7 @@
 
 #include "NetworkUtils.h"
 #include "Results.h"
+#include "catapult/ionet/PacketCompressionSocketDecorator.h"
 #include "catapult/ionet/ReadRateMonitorSocketDecorator.h"
 #include "catapult/net/ConnectionContainer.h"
 #include "catapult/net/PeerConnectResult.h"
@@ -52,6 +53,8 @@ namespace catapult { namespace extensions {
 		settings.SocketWorkingBufferSensitivity = config.Node.SocketWorkingBufferSensitivity;
 		settings.MaxPacketDataSize = config.Node.MaxPacketDataSize;
 		settings.OutgoingProtocols = ionet::MapNodeRolesToIpProtocols(config.Node.Local.Roles);
+		settings.EnablePacketCompression = config.Node.EnablePacketCompression;
+		settings.PacketCompressionThreshold = config.Node.PacketCompressionThreshold;
 
 		settings.SslOptions.ContextSupplier = ionet::CreateSslContextSupplier(config.User.CertificateDirectory);
 		settings.SslOptions.VerifyCallbackSupplier = ionet::CreateSslVerifyCallbackSupplier();
@@ -104,8 +107,13 @@ namespace catapult { namespace extensions {
 		auto endpoint = boost::asio::ip::tcp::endpoint(boost::asio::ip::address::from_string(config.Node.ListenInterface), port);
 		BootServerState bootServerState(port, serviceId, nodeSubscriber, acceptor);
 		auto rateMonitorSettings = GetRateMonitorSettings(config.Node.Banning);
+		auto compressionSettings = GetConnectionSettings(config).toPacketCompressionSettings();
 
-		auto serverSettings = net::AsyncTcpServerSettings([bootServerState, rateMonitorSettings, timeSupplier](const auto& socketInfo) {
+		auto serverSettings = net::AsyncTcpServerSettings([
+				bootServerState,
+				rateMonitorSettings,
+				compressionSettings,
+				timeSupplier](const auto& socketInfo) {
 			auto pCurrentNodeIdentity = std::make_shared<model::NodeIdentity>();
 			pCurrentNodeIdentity->Host = socketInfo.host();
 
@@ -115,10 +123,14 @@ namespace catapult { namespace extensions {
 						utils::to_underlying_type(Failure_Extension_Read_Rate_Limit_Exceeded));
 				bootServerState.Acceptor.closeOne(*pCurrentNodeIdentity);
 			};
+
+			// remote node version is unknown, so only compress written packets after the remote node advertises compression support
+			// (rate limits are applied to decompressed packet sizes)
+			auto pSocket = ionet::AddPacketCompression(socketInfo.socket(), compressionSettings, false);
 			ionet::PacketSocketInfo decoratedSocketInfo(
 					socketInfo.host(),
 					socketInfo.publicKey(),
-					ionet::AddReadRateMonitor(socketInfo.socket(), rateMonitorSettings, timeSupplier, rateExceededHandler));
+					ionet::AddReadRateMonitor(pSocket, rateMonitorSettings, timeSupplier, rateExceededHandler));
 
 			bootServerState.Acceptor.accept(decoratedSocketInfo, [bootServerState, pCurrentNodeIdentity](const auto& connectResult) {
 				// on accept failure, only host (not identity key) is known
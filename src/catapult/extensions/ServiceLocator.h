@@ -21,6 +21,7 @@
 
 #pragma once
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/DiagnosticHistogramCounter.h"
 #include "catapult/exceptions.h"
 #include <memory>
 #include <unordered_map>
@@ -65,6 +66,11 @@ namespace catapult { namespace extensions {
 			return m_counters;
 		}
 
+		/// Gets the diagnostic histogram counters.
+		const std::vector<utils::DiagnosticHistogramCounter>& histogramCounters() const {
+			return m_histogramCounters;
+		}
+
 		/// Gets the number of registered services.
 		size_t numServices() const {
 			return m_services.size();
@@ -103,6 +109,17 @@ namespace catapult { namespace extensions {
 			});
 		}
 
+		/// Adds a service-dependent histogram counter with \a histogramName for service \a serviceName given \a supplier.
+		/// \note Empty values are returned when the service is not available.
+		template<typename TService, typename TSupplier>
+		void registerServiceHistogram(const std::string& serviceName, const std::string& histogramName, TSupplier supplier) {
+			m_histogramCounters.emplace_back(utils::DiagnosticCounterId(histogramName), [this, serviceName, supplier]() {
+				std::shared_ptr<TService> pService;
+				this->tryGetService(serviceName, pService);
+				return pService ? supplier(*pService) : utils::DiagnosticHistogramValues();
+			});
+		}
+
 	private:
 		template<typename TService>
 		bool tryGetService(const std::string& serviceName, std::shared_ptr<TService>& pService) const {
@@ -118,6 +135,7 @@ namespace catapult { namespace extensions {
 	private:
 		const config::CatapultKeys& m_keys;
 		std::vector<utils::DiagnosticCounter> m_counters;
+		std::vector<utils::DiagnosticHistogramCounter> m_histogramCounters;
 		std::unordered_map<std::string, std::weak_ptr<void>> m_services;
 		std::vector<std::pair<std::string, std::shared_ptr<void>>> m_rootedServices;
 	};
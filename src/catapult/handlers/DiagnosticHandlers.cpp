@@ -28,7 +28,9 @@
 #include "catapult/ionet/PackedNodeInfo.h"
 #include "catapult/ionet/PacketPayloadFactory.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DiagnosticHistogramValue.h"
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/DiagnosticHistogramCounter.h"
 
 namespace catapult { namespace handlers {
 
@@ -62,6 +64,44 @@ namespace catapult { namespace handlers {
 
 	// endregion
 
+	// region DiagnosticHistogramsHandler
+
+	namespace {
+		auto CreateDiagnosticHistogramsHandler(const std::vector<utils::DiagnosticHistogramCounter>& histogramCounters) {
+			return [histogramCounters](const auto& packet, auto& context) {
+				if (!ionet::IsPacketValid(packet, ionet::PacketType::Diagnostic_Histograms))
+					return;
+
+				auto histogramValuesSize = histogramCounters.size() * sizeof(model::DiagnosticHistogramValue);
+				auto payloadSize = utils::checked_cast<size_t, uint32_t>(histogramValuesSize);
+				auto pResponsePacket = ionet::CreateSharedPacket<ionet::Packet>(payloadSize);
+				pResponsePacket->Type = ionet::PacketType::Diagnostic_Histograms;
+
+				auto* pHistogramValue = reinterpret_cast<model::DiagnosticHistogramValue*>(pResponsePacket->Data());
+				for (const auto& histogramCounter : histogramCounters) {
+					auto values = histogramCounter.values();
+					pHistogramValue->Id = histogramCounter.id().value();
+					pHistogramValue->Count = values.count();
+					pHistogramValue->P50 = values.percentile(50);
+					pHistogramValue->P90 = values.percentile(90);
+					pHistogramValue->P99 = values.percentile(99);
+					pHistogramValue->Max = values.max();
+					++pHistogramValue;
+				}
+
+				context.response(ionet::PacketPayload(pResponsePacket));
+			};
+		}
+	}
+
+	void RegisterDiagnosticHistogramsHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const std::vector<utils::DiagnosticHistogramCounter>& histogramCounters) {
+		handlers.registerHandler(ionet::PacketType::Diagnostic_Histograms, CreateDiagnosticHistogramsHandler(histogramCounters));
+	}
+
+	// endregion
+
 	// region DiagnosticNodesHandler
 
 	namespace {
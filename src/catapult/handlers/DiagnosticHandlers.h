@@ -26,7 +26,10 @@
 namespace catapult {
 	namespace io { class BlockStorageCache; }
 	namespace ionet { class NodeContainer; }
-	namespace utils { class DiagnosticCounter; }
+	namespace utils {
+		class DiagnosticCounter;
+		class DiagnosticHistogramCounter;
+	}
 }
 
 namespace catapult { namespace handlers {
@@ -34,6 +37,11 @@ namespace catapult { namespace handlers {
 	/// Registers a diagnostic counters handler in \a handlers that responds with the current values of \a counters.
 	void RegisterDiagnosticCountersHandler(ionet::ServerPacketHandlers& handlers, const std::vector<utils::DiagnosticCounter>& counters);
 
+	/// Registers a diagnostic histograms handler in \a handlers that responds with the current values of \a histogramCounters.
+	void RegisterDiagnosticHistogramsHandler(
+			ionet::ServerPacketHandlers& handlers,
+			const std::vector<utils::DiagnosticHistogramCounter>& histogramCounters);
+
 	/// Registers a diagnostic nodes handler in \a handlers that responds with info about all (active) partner nodes in \a nodeContainer.
 	void RegisterDiagnosticNodesHandler(ionet::ServerPacketHandlers& handlers, const ionet::NodeContainer& nodeContainer);
 
@@ -47,11 +47,13 @@ namespace catapult { namespace io {
 			void saveBlock(const model::BlockElement& blockElement) override {
 				m_pStorage->saveBlock(blockElement);
 				m_pBlockChangeSubscriber->notifyBlock(blockElement);
+				m_pBlockChangeSubscriber->flush();
 			}
 
 			void dropBlocksAfter(Height height) override {
 				m_pStorage->dropBlocksAfter(height);
 				m_pBlockChangeSubscriber->notifyDropBlocksAfter(height);
+				m_pBlockChangeSubscriber->flush();
 			}
 
 			// endregion
@@ -35,5 +35,8 @@ namespace catapult { namespace io {
 
 		/// Indicates all blocks after \a height were invalidated.
 		virtual void notifyDropBlocksAfter(Height height) = 0;
+
+		/// Flushes all pending block changes.
+		virtual void flush() = 0;
 	};
 }}
@@ -20,6 +20,7 @@
 **/
 
 #include "BlockElementSerializer.h"
+#include "BufferInputStreamAdapter.h"
 #include "PodIoUtils.h"
 #include "Stream.h"
 #include "catapult/utils/MemoryUtils.h"
@@ -115,5 +116,43 @@ namespace catapult { namespace io {
 		return pBlockElement;
 	}
 
+	namespace {
+		struct BlockElementView {
+		public:
+			BlockElementView(const model::Block& block, const std::shared_ptr<const void>& pBufferOwner)
+					: pOwner(pBufferOwner)
+					, Element(block)
+			{}
+
+		public:
+			std::shared_ptr<const void> pOwner;
+			model::BlockElement Element;
+		};
+	}
+
+	std::shared_ptr<model::BlockElement> ReadBlockElementView(const RawBuffer& buffer, const std::shared_ptr<const void>& pBufferOwner) {
+		BufferInputStreamAdapter<RawBuffer> inputStream(buffer);
+		auto size = Read32(inputStream);
+		if (size < sizeof(model::BlockHeader) || size > buffer.Size)
+			CATAPULT_THROW_FILE_IO_ERROR("block element buffer contains block with invalid size");
+
+		// reference the block data in place instead of copying it
+		const auto& block = reinterpret_cast<const model::Block&>(*buffer.pData);
+		auto pView = std::make_shared<BlockElementView>(block, pBufferOwner);
+		auto pBlockElement = std::shared_ptr<model::BlockElement>(pView, &pView->Element);
+
+		auto metadataBuffer = RawBuffer(buffer.pData + size, buffer.Size - size);
+		BufferInputStreamAdapter<RawBuffer> metadataInputStream(metadataBuffer);
+		metadataInputStream.read(pBlockElement->EntityHash);
+		metadataInputStream.read(pBlockElement->GenerationHash);
+		ReadTransactionHashes(metadataInputStream, *pBlockElement);
+		ReadSubCacheMerkleRoots(metadataInputStream, pBlockElement->SubCacheMerkleRoots);
+
+		if (!metadataInputStream.eof())
+			CATAPULT_THROW_RUNTIME_ERROR("additional data after block element");
+
+		return pBlockElement;
+	}
+
 	// endregion
 }}
@@ -38,4 +38,9 @@ namespace catapult { namespace io {
 	/// Reads block element from \a inputStream into an allocated block element.
 	/// \note Shared pointer is returned for memory management reasons.
 	std::shared_ptr<model::BlockElement> ReadBlockElement(InputStream& inputStream);
+
+	/// Reads block element from \a buffer into a block element that references the block data in \a buffer
+	/// and extends the lifetime of the owner of that data (\a pBufferOwner).
+	/// \note \a buffer must contain exactly one block element.
+	std::shared_ptr<model::BlockElement> ReadBlockElementView(const RawBuffer& buffer, const std::shared_ptr<const void>& pBufferOwner);
 }}
@@ -22,7 +22,11 @@
 #include "BlockStorageCache.h"
 #include "MoveBlockFiles.h"
 #include "catapult/model/Elements.h"
+#include "catapult/utils/Hashers.h"
 #include "catapult/utils/MemoryUtils.h"
+#include "catapult/utils/SpinLock.h"
+#include <list>
+#include <unordered_map>
 
 namespace catapult { namespace io {
 
@@ -30,6 +34,38 @@ namespace catapult { namespace io {
 		std::shared_ptr<const model::Block> BlockElementAsSharedBlock(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
 			return std::shared_ptr<const model::Block>(&pBlockElement->Block, [pBlockElement](const auto*) {});
 		}
+
+		std::shared_ptr<const model::BlockElement> CopyBlockElement(const model::BlockElement& blockElement) {
+			// allocate memory for both the element and the block in one shot (Block data is appended)
+			auto size = blockElement.Block.Size;
+			auto pBackingMemory = utils::MakeUniqueWithSize<uint8_t>(sizeof(model::BlockElement) + size);
+
+			auto pBlockData = pBackingMemory.get() + sizeof(model::BlockElement);
+			std::memcpy(pBlockData, &blockElement.Block, size);
+
+			// create the block element and transfer ownership from pBackingMemory to pBlockElement
+			auto pBlockElementRaw = new (pBackingMemory.get()) model::BlockElement(*reinterpret_cast<model::Block*>(pBlockData));
+			auto pBlockElement = std::shared_ptr<model::BlockElement>(pBlockElementRaw);
+			pBackingMemory.release();
+
+			pBlockElement->EntityHash = blockElement.EntityHash;
+			pBlockElement->GenerationHash = blockElement.GenerationHash;
+			pBlockElement->SubCacheMerkleRoots = blockElement.SubCacheMerkleRoots;
+			pBlockElement->OptionalStatement = blockElement.OptionalStatement;
+
+			auto sourceIter = blockElement.Transactions.cbegin();
+			for (const auto& transaction : pBlockElement->Block.Transactions()) {
+				pBlockElement->Transactions.push_back(model::TransactionElement(transaction));
+
+				auto& transactionElement = pBlockElement->Transactions.back();
+				transactionElement.EntityHash = sourceIter->EntityHash;
+				transactionElement.MerkleComponentHash = sourceIter->MerkleComponentHash;
+				transactionElement.OptionalExtractedAddresses = sourceIter->OptionalExtractedAddresses;
+				++sourceIter;
+			}
+
+			return pBlockElement;
+		}
 	}
 
 	// region CachedData
@@ -68,15 +104,170 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region HotBlocksCache
+
+	class HotBlocksCache {
+	private:
+		using BlockStatementData = std::pair<std::vector<uint8_t>, bool>;
+
+		struct Entry {
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			std::unique_ptr<BlockStatementData> pBlockStatementData;
+			size_t MemorySize = 0;
+			std::list<Height>::iterator UsageIter;
+		};
+
+		using EntryMap = std::unordered_map<Height, Entry, utils::BaseValueHasher<Height>>;
+
+		// approximate bookkeeping memory of a single entry (map node and bucket, usage list node)
+		static constexpr size_t Entry_Overhead_Size = sizeof(EntryMap::value_type) + sizeof(Height) + 5 * sizeof(void*);
+
+	public:
+		explicit HotBlocksCache(utils::FileSize maxMemorySize)
+				: m_maxMemorySize(maxMemorySize.bytes())
+				, m_memorySize(0)
+				, m_numHits(0)
+				, m_numMisses(0)
+		{}
+
+	public:
+		bool isEnabled() const {
+			return 0 != m_maxMemorySize;
+		}
+
+		BlockStorageCacheStatistics statistics() const {
+			utils::SpinLockGuard guard(m_lock);
+			return { m_numHits, m_numMisses, utils::FileSize::FromBytes(m_memorySize) };
+		}
+
+	public:
+		std::shared_ptr<const model::BlockElement> findBlockElement(Height height) {
+			utils::SpinLockGuard guard(m_lock);
+			auto* pEntry = find(height, [](const auto& entry) { return !!entry.pBlockElement; });
+			return pEntry ? pEntry->pBlockElement : nullptr;
+		}
+
+		bool tryFindBlockStatementData(Height height, BlockStatementData& blockStatementData) {
+			utils::SpinLockGuard guard(m_lock);
+			auto* pEntry = find(height, [](const auto& entry) { return !!entry.pBlockStatementData; });
+			if (!pEntry)
+				return false;
+
+			blockStatementData = *pEntry->pBlockStatementData;
+			return true;
+		}
+
+	public:
+		// cache a copy so that cached elements never reference storage owned memory (e.g. memory mapped files)
+		// and do not force the storage to copy files that are being rewritten
+		std::shared_ptr<const model::BlockElement> add(const model::BlockElement& blockElement) {
+			utils::SpinLockGuard guard(m_lock);
+			auto& entry = findOrCreate(blockElement.Block.Height);
+			if (!entry.pBlockElement) {
+				entry.pBlockElement = CopyBlockElement(blockElement);
+				updateMemorySize(entry, CalculateMemorySize(blockElement));
+			}
+
+			auto pBlockElement = entry.pBlockElement;
+			prune();
+			return pBlockElement;
+		}
+
+		void add(Height height, const BlockStatementData& blockStatementData) {
+			utils::SpinLockGuard guard(m_lock);
+			auto& entry = findOrCreate(height);
+			if (!entry.pBlockStatementData) {
+				entry.pBlockStatementData = std::make_unique<BlockStatementData>(blockStatementData);
+				updateMemorySize(entry, sizeof(BlockStatementData) + blockStatementData.first.size());
+			}
+
+			prune();
+		}
+
+		void removeAfter(Height height) {
+			utils::SpinLockGuard guard(m_lock);
+			for (auto iter = m_entries.begin(); m_entries.end() != iter;) {
+				if (iter->first > height)
+					iter = remove(iter);
+				else
+					++iter;
+			}
+		}
+
+	private:
+		static size_t CalculateMemorySize(const model::BlockElement& blockElement) {
+			return sizeof(model::BlockElement)
+					+ blockElement.Block.Size
+					+ blockElement.Transactions.size() * sizeof(model::TransactionElement)
+					+ blockElement.SubCacheMerkleRoots.size() * Hash256::Size;
+		}
+
+		template<typename TPredicate>
+		Entry* find(Height height, TPredicate predicate) {
+			auto iter = m_entries.find(height);
+			if (m_entries.end() == iter || !predicate(iter->second)) {
+				++m_numMisses;
+				return nullptr;
+			}
+
+			++m_numHits;
+			m_usages.splice(m_usages.begin(), m_usages, iter->second.UsageIter);
+			return &iter->second;
+		}
+
+		Entry& findOrCreate(Height height) {
+			auto iter = m_entries.find(height);
+			if (m_entries.end() == iter) {
+				iter = m_entries.emplace(height, Entry()).first;
+				iter->second.UsageIter = m_usages.insert(m_usages.begin(), height);
+				updateMemorySize(iter->second, Entry_Overhead_Size);
+			} else {
+				m_usages.splice(m_usages.begin(), m_usages, iter->second.UsageIter);
+			}
+
+			return iter->second;
+		}
+
+		void updateMemorySize(Entry& entry, size_t additionalMemorySize) {
+			entry.MemorySize += additionalMemorySize;
+			m_memorySize += additionalMemorySize;
+		}
+
+		void prune() {
+			// evict least recently used entries until the cache fits within its memory budget
+			while (m_memorySize > m_maxMemorySize && !m_usages.empty())
+				remove(m_entries.find(m_usages.back()));
+		}
+
+		EntryMap::iterator remove(EntryMap::iterator iter) {
+			m_memorySize -= iter->second.MemorySize;
+			m_usages.erase(iter->second.UsageIter);
+			return m_entries.erase(iter);
+		}
+
+	private:
+		size_t m_maxMemorySize;
+		size_t m_memorySize;
+		uint64_t m_numHits;
+		uint64_t m_numMisses;
+		EntryMap m_entries;
+		std::list<Height> m_usages; // most recently used heights are at the front
+		mutable utils::SpinLock m_lock;
+	};
+
+	// endregion
+
 	// region BlockStorageView
 
 	BlockStorageView::BlockStorageView(
 			const BlockStorage& storage,
 			utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
-			const CachedData& cachedData)
+			const CachedData& cachedData,
+			HotBlocksCache& hotBlocksCache)
 			: m_storage(storage)
 			, m_readLock(std::move(readLock))
 			, m_cachedData(cachedData)
+			, m_hotBlocksCache(hotBlocksCache)
 	{}
 
 	Height BlockStorageView::chainHeight() const {
@@ -92,7 +283,10 @@ namespace catapult { namespace io {
 		if (m_cachedData.contains(height))
 			return m_cachedData.block(height);
 
-		return m_storage.loadBlock(height);
+		if (!m_hotBlocksCache.isEnabled())
+			return m_storage.loadBlock(height);
+
+		return BlockElementAsSharedBlock(loadHotBlockElement(height));
 	}
 
 	std::shared_ptr<const model::BlockElement> BlockStorageView::loadBlockElement(Height height) const {
@@ -100,12 +294,32 @@ namespace catapult { namespace io {
 		if (m_cachedData.contains(height))
 			return m_cachedData.blockElement(height);
 
-		return m_storage.loadBlockElement(height);
+		if (!m_hotBlocksCache.isEnabled())
+			return m_storage.loadBlockElement(height);
+
+		return loadHotBlockElement(height);
 	}
 
 	std::pair<std::vector<uint8_t>, bool> BlockStorageView::loadBlockStatementData(Height height) const {
 		requireHeight(height, "block statement data");
-		return m_storage.loadBlockStatementData(height);
+		if (!m_hotBlocksCache.isEnabled())
+			return m_storage.loadBlockStatementData(height);
+
+		std::pair<std::vector<uint8_t>, bool> blockStatementData;
+		if (m_hotBlocksCache.tryFindBlockStatementData(height, blockStatementData))
+			return blockStatementData;
+
+		blockStatementData = m_storage.loadBlockStatementData(height);
+		m_hotBlocksCache.add(height, blockStatementData);
+		return blockStatementData;
+	}
+
+	std::shared_ptr<const model::BlockElement> BlockStorageView::loadHotBlockElement(Height height) const {
+		auto pBlockElement = m_hotBlocksCache.findBlockElement(height);
+		if (pBlockElement)
+			return pBlockElement;
+
+		return m_hotBlocksCache.add(*m_storage.loadBlockElement(height));
 	}
 
 	void BlockStorageView::requireHeight(Height height, const char* description) const {
@@ -126,11 +340,13 @@ namespace catapult { namespace io {
 			BlockStorage& storage,
 			PrunableBlockStorage& stagingStorage,
 			utils::SpinReaderWriterLock::WriterLockGuard&& writeLock,
-			CachedData& cachedData)
+			CachedData& cachedData,
+			HotBlocksCache& hotBlocksCache)
 			: m_storage(storage)
 			, m_stagingStorage(stagingStorage)
 			, m_writeLock(std::move(writeLock))
-			, m_cachedData(cachedData) {
+			, m_cachedData(cachedData)
+			, m_hotBlocksCache(hotBlocksCache) {
 		dropBlocksAfter(storage.chainHeight());
 	}
 
@@ -149,25 +365,37 @@ namespace catapult { namespace io {
 	}
 
 	void BlockStorageModifier::commit() {
-		// 1. apply staging changes to permananent storage
+		// 1. invalidate all hot blocks after the first saved block because they are either dropped or replaced
+		m_hotBlocksCache.removeAfter(m_saveStartHeight);
+
+		// 2. apply staging changes to permananent storage
 		MoveBlockFiles(m_stagingStorage, m_storage, m_saveStartHeight + Height(1));
 
-		// 2. update cache
+		// 3. update caches
 		auto newChainHeight = m_storage.chainHeight();
-		if (newChainHeight > Height(0))
-			m_cachedData.update(m_storage.loadBlockElement(newChainHeight));
-		else
+		if (newChainHeight > Height(0)) {
+			auto pBlockElement = m_storage.loadBlockElement(newChainHeight);
+			if (m_hotBlocksCache.isEnabled())
+				pBlockElement = m_hotBlocksCache.add(*pBlockElement);
+
+			m_cachedData.update(pBlockElement);
+		} else {
 			m_cachedData.reset();
+		}
 	}
 
 	// endregion
 
 	// region BlockStorageCache
 
-	BlockStorageCache::BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage)
+	BlockStorageCache::BlockStorageCache(
+			std::unique_ptr<BlockStorage>&& pStorage,
+			std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+			utils::FileSize hotBlocksMaxMemorySize)
 			: m_pStorage(std::move(pStorage))
 			, m_pStagingStorage(std::move(pStagingStorage))
-			, m_pCachedData(std::make_unique<CachedData>()) {
+			, m_pCachedData(std::make_unique<CachedData>())
+			, m_pHotBlocksCache(std::make_unique<HotBlocksCache>(hotBlocksMaxMemorySize)) {
 		m_pCachedData->update(m_pStorage->loadBlockElement(m_pStorage->chainHeight()));
 	}
 
@@ -175,12 +403,16 @@ namespace catapult { namespace io {
 
 	BlockStorageView BlockStorageCache::view() const {
 		auto readLock = m_lock.acquireReader();
-		return BlockStorageView(*m_pStorage, std::move(readLock), *m_pCachedData);
+		return BlockStorageView(*m_pStorage, std::move(readLock), *m_pCachedData, *m_pHotBlocksCache);
 	}
 
 	BlockStorageModifier BlockStorageCache::modifier() {
 		auto writeLock = m_lock.acquireWriter();
-		return BlockStorageModifier(*m_pStorage, *m_pStagingStorage, std::move(writeLock), *m_pCachedData);
+		return BlockStorageModifier(*m_pStorage, *m_pStagingStorage, std::move(writeLock), *m_pCachedData, *m_pHotBlocksCache);
+	}
+
+	BlockStorageCacheStatistics BlockStorageCache::statistics() const {
+		return m_pHotBlocksCache->statistics();
 	}
 
 	// endregion
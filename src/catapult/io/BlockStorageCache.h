@@ -21,20 +21,27 @@
 
 #pragma once
 #include "BlockStorage.h"
+#include "catapult/utils/FileSize.h"
 #include "catapult/utils/SpinReaderWriterLock.h"
 
-namespace catapult { namespace io { struct CachedData; } }
+namespace catapult {
+	namespace io {
+		struct CachedData;
+		class HotBlocksCache;
+	}
+}
 
 namespace catapult { namespace io {
 
 	/// Read only view on top of block storage.
 	class BlockStorageView : utils::MoveOnly {
 	public:
-		/// Creates a view around \a storage and cache data (\a cachedData) with lock context \a readLock.
+		/// Creates a view around \a storage, cache data (\a cachedData) and \a hotBlocksCache with lock context \a readLock.
 		BlockStorageView(
 				const BlockStorage& storage,
 				utils::SpinReaderWriterLock::ReaderLockGuard&& readLock,
-				const CachedData& cachedData);
+				const CachedData& cachedData,
+				HotBlocksCache& hotBlocksCache);
 
 	public:
 		/// Gets the number of blocks.
@@ -53,23 +60,28 @@ namespace catapult { namespace io {
 		std::pair<std::vector<uint8_t>, bool> loadBlockStatementData(Height height) const;
 
 	private:
+		std::shared_ptr<const model::BlockElement> loadHotBlockElement(Height height) const;
+
 		void requireHeight(Height height, const char* description) const;
 
 	private:
 		const BlockStorage& m_storage;
 		utils::SpinReaderWriterLock::ReaderLockGuard m_readLock;
 		const CachedData& m_cachedData;
+		HotBlocksCache& m_hotBlocksCache;
 	};
 
 	/// Write only view on top of block storage.
 	class BlockStorageModifier : utils::MoveOnly {
 	public:
-		/// Creates a view around \a storage, \a stagingStorage and cache data (\a cachedData) with lock context \a writeLock.
+		/// Creates a view around \a storage, \a stagingStorage, cache data (\a cachedData) and \a hotBlocksCache
+		/// with lock context \a writeLock.
 		BlockStorageModifier(
 				BlockStorage& storage,
 				PrunableBlockStorage& stagingStorage,
 				utils::SpinReaderWriterLock::WriterLockGuard&& writeLock,
-				CachedData& cachedData);
+				CachedData& cachedData,
+				HotBlocksCache& hotBlocksCache);
 
 	public:
 		/// Saves a block element (\a blockElement).
@@ -89,15 +101,32 @@ namespace catapult { namespace io {
 		PrunableBlockStorage& m_stagingStorage;
 		utils::SpinReaderWriterLock::WriterLockGuard m_writeLock;
 		CachedData& m_cachedData;
+		HotBlocksCache& m_hotBlocksCache;
 		Height m_saveStartHeight;
 	};
 
+	/// Block storage cache statistics.
+	struct BlockStorageCacheStatistics {
+		/// Number of loads served by the hot blocks cache.
+		uint64_t NumHotBlockHits;
+
+		/// Number of loads that missed the hot blocks cache.
+		uint64_t NumHotBlockMisses;
+
+		/// Memory used by all blocks in the hot blocks cache.
+		utils::FileSize HotBlocksMemorySize;
+	};
+
 	/// Cache around a BlockStorage.
-	/// \note Currently this "cache" provides synchronization and support for two-phase commit.
+	/// \note This cache provides synchronization, support for two-phase commit and an optional cache of recently used blocks.
 	class BlockStorageCache {
 	public:
 		/// Creates a new cache around \a pStorage that uses \a pStagingStorage for staging blocks in order to enable two-phase commit.
-		BlockStorageCache(std::unique_ptr<BlockStorage>&& pStorage, std::unique_ptr<PrunableBlockStorage>&& pStagingStorage);
+		/// Up to \a hotBlocksMaxMemorySize memory is used to cache recently saved and loaded blocks.
+		BlockStorageCache(
+				std::unique_ptr<BlockStorage>&& pStorage,
+				std::unique_ptr<PrunableBlockStorage>&& pStagingStorage,
+				utils::FileSize hotBlocksMaxMemorySize = utils::FileSize());
 
 		/// Destroys the cache.
 		~BlockStorageCache();
@@ -109,10 +138,14 @@ namespace catapult { namespace io {
 		/// Gets a write only view of the storage.
 		BlockStorageModifier modifier();
 
+		/// Gets the cache statistics.
+		BlockStorageCacheStatistics statistics() const;
+
 	private:
 		std::unique_ptr<BlockStorage> m_pStorage;
 		std::unique_ptr<PrunableBlockStorage> m_pStagingStorage;
 		std::unique_ptr<CachedData> m_pCachedData;
+		std::unique_ptr<HotBlocksCache> m_pHotBlocksCache;
 		mutable utils::SpinReaderWriterLock m_lock;
 	};
 }}
@@ -33,11 +33,16 @@ namespace catapult { namespace io {
 
 	// region ctor
 
-	FileBlockStorage::FileBlockStorage(const std::string& dataDirectory, uint32_t fileDatabaseBatchSize, FileBlockStorageMode mode)
+	FileBlockStorage::FileBlockStorage(
+			const std::string& dataDirectory,
+			uint32_t fileDatabaseBatchSize,
+			FileBlockStorageMode mode,
+			bool enableMemoryMapping)
 			: m_dataDirectory(dataDirectory)
 			, m_mode(mode)
-			, m_blockDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".dat" })
-			, m_statementDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".stmt" })
+			, m_enableMemoryMapping(enableMemoryMapping)
+			, m_blockDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".dat", enableMemoryMapping })
+			, m_statementDatabase(config::CatapultDirectory(dataDirectory), { fileDatabaseBatchSize, ".stmt", false })
 			, m_hashFile(dataDirectory, "hashes")
 			, m_indexFile((std::filesystem::path(dataDirectory) / "index.dat").generic_string())
 	{}
@@ -108,16 +113,33 @@ namespace catapult { namespace io {
 			blockStream.read({ reinterpret_cast<uint8_t*>(pBlock.get()) + sizeof(uint32_t), size - sizeof(uint32_t) });
 			return pBlock;
 		}
+
+		std::shared_ptr<const model::Block> GetBlockView(const FileDatabase::PayloadView& payloadView) {
+			const auto& payload = payloadView.Payload;
+			if (payload.Size < sizeof(model::BlockHeader) || reinterpret_cast<const model::Block&>(*payload.pData).Size > payload.Size)
+				CATAPULT_THROW_FILE_IO_ERROR("mapped block payload contains block with invalid size");
+
+			// share ownership of the mapped file so that the block data remains valid
+			return std::shared_ptr<const model::Block>(payloadView.pMappedFile, reinterpret_cast<const model::Block*>(payload.pData));
+		}
 	}
 
 	std::shared_ptr<const model::Block> FileBlockStorage::loadBlock(Height height) const {
 		requireHeight(height, "block");
+		if (m_enableMemoryMapping)
+			return GetBlockView(m_blockDatabase.payloadView(height.unwrap()));
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		return ReadBlock(*pBlockStream);
 	}
 
 	std::shared_ptr<const model::BlockElement> FileBlockStorage::loadBlockElement(Height height) const {
 		requireHeight(height, "block element");
+		if (m_enableMemoryMapping) {
+			auto payloadView = m_blockDatabase.payloadView(height.unwrap());
+			return ReadBlockElementView(payloadView.Payload, payloadView.pMappedFile);
+		}
+
 		auto pBlockStream = m_blockDatabase.inputStream(height.unwrap());
 		auto pBlockElement = ReadBlockElement(*pBlockStream);
 
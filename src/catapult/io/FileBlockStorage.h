@@ -43,10 +43,12 @@ namespace catapult { namespace io {
 	public:
 		/// Creates a file-based block storage, where blocks will be stored inside \a dataDirectory
 		/// with a file database batch size of \a fileDatabaseBatchSize and specified storage \a mode.
+		/// When \a enableMemoryMapping is \c true, loaded blocks reference memory mapped block files instead of copies.
 		FileBlockStorage(
 				const std::string& dataDirectory,
 				uint32_t fileDatabaseBatchSize,
-				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index);
+				FileBlockStorageMode mode = FileBlockStorageMode::Hash_Index,
+				bool enableMemoryMapping = false);
 
 	public:
 		// LightBlockStorage
@@ -69,6 +71,7 @@ namespace catapult { namespace io {
 	private:
 		std::string m_dataDirectory;
 		FileBlockStorageMode m_mode;
+		bool m_enableMemoryMapping;
 		FileDatabase m_blockDatabase;
 		FileDatabase m_statementDatabase;
 
@@ -21,9 +21,15 @@
 
 #include "FileDatabase.h"
 #include "FileStream.h"
+#include "MemoryMappedFile.h"
 #include "PodIoUtils.h"
 #include "catapult/exceptions.h"
 #include "catapult/preprocessor.h"
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
 
 namespace catapult { namespace io {
 
@@ -61,17 +67,105 @@ namespace catapult { namespace io {
 		};
 
 		// endregion
+
+		// region mapped file utils
+
+		constexpr size_t Max_Recent_Mapped_Files = 16;
+
+		uint64_t ReadMappedOffset(const MemoryMappedFile& mappedFile, uint64_t offset) {
+			if (offset + sizeof(uint64_t) > mappedFile.size())
+				CATAPULT_THROW_FILE_IO_ERROR("cannot read offset past end of mapped file");
+
+			uint64_t value;
+			std::memcpy(&value, mappedFile.data() + offset, sizeof(uint64_t));
+			return value;
+		}
+
+		void ReplaceWithCopy(const std::string& filePath) {
+			// outstanding mappings continue to reference the original file, which is unlinked by the rename
+			auto tempFilePath = filePath + ".tmp";
+			std::filesystem::copy_file(filePath, tempFilePath, std::filesystem::copy_options::overwrite_existing);
+			std::filesystem::rename(tempFilePath, filePath);
+		}
+
+		// endregion
 	}
 
+	// region FileDatabase::MappedFileCache
+
+	class FileDatabase::MappedFileCache {
+	public:
+		std::shared_ptr<const MemoryMappedFile> get(const std::string& filePath) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto iter = m_mappedFiles.find(filePath);
+			if (m_mappedFiles.cend() != iter) {
+				auto pMappedFile = iter->second.lock();
+				if (pMappedFile)
+					return pMappedFile;
+			}
+
+			pruneExpired();
+
+			auto pMappedFile = std::make_shared<const MemoryMappedFile>(filePath);
+			m_mappedFiles[filePath] = pMappedFile;
+
+			// keep the most recently mapped files alive so that consecutive reads from the same file share a mapping
+			m_recentMappedFiles.push_back(pMappedFile);
+			if (m_recentMappedFiles.size() > Max_Recent_Mapped_Files)
+				m_recentMappedFiles.pop_front();
+
+			return pMappedFile;
+		}
+
+		bool release(const std::string& filePath) {
+			std::lock_guard<std::mutex> guard(m_mutex);
+			auto iter = m_mappedFiles.find(filePath);
+			if (m_mappedFiles.cend() == iter)
+				return false;
+
+			auto pMappedFile = iter->second.lock();
+			m_mappedFiles.erase(iter);
+			if (!pMappedFile)
+				return false;
+
+			auto recentIter = std::find(m_recentMappedFiles.cbegin(), m_recentMappedFiles.cend(), pMappedFile);
+			if (m_recentMappedFiles.cend() != recentIter)
+				m_recentMappedFiles.erase(recentIter);
+
+			// only the local reference remains when there are no outstanding views
+			return 1 < pMappedFile.use_count();
+		}
+
+	private:
+		void pruneExpired() {
+			for (auto iter = m_mappedFiles.cbegin(); m_mappedFiles.cend() != iter;) {
+				if (iter->second.expired())
+					iter = m_mappedFiles.erase(iter);
+				else
+					++iter;
+			}
+		}
+
+	private:
+		std::unordered_map<std::string, std::weak_ptr<const MemoryMappedFile>> m_mappedFiles;
+		std::deque<std::shared_ptr<const MemoryMappedFile>> m_recentMappedFiles;
+		std::mutex m_mutex;
+	};
+
+	// endregion
+
 	// region FileDatabase
 
 	FileDatabase::FileDatabase(const config::CatapultDirectory& directory, const Options& options)
 			: m_directory(directory)
-			, m_options(options) {
+			, m_options(options)
+			, m_pMappedFileCache(m_options.EnableMemoryMapping ? std::make_unique<MappedFileCache>() : nullptr) {
 		if (0 == m_options.BatchSize)
 			CATAPULT_THROW_INVALID_ARGUMENT("batch size must be nonzero");
 	}
 
+	FileDatabase::~FileDatabase() = default;
+
 	bool FileDatabase::contains(uint64_t id) const {
 		auto filePath = getFilePath(id, false);
 		if (!std::filesystem::exists(filePath))
@@ -125,9 +219,51 @@ namespace catapult { namespace io {
 		return std::make_unique<InputStreamSlice>(std::move(pBodyStream), bodyEndOffset);
 	}
 
+	FileDatabase::PayloadView FileDatabase::payloadView(uint64_t id) const {
+		if (!m_pMappedFileCache)
+			CATAPULT_THROW_RUNTIME_ERROR("payload views require memory mapping to be enabled");
+
+		auto filePath = getFilePath(id, false);
+		if (!std::filesystem::exists(filePath))
+			CATAPULT_THROW_FILE_IO_ERROR("cannot map payload in file that does not exist");
+
+		auto pMappedFile = m_pMappedFileCache->get(filePath);
+		if (bypassHeader())
+			return { pMappedFile, { pMappedFile->data(), pMappedFile->size() } };
+
+		auto headerOffset = getHeaderOffset(id);
+		auto bodyStartOffset = ReadMappedOffset(*pMappedFile, headerOffset);
+
+		if (0 == bodyStartOffset) {
+			std::ostringstream out;
+			out << "cannot read payload at " << id << " that has not been written";
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+		uint64_t bodyEndOffset = 0;
+		if (m_options.BatchSize - 1 != id % m_options.BatchSize)
+			bodyEndOffset = ReadMappedOffset(*pMappedFile, headerOffset + sizeof(uint64_t));
+
+		if (0 == bodyEndOffset) // payload extends to end of file
+			bodyEndOffset = pMappedFile->size();
+
+		if (bodyStartOffset > bodyEndOffset || bodyEndOffset > pMappedFile->size()) {
+			std::ostringstream out;
+			out << "payload at " << id << " extends past end of mapped file";
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+		auto payloadSize = static_cast<size_t>(bodyEndOffset - bodyStartOffset);
+		return { pMappedFile, { pMappedFile->data() + bodyStartOffset, payloadSize } };
+	}
+
 	std::unique_ptr<OutputStream> FileDatabase::outputStream(uint64_t id) {
 		auto filePath = getFilePath(id, true);
 
+		// rewriting an existing payload truncates the file, which would invalidate outstanding views into it
+		if (m_pMappedFileCache && m_pMappedFileCache->release(filePath) && contains(id))
+			ReplaceWithCopy(filePath);
+
 		auto isNewFile = !std::filesystem::exists(filePath) || bypassHeader();
 		auto rawFile = RawFile(filePath, isNewFile ? OpenMode::Read_Write : OpenMode::Read_Append);
 
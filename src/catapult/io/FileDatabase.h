@@ -22,6 +22,9 @@
 #pragma once
 #include "Stream.h"
 #include "catapult/config/CatapultDataDirectory.h"
+#include <memory>
+
+namespace catapult { namespace io { class MemoryMappedFile; } }
 
 namespace catapult { namespace io {
 
@@ -35,12 +38,27 @@ namespace catapult { namespace io {
 
 			/// Extension of created files.
 			std::string FileExtension;
+
+			/// \c true if payloads can be read from memory mapped files.
+			bool EnableMemoryMapping;
+		};
+
+		/// View of a payload in a memory mapped file.
+		struct PayloadView {
+			/// Memory mapped file containing the payload.
+			std::shared_ptr<const MemoryMappedFile> pMappedFile;
+
+			/// Payload data.
+			RawBuffer Payload;
 		};
 
 	public:
 		/// Creates a database in \a directory with \a options.
 		FileDatabase(const config::CatapultDirectory& directory, const Options& options);
 
+		/// Destroys the database.
+		~FileDatabase();
+
 	public:
 		/// Returns \c true if a payload for \a id is contained.
 		bool contains(uint64_t id) const;
@@ -48,9 +66,16 @@ namespace catapult { namespace io {
 		/// Gets an input stream for \a id and optionally returns the stream size (\a pSize).
 		std::unique_ptr<InputStream> inputStream(uint64_t id, size_t* pSize = nullptr) const;
 
+		/// Gets a view of the payload for \a id backed by a memory mapped file.
+		/// \note Memory mapping must be enabled and the view remains valid as long as it is referenced.
+		PayloadView payloadView(uint64_t id) const;
+
 		/// Gets an output stream for \a id.
 		std::unique_ptr<OutputStream> outputStream(uint64_t id);
 
+	private:
+		class MappedFileCache;
+
 	private:
 		bool bypassHeader() const;
 		uint64_t getHeaderOffset(uint64_t id) const;
@@ -59,5 +84,6 @@ namespace catapult { namespace io {
 	private:
 		config::CatapultDirectory m_directory;
 		Options m_options;
+		std::unique_ptr<MappedFileCache> m_pMappedFileCache;
 	};
 }}
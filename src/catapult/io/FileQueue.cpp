@@ -111,6 +111,18 @@ namespace catapult { namespace io {
 		return readerIndexValue > writerIndexValue ? 0 : writerIndexValue - readerIndexValue;
 	}
 
+	std::vector<std::vector<uint8_t>> FileQueueReader::peekNextMessages(size_t maxMessages) const {
+		std::vector<std::vector<uint8_t>> messages;
+		if (!m_writerIndexFile.exists())
+			return messages;
+
+		auto writerIndexValue = m_writerIndexFile.get();
+		for (auto indexValue = m_readerIndexFile.get(); indexValue < writerIndexValue && messages.size() < maxMessages; ++indexValue)
+			messages.push_back(ReadAllContents(getMessagePath(indexValue).generic_string()));
+
+		return messages;
+	}
+
 	bool FileQueueReader::tryReadNextMessage(const consumer<const std::vector<uint8_t>&>& consumer) {
 		return tryReadNextMessageConditional([consumer](const auto& buffer) {
 			consumer(buffer);
@@ -133,15 +145,20 @@ namespace catapult { namespace io {
 		}
 	}
 
+	std::filesystem::path FileQueueReader::getMessagePath(uint64_t indexValue) const {
+		auto messageFilename = m_directory / GetFilename(indexValue);
+		if (!std::filesystem::exists(messageFilename))
+			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", messageFilename);
+
+		return messageFilename;
+	}
+
 	bool FileQueueReader::process(const predicate<const std::string&>& processFilename) {
 		auto readerIndexValue = m_readerIndexFile.get();
 		if (!m_writerIndexFile.exists() || readerIndexValue >= m_writerIndexFile.get())
 			return false;
 
-		auto nextMessageFilename = m_directory / GetFilename(readerIndexValue);
-		if (!std::filesystem::exists(nextMessageFilename))
-			CATAPULT_THROW_RUNTIME_ERROR_1("reading from file queue failed due to missing message file", nextMessageFilename);
-
+		auto nextMessageFilename = getMessagePath(readerIndexValue);
 		if (!processFilename(nextMessageFilename.generic_string()))
 			return false; // file was not fully processed, so don't delete it
 
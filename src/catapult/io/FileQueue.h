@@ -62,6 +62,10 @@ namespace catapult { namespace io {
 		/// Gets the number of pending messages.
 		size_t pending() const;
 
+		/// Reads at most the next \a maxMessages messages without consuming them.
+		/// \note Messages should be consumed with skip after they have been fully processed.
+		std::vector<std::vector<uint8_t>> peekNextMessages(size_t maxMessages) const;
+
 	public:
 		/// Tries to read the next message and forwards it to \a consumer if successful.
 		bool tryReadNextMessage(const consumer<const std::vector<uint8_t>&>& consumer);
@@ -74,6 +78,8 @@ namespace catapult { namespace io {
 		void skip(uint32_t count);
 
 	private:
+		std::filesystem::path getMessagePath(uint64_t indexValue) const;
+
 		bool process(const predicate<const std::string&>& processFilename);
 
 	private:
@@ -0,0 +1,189 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "FileQueueWatcher.h"
+#include "catapult/config/CatapultDataDirectory.h"
+#include "catapult/utils/Logging.h"
+#include <chrono>
+#include <cstring>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace catapult { namespace io {
+
+	namespace {
+		constexpr int Invalid_Descriptor = -1;
+
+#ifdef __linux__
+		int CreateWatch(const std::string& directory) {
+			auto fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+			if (Invalid_Descriptor == fd) {
+				CATAPULT_LOG(warning) << "inotify_init1 failed: " << errno;
+				return Invalid_Descriptor;
+			}
+
+			// index files are updated in place, so it is sufficient to watch for closed writes and renames
+			if (0 > ::inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO)) {
+				CATAPULT_LOG(warning) << "inotify_add_watch failed for " << directory << ": " << errno;
+				::close(fd);
+				return Invalid_Descriptor;
+			}
+
+			return fd;
+		}
+
+		int CreateNotification() {
+			return ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		}
+
+		void CloseDescriptor(int fd) {
+			::close(fd);
+		}
+
+		void RaiseNotification(int fd) {
+			uint64_t value = 1;
+			if (sizeof(value) != ::write(fd, &value, sizeof(value)))
+				CATAPULT_LOG(warning) << "unable to raise file queue watcher notification: " << errno;
+		}
+
+		bool ConsumeNotification(int fd) {
+			uint64_t value;
+			return sizeof(value) == ::read(fd, &value, sizeof(value));
+		}
+
+		bool ConsumeWatchEvents(int fd, const std::string& indexFilename) {
+			alignas(inotify_event) char buffer[4096];
+			auto isIndexUpdated = false;
+			for (;;) {
+				auto numBytes = ::read(fd, buffer, sizeof(buffer));
+				if (0 >= numBytes)
+					return isIndexUpdated;
+
+				for (auto offset = 0; offset < numBytes;) {
+					inotify_event event;
+					std::memcpy(&event, buffer + offset, sizeof(inotify_event));
+
+					// treat dropped events as an update because they could have been for the index file
+					if (IN_Q_OVERFLOW & event.mask)
+						isIndexUpdated = true;
+					else if (0 != event.len && indexFilename == buffer + offset + sizeof(inotify_event))
+						isIndexUpdated = true;
+
+					offset += static_cast<int>(sizeof(inotify_event) + event.len);
+				}
+			}
+		}
+
+		bool WaitForEvents(int watchFd, int notifyFd, const std::string& indexFilename, std::chrono::milliseconds timeout) {
+			// other files in the directory (e.g. reader index files) can change too, so keep waiting until the index file is updated
+			auto deadline = std::chrono::steady_clock::now() + timeout;
+			for (;;) {
+				auto now = std::chrono::steady_clock::now();
+				auto remaining = deadline > now ? deadline - now : std::chrono::steady_clock::duration(0);
+				auto remainingMillis = std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+
+				pollfd descriptors[] = { { watchFd, POLLIN, 0 }, { notifyFd, POLLIN, 0 } };
+				if (0 >= ::poll(descriptors, 2, static_cast<int>(remainingMillis)))
+					return false;
+
+				// consume all pending events so that they are not reported by subsequent waits
+				auto isNotified = ConsumeNotification(notifyFd);
+				if (ConsumeWatchEvents(watchFd, indexFilename) || isNotified)
+					return true;
+			}
+		}
+#else
+		int CreateWatch(const std::string&) {
+			return Invalid_Descriptor;
+		}
+
+		int CreateNotification() {
+			return Invalid_Descriptor;
+		}
+
+		void CloseDescriptor(int)
+		{}
+
+		void RaiseNotification(int)
+		{}
+
+		bool WaitForEvents(int, int, const std::string&, std::chrono::milliseconds) {
+			return false;
+		}
+#endif
+	}
+
+	FileQueueWatcher::FileQueueWatcher(const std::string& directory, const std::string& indexFilename)
+			: m_indexFilename(indexFilename)
+			, m_watchFd(Invalid_Descriptor)
+			, m_notifyFd(Invalid_Descriptor)
+			, m_isNotified(false) {
+		config::CatapultDirectory(directory).create();
+
+		m_watchFd = CreateWatch(directory);
+		if (Invalid_Descriptor == m_watchFd)
+			return;
+
+		m_notifyFd = CreateNotification();
+		if (Invalid_Descriptor == m_notifyFd) {
+			CloseDescriptor(m_watchFd);
+			m_watchFd = Invalid_Descriptor;
+		}
+	}
+
+	FileQueueWatcher::~FileQueueWatcher() {
+		if (Invalid_Descriptor == m_watchFd)
+			return;
+
+		CloseDescriptor(m_watchFd);
+		CloseDescriptor(m_notifyFd);
+	}
+
+	bool FileQueueWatcher::wait(const utils::TimeSpan& timeout) {
+		auto timeoutMillis = std::chrono::milliseconds(timeout.millis());
+		if (Invalid_Descriptor != m_watchFd)
+			return WaitForEvents(m_watchFd, m_notifyFd, m_indexFilename, timeoutMillis);
+
+		std::unique_lock<std::mutex> lock(m_mutex);
+		auto isNotified = m_condition.wait_for(lock, timeoutMillis, [this]() { return m_isNotified; });
+		m_isNotified = false;
+		return isNotified;
+	}
+
+	void FileQueueWatcher::notify() {
+		if (Invalid_Descriptor != m_watchFd) {
+			RaiseNotification(m_notifyFd);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_isNotified = true;
+		}
+
+		m_condition.notify_all();
+	}
+}}
@@ -0,0 +1,60 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "catapult/utils/NonCopyable.h"
+#include "catapult/utils/TimeSpan.h"
+#include <condition_variable>
+#include <mutex>
+#include <string>
+
+namespace catapult { namespace io {
+
+	/// Watches the (writer) index file of a file queue for updates.
+	/// \note On platforms without file change notifications, waits only end early when notified.
+	class FileQueueWatcher : public utils::NonCopyable {
+	public:
+		/// Creates a watcher around \a directory containing a (writer) index file (\a indexFilename).
+		FileQueueWatcher(const std::string& directory, const std::string& indexFilename);
+
+		/// Destroys the watcher.
+		~FileQueueWatcher();
+
+	public:
+		/// Blocks until the index file is updated, notify is called or \a timeout elapses.
+		/// Returns \c true if an update or notification was detected.
+		/// \note Updates and notifications that occur while not waiting are reported by the next wait.
+		bool wait(const utils::TimeSpan& timeout);
+
+		/// Wakes up the current (or next) wait.
+		void notify();
+
+	private:
+		std::string m_indexFilename;
+		int m_watchFd;
+		int m_notifyFd;
+
+		// used when file change notifications are not supported
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		bool m_isNotified;
+	};
+}}
@@ -0,0 +1,150 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "MemoryMappedFile.h"
+#include "catapult/exceptions.h"
+#include <tuple>
+
+#ifdef _MSC_VER
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace catapult { namespace io {
+
+	namespace {
+		[[noreturn]]
+		void ThrowMappingError(const char* message, const std::string& pathname) {
+			std::ostringstream out;
+			out << message << " " << pathname;
+			CATAPULT_THROW_FILE_IO_ERROR(out.str().c_str());
+		}
+
+#ifdef _MSC_VER
+		class HandleGuard {
+		public:
+			explicit HandleGuard(HANDLE handle) : m_handle(handle)
+			{}
+
+			~HandleGuard() {
+				if (INVALID_HANDLE_VALUE != m_handle && nullptr != m_handle)
+					::CloseHandle(m_handle);
+			}
+
+		public:
+			HANDLE get() const {
+				return m_handle;
+			}
+
+		private:
+			HANDLE m_handle;
+		};
+
+		std::pair<const uint8_t*, uint64_t> MapFile(const std::string& pathname) {
+			auto shareMode = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
+			auto fileHandle = ::CreateFileA(
+					pathname.c_str(),
+					GENERIC_READ,
+					shareMode,
+					nullptr,
+					OPEN_EXISTING,
+					FILE_ATTRIBUTE_NORMAL,
+					nullptr);
+			HandleGuard file(fileHandle);
+			if (INVALID_HANDLE_VALUE == file.get())
+				ThrowMappingError("couldn't open the file", pathname);
+
+			LARGE_INTEGER fileSize;
+			if (!::GetFileSizeEx(file.get(), &fileSize))
+				ThrowMappingError("couldn't determine file size", pathname);
+
+			if (0 == fileSize.QuadPart)
+				return std::make_pair(nullptr, 0);
+
+			// the view keeps the mapping alive after both handles are closed
+			HandleGuard mapping(::CreateFileMappingA(file.get(), nullptr, PAGE_READONLY, 0, 0, nullptr));
+			if (nullptr == mapping.get())
+				ThrowMappingError("couldn't create file mapping", pathname);
+
+			const auto* pData = ::MapViewOfFile(mapping.get(), FILE_MAP_READ, 0, 0, 0);
+			if (nullptr == pData)
+				ThrowMappingError("couldn't map the file", pathname);
+
+			return std::make_pair(static_cast<const uint8_t*>(pData), static_cast<uint64_t>(fileSize.QuadPart));
+		}
+
+		void UnmapFile(const uint8_t* pData, uint64_t) {
+			::UnmapViewOfFile(pData);
+		}
+#else
+		std::pair<const uint8_t*, uint64_t> MapFile(const std::string& pathname) {
+			auto fd = ::open(pathname.c_str(), O_RDONLY | O_CLOEXEC);
+			if (-1 == fd)
+				ThrowMappingError("couldn't open the file", pathname);
+
+			struct stat fileStat;
+			if (-1 == ::fstat(fd, &fileStat)) {
+				::close(fd);
+				ThrowMappingError("couldn't determine file size", pathname);
+			}
+
+			auto fileSize = static_cast<uint64_t>(fileStat.st_size);
+			if (0 == fileSize) {
+				::close(fd);
+				return std::make_pair(nullptr, 0);
+			}
+
+			// the mapping remains valid after the descriptor is closed
+			auto* pData = ::mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fd, 0);
+			::close(fd);
+			if (MAP_FAILED == pData)
+				ThrowMappingError("couldn't map the file", pathname);
+
+			return std::make_pair(static_cast<const uint8_t*>(pData), fileSize);
+		}
+
+		void UnmapFile(const uint8_t* pData, uint64_t size) {
+			::munmap(const_cast<uint8_t*>(pData), size);
+		}
+#endif
+	}
+
+	MemoryMappedFile::MemoryMappedFile(const std::string& pathname) {
+		std::tie(m_pData, m_size) = MapFile(pathname);
+	}
+
+	MemoryMappedFile::~MemoryMappedFile() {
+		if (m_pData)
+			UnmapFile(m_pData, m_size);
+	}
+
+	uint64_t MemoryMappedFile::size() const {
+		return m_size;
+	}
+
+	const uint8_t* MemoryMappedFile::data() const {
+		return m_pData;
+	}
+}}
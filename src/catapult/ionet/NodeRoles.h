@@ -43,7 +43,10 @@ namespace catapult { namespace ionet {
 		IPv4 = 0x40,
 
 		/// IPv6 compatible node.
-		IPv6 = 0x80
+		IPv6 = 0x80,
+
+		/// Node able to read compressed packets.
+		Compression = 0x100
 	};
 
 	MAKE_BITWISE_ENUM(NodeRoles)
@@ -0,0 +1,117 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PacketCompression.h"
+#include "catapult/exceptions.h"
+#include <zlib.h>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		constexpr auto Compression_Level = Z_BEST_SPEED;
+
+		// deflate cannot expand data by more than this factor, so larger declared sizes are never valid
+		constexpr uint64_t Max_Decompression_Ratio = 1032;
+
+		uint8_t* GetCompressedData(CompressedPacket& packet) {
+			return reinterpret_cast<uint8_t*>(&packet) + sizeof(CompressedPacket);
+		}
+
+		const uint8_t* GetCompressedData(const CompressedPacket& packet) {
+			return reinterpret_cast<const uint8_t*>(&packet) + sizeof(CompressedPacket);
+		}
+
+		uint8_t* GetData(Packet& packet) {
+			// unlike Packet::Data, return a valid pointer for empty packets because zlib requires non-null buffers
+			return reinterpret_cast<uint8_t*>(&packet) + sizeof(Packet);
+		}
+	}
+
+	PacketPayload CompressPacketPayload(const PacketPayload& payload) {
+		const auto& header = payload.header();
+		auto dataSize = header.Size - SizeOf32<PacketHeader>();
+
+		z_stream stream{};
+		if (Z_OK != deflateInit(&stream, Compression_Level))
+			CATAPULT_THROW_RUNTIME_ERROR("unable to initialize deflate stream");
+
+		auto maxCompressedDataSize = static_cast<uint32_t>(deflateBound(&stream, dataSize));
+		auto pPacket = utils::MakeSharedWithSize<CompressedPacket>(SizeOf32<CompressedPacket>() + maxCompressedDataSize);
+		pPacket->Type = CompressedPacket::Packet_Type;
+		pPacket->WrappedType = header.Type;
+		pPacket->WrappedDataSize = dataSize;
+
+		stream.next_out = GetCompressedData(*pPacket);
+		stream.avail_out = maxCompressedDataSize;
+
+		auto result = Z_OK;
+		for (const auto& buffer : payload.buffers()) {
+			stream.next_in = const_cast<uint8_t*>(buffer.pData);
+			stream.avail_in = static_cast<uInt>(buffer.Size);
+			result = deflate(&stream, Z_NO_FLUSH);
+			if (Z_OK != result)
+				break;
+		}
+
+		if (Z_OK == result)
+			result = deflate(&stream, Z_FINISH);
+
+		pPacket->Size = SizeOf32<CompressedPacket>() + static_cast<uint32_t>(stream.total_out);
+		deflateEnd(&stream);
+
+		if (Z_STREAM_END != result)
+			CATAPULT_THROW_RUNTIME_ERROR_1("unable to compress packet payload", result);
+
+		return PacketPayload(pPacket);
+	}
+
+	std::shared_ptr<Packet> DecompressPacket(const Packet& packet, size_t maxPacketDataSize) {
+		if (CompressedPacket::Packet_Type != packet.Type || packet.Size < sizeof(CompressedPacket))
+			return nullptr;
+
+		const auto& compressedPacket = static_cast<const CompressedPacket&>(packet);
+		if (CompressedPacket::Packet_Type == compressedPacket.WrappedType || compressedPacket.WrappedDataSize > maxPacketDataSize)
+			return nullptr;
+
+		// reject implausible sizes before allocating the wrapped packet, which is sized by the (untrusted) declared size
+		auto compressedDataSize = packet.Size - SizeOf32<CompressedPacket>();
+		if (compressedPacket.WrappedDataSize > compressedDataSize * Max_Decompression_Ratio)
+			return nullptr;
+
+		z_stream stream{};
+		if (Z_OK != inflateInit(&stream))
+			CATAPULT_THROW_RUNTIME_ERROR("unable to initialize inflate stream");
+
+		auto pPacket = CreateSharedPacket<Packet>(compressedPacket.WrappedDataSize);
+		pPacket->Type = compressedPacket.WrappedType;
+
+		stream.next_in = const_cast<uint8_t*>(GetCompressedData(compressedPacket));
+		stream.avail_in = compressedDataSize;
+		stream.next_out = GetData(*pPacket);
+		stream.avail_out = compressedPacket.WrappedDataSize;
+
+		// all compressed data must be consumed and must fill the wrapped packet exactly
+		auto result = inflate(&stream, Z_FINISH);
+		auto isValid = Z_STREAM_END == result && 0 == stream.avail_in && 0 == stream.avail_out;
+		inflateEnd(&stream);
+		return isValid ? pPacket : nullptr;
+	}
+}}
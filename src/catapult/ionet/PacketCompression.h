@@ -0,0 +1,51 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PacketPayload.h"
+
+namespace catapult { namespace ionet {
+
+#pragma pack(push, 1)
+
+	/// Packet wrapping the deflate compressed data of another packet.
+	struct CompressedPacket : public Packet {
+		static constexpr PacketType Packet_Type = PacketType::Compressed_Payload;
+
+		/// Type of the wrapped packet.
+		PacketType WrappedType;
+
+		/// Uncompressed data size of the wrapped packet.
+		uint32_t WrappedDataSize;
+
+		// followed by compressed data of the wrapped packet
+	};
+
+#pragma pack(pop)
+
+	/// Compresses \a payload into a compressed packet payload.
+	PacketPayload CompressPacketPayload(const PacketPayload& payload);
+
+	/// Decompresses compressed \a packet given \a maxPacketDataSize.
+	/// \note \c nullptr is returned when \a packet is malformed or its uncompressed data size exceeds \a maxPacketDataSize
+	///       or cannot be produced by its compressed data.
+	std::shared_ptr<Packet> DecompressPacket(const Packet& packet, size_t maxPacketDataSize);
+}}
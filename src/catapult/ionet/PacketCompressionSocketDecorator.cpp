@@ -0,0 +1,166 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "PacketCompressionSocketDecorator.h"
+#include "PacketCompression.h"
+#include "PacketSocketDecorator.h"
+#include <algorithm>
+#include <atomic>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		// region PacketCompressor
+
+		class PacketCompressor : public std::enable_shared_from_this<PacketCompressor> {
+		public:
+			PacketCompressor(const PacketCompressionSettings& settings, bool isRemoteCompressionCapable)
+					: m_settings(settings)
+					, m_isRemoteCompressionCapable(isRemoteCompressionCapable)
+					, m_requiresAdvertisement(isRemoteCompressionCapable)
+			{}
+
+		public:
+			PacketPayload compress(const PacketPayload& payload) {
+				if (!m_isRemoteCompressionCapable || payload.unset())
+					return payload;
+
+				// compress the first written packet unconditionally to advertise compression support to the remote node
+				if (m_requiresAdvertisement.exchange(false))
+					return payload.compressed(CompressPacketPayload);
+
+				if (!isCompressible(payload.header()))
+					return payload;
+
+				// the same payload is commonly broadcast to many peers, so only compress it once
+				auto compressedPayload = payload.compressed(CompressPacketPayload);
+				return compressedPayload.header().Size < payload.header().Size ? compressedPayload : payload;
+			}
+
+			PacketIo::ReadCallback wrap(const PacketIo::ReadCallback& callback) {
+				return [pThis = shared_from_this(), callback](auto code, const auto* pPacket) {
+					if (!pPacket || CompressedPacket::Packet_Type != pPacket->Type)
+						return callback(code, pPacket);
+
+					auto pDecompressedPacket = DecompressPacket(*pPacket, pThis->m_settings.MaxPacketDataSize);
+					if (!pDecompressedPacket)
+						return callback(SocketOperationCode::Malformed_Data, nullptr);
+
+					// remote node is able to read compressed packets, so it no longer needs to be told that the local node is
+					pThis->m_isRemoteCompressionCapable = true;
+					pThis->m_requiresAdvertisement = false;
+					callback(code, pDecompressedPacket.get());
+				};
+			}
+
+		private:
+			bool isCompressible(const PacketHeader& header) const {
+				if (header.Size - sizeof(PacketHeader) < m_settings.MinCompressiblePacketDataSize)
+					return false;
+
+				const auto& packetTypes = m_settings.CompressiblePacketTypes;
+				return packetTypes.cend() != std::find(packetTypes.cbegin(), packetTypes.cend(), header.Type);
+			}
+
+		private:
+			PacketCompressionSettings m_settings;
+			std::atomic_bool m_isRemoteCompressionCapable;
+			std::atomic_bool m_requiresAdvertisement;
+		};
+
+		// endregion
+
+		// region CompressingPacketIo / DecompressingBatchPacketReader
+
+		class CompressingPacketIo : public PacketIo {
+		public:
+			CompressingPacketIo(const std::shared_ptr<PacketIo>& pIo, const std::shared_ptr<PacketCompressor>& pCompressor)
+					: m_pIo(pIo)
+					, m_pCompressor(pCompressor)
+			{}
+
+		public:
+			void write(const PacketPayload& payload, const WriteCallback& callback) override {
+				m_pIo->write(m_pCompressor->compress(payload), callback);
+			}
+
+			void read(const ReadCallback& callback) override {
+				m_pIo->read(m_pCompressor->wrap(callback));
+			}
+
+		private:
+			std::shared_ptr<PacketIo> m_pIo;
+			std::shared_ptr<PacketCompressor> m_pCompressor;
+		};
+
+		class DecompressingBatchPacketReader : public BatchPacketReader {
+		public:
+			DecompressingBatchPacketReader(
+					const std::shared_ptr<BatchPacketReader>& pReader,
+					const std::shared_ptr<PacketCompressor>& pCompressor)
+					: m_pReader(pReader)
+					, m_pCompressor(pCompressor)
+			{}
+
+		public:
+			void readMultiple(const PacketIo::ReadCallback& callback) override {
+				m_pReader->readMultiple(m_pCompressor->wrap(callback));
+			}
+
+		private:
+			std::shared_ptr<BatchPacketReader> m_pReader;
+			std::shared_ptr<PacketCompressor> m_pCompressor;
+		};
+
+		// endregion
+
+		// region PacketCompressionWrapFactory
+
+		class PacketCompressionWrapFactory {
+		public:
+			PacketCompressionWrapFactory(const PacketCompressionSettings& settings, bool isRemoteCompressionCapable)
+					: m_pCompressor(std::make_shared<PacketCompressor>(settings, isRemoteCompressionCapable))
+			{}
+
+		public:
+			std::shared_ptr<PacketIo> wrapIo(const std::shared_ptr<PacketIo>& pIo) const {
+				return std::make_shared<CompressingPacketIo>(pIo, m_pCompressor);
+			}
+
+			std::shared_ptr<BatchPacketReader> wrapReader(const std::shared_ptr<BatchPacketReader>& pReader) const {
+				return std::make_shared<DecompressingBatchPacketReader>(pReader, m_pCompressor);
+			}
+
+		private:
+			std::shared_ptr<PacketCompressor> m_pCompressor;
+		};
+
+		// endregion
+	}
+
+	std::shared_ptr<PacketSocket> AddPacketCompression(
+			const std::shared_ptr<PacketSocket>& pSocket,
+			const PacketCompressionSettings& settings,
+			bool isRemoteCompressionCapable) {
+		PacketCompressionWrapFactory wrapFactory(settings, isRemoteCompressionCapable);
+		return std::make_shared<PacketSocketDecorator<PacketCompressionWrapFactory>>(pSocket, wrapFactory);
+	}
+}}
@@ -0,0 +1,53 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "PacketType.h"
+#include <memory>
+#include <vector>
+
+namespace catapult { namespace ionet { class PacketSocket; } }
+
+namespace catapult { namespace ionet {
+
+	/// Packet compression settings.
+	struct PacketCompressionSettings {
+		/// Types of packets that are compressed.
+		std::vector<PacketType> CompressiblePacketTypes;
+
+		/// Minimum data size of a packet that is compressed.
+		size_t MinCompressiblePacketDataSize;
+
+		/// Maximum data size of a decompressed packet.
+		size_t MaxPacketDataSize;
+	};
+
+	/// Adds packet compression to a packet socket (\a pSocket) given \a settings.
+	/// Compressed packets are always decompressed when read, but packets are only compressed when written after the remote node
+	/// is known to support compression, either because \a isRemoteCompressionCapable is set (the remote node advertised compression support)
+	/// or because a compressed packet was read.
+	/// \note When \a isRemoteCompressionCapable is set, the first written packet is always compressed so that the remote node
+	///       learns that the local node supports compression.
+	std::shared_ptr<PacketSocket> AddPacketCompression(
+			const std::shared_ptr<PacketSocket>& pSocket,
+			const PacketCompressionSettings& settings,
+			bool isRemoteCompressionCapable);
+}}
@@ -21,6 +21,7 @@
 
 #include "PacketHandlers.h"
 #include "catapult/utils/Casting.h"
+#include "catapult/utils/StackTimer.h"
 
 namespace catapult { namespace ionet {
 
@@ -70,7 +71,9 @@ namespace catapult { namespace ionet {
 
 	// region ServerPacketHandlers
 
-	ServerPacketHandlers::ServerPacketHandlers(uint32_t maxPacketDataSize) : m_maxPacketDataSize(maxPacketDataSize)
+	ServerPacketHandlers::ServerPacketHandlers(uint32_t maxPacketDataSize)
+			: m_maxPacketDataSize(maxPacketDataSize)
+			, m_pProcessHistogram(std::make_shared<utils::DiagnosticHistogram>())
 	{}
 
 	size_t ServerPacketHandlers::size() const {
@@ -117,10 +120,16 @@ namespace catapult { namespace ionet {
 		}
 
 		CATAPULT_LOG(trace) << "processing " << packet;
+		utils::StackTimer timer;
 		pDescriptor->Handler(packet, context);
+		m_pProcessHistogram->record(timer.micros());
 		return true;
 	}
 
+	const utils::DiagnosticHistogram& ServerPacketHandlers::processHistogram() const {
+		return *m_pProcessHistogram;
+	}
+
 	void ServerPacketHandlers::setAllowedHosts(const std::unordered_set<std::string>& hosts) {
 		m_activeAllowedHosts = hosts;
 	}
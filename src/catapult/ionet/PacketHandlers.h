@@ -22,10 +22,12 @@
 #pragma once
 #include "IoTypes.h"
 #include "PacketPayload.h"
+#include "catapult/utils/DiagnosticHistogram.h"
 #include "catapult/utils/NonCopyable.h"
 #include "catapult/constants.h"
 #include "catapult/functions.h"
 #include "catapult/types.h"
+#include <memory>
 #include <unordered_set>
 #include <vector>
 
@@ -97,6 +99,10 @@ namespace catapult { namespace ionet {
 		/// packet was processed.
 		bool process(const Packet& packet, ContextType& context) const;
 
+		/// Gets the histogram of handler durations (in microseconds) of all processed packets.
+		/// \note The histogram is shared by all copies of these handlers.
+		const utils::DiagnosticHistogram& processHistogram() const;
+
 	public:
 		/// Sets the \a hosts that are allowed to access subsequently registered handlers.
 		void setAllowedHosts(const std::unordered_set<std::string>& hosts);
@@ -117,5 +123,6 @@ namespace catapult { namespace ionet {
 		uint32_t m_maxPacketDataSize;
 		std::vector<PacketHandlerDescriptor> m_descriptors;
 		std::unordered_set<std::string> m_activeAllowedHosts;
+		std::shared_ptr<utils::DiagnosticHistogram> m_pProcessHistogram;
 	};
 }}
@@ -20,9 +20,23 @@
 **/
 
 #include "PacketPayload.h"
+#include <mutex>
 
 namespace catapult { namespace ionet {
 
+	struct PacketPayload::SharedPacketData {
+	public:
+		explicit SharedPacketData(PacketData&& data) : Data(std::move(data))
+		{}
+
+	public:
+		PacketData Data;
+
+		// lazily compressed payload
+		mutable std::mutex CompressedPayloadMutex;
+		mutable PacketPayload CompressedPayload;
+	};
+
 	PacketPayload::PacketPayload() {
 		m_header.Size = 0u;
 		m_header.Type = PacketType::Undefined;
@@ -41,10 +55,17 @@ namespace catapult { namespace ionet {
 		if (pPacket->Size == sizeof(PacketHeader))
 			return;
 
-		m_entities.push_back(pPacket);
-		m_buffers.push_back({ pPacket->Data(), m_header.Size - sizeof(PacketHeader) });
+		PacketData data;
+		data.Entities.push_back(pPacket);
+		data.Buffers.push_back({ pPacket->Data(), m_header.Size - sizeof(PacketHeader) });
+		m_pData = std::make_shared<const SharedPacketData>(std::move(data));
 	}
 
+	PacketPayload::PacketPayload(const PacketHeader& header, PacketData&& data)
+			: m_header(header)
+			, m_pData(data.Buffers.empty() ? nullptr : std::make_shared<const SharedPacketData>(std::move(data)))
+	{}
+
 	bool PacketPayload::unset() const {
 		return 0u == m_header.Size;
 	}
@@ -54,25 +75,48 @@ namespace catapult { namespace ionet {
 	}
 
 	const std::vector<RawBuffer>& PacketPayload::buffers() const {
-		return m_buffers;
+		static const std::vector<RawBuffer> Empty_Buffers;
+		return m_pData ? m_pData->Data.Buffers : Empty_Buffers;
+	}
+
+	PacketPayload PacketPayload::compressed(const std::function<PacketPayload (const PacketPayload&)>& compress) const {
+		// data-less payloads are cheap to compress and are not shared
+		if (!m_pData)
+			return compress(*this);
+
+		// when compression fails, nothing is cached and a subsequent call will try again
+		std::lock_guard<std::mutex> lock(m_pData->CompressedPayloadMutex);
+		if (m_pData->CompressedPayload.unset())
+			m_pData->CompressedPayload = compress(*this);
+
+		return m_pData->CompressedPayload;
 	}
 
 	PacketPayload PacketPayload::Merge(const std::shared_ptr<const Packet>& pPacket, const PacketPayload& payload) {
 		// pPacket should envelop payload
-		PacketPayload mergedPayload(pPacket);
+		PacketPayload packetPayload(pPacket);
 		if (payload.unset())
-			return mergedPayload;
+			return packetPayload;
 
-		mergedPayload.m_header.Size += payload.m_header.Size;
+		auto header = packetPayload.m_header;
+		header.Size += payload.m_header.Size;
+
+		PacketData data;
+		if (packetPayload.m_pData)
+			data = packetPayload.m_pData->Data;
 
 		// add payload header
 		auto pChildPacketHeader = std::make_shared<PacketHeader>(payload.m_header);
-		mergedPayload.m_entities.push_back(pChildPacketHeader);
-		mergedPayload.m_buffers.push_back({ reinterpret_cast<const uint8_t*>(pChildPacketHeader.get()), sizeof(PacketHeader) });
+		data.Entities.push_back(pChildPacketHeader);
+		data.Buffers.push_back({ reinterpret_cast<const uint8_t*>(pChildPacketHeader.get()), sizeof(PacketHeader) });
 
 		// add payload buffers
-		mergedPayload.m_entities.insert(mergedPayload.m_entities.end(), payload.m_entities.cbegin(), payload.m_entities.cend());
-		mergedPayload.m_buffers.insert(mergedPayload.m_buffers.end(), payload.m_buffers.cbegin(), payload.m_buffers.cend());
-		return mergedPayload;
+		if (payload.m_pData) {
+			const auto& childData = payload.m_pData->Data;
+			data.Entities.insert(data.Entities.end(), childData.Entities.cbegin(), childData.Entities.cend());
+			data.Buffers.insert(data.Buffers.end(), childData.Buffers.cbegin(), childData.Buffers.cend());
+		}
+
+		return PacketPayload(header, std::move(data));
 	}
 }}
@@ -22,11 +22,14 @@
 #pragma once
 #include "Packet.h"
 #include "catapult/types.h"
+#include <functional>
+#include <memory>
 #include <vector>
 
 namespace catapult { namespace ionet {
 
 	/// Packet payload that can be written.
+	/// \note Packet data is immutable and shared among all copies, so a single payload can be cheaply written to many peers.
 	class PacketPayload {
 	public:
 		/// Creates a default (empty) packet payload.
@@ -48,16 +51,30 @@ namespace catapult { namespace ionet {
 		/// Packet data.
 		const std::vector<RawBuffer>& buffers() const;
 
+		/// Gets the compressed packet payload created by \a compress.
+		/// \note Compressed payload is shared among all copies, so packet data is compressed at most once.
+		PacketPayload compressed(const std::function<PacketPayload (const PacketPayload&)>& compress) const;
+
 	public:
 		/// Merges a packet (\a pPacket) and a packet \a payload into a new packet payload.
 		static PacketPayload Merge(const std::shared_ptr<const Packet>& pPacket, const PacketPayload& payload);
 
 	private:
-		PacketHeader m_header;
-		std::vector<RawBuffer> m_buffers;
+		struct PacketData {
+			std::vector<RawBuffer> Buffers;
+
+			// the backing data
+			std::vector<std::shared_ptr<const void>> Entities;
+		};
+
+		struct SharedPacketData;
 
-		// the backing data
-		std::vector<std::shared_ptr<const void>> m_entities;
+	private:
+		PacketPayload(const PacketHeader& header, PacketData&& data);
+
+	private:
+		PacketHeader m_header;
+		std::shared_ptr<const SharedPacketData> m_pData;
 
 	private:
 		friend class PacketPayloadBuilder;
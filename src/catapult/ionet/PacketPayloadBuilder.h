@@ -37,9 +37,10 @@ namespace catapult { namespace ionet {
 		/// Creates builder for a packet with the specified \a type and max packet data size (\a maxPacketDataSize).
 		PacketPayloadBuilder(PacketType type, uint32_t maxPacketDataSize)
 				: m_maxPacketDataSize(maxPacketDataSize)
-				, m_payload(type)
-				, m_hasError(false)
-		{}
+				, m_hasError(false) {
+			m_header.Size = sizeof(PacketHeader);
+			m_header.Type = type;
+		}
 
 	public:
 		/// Appends a single entity (\a pEntity) to the payload.
@@ -48,8 +49,8 @@ namespace catapult { namespace ionet {
 			if (!increaseSize(pEntity->Size))
 				return false;
 
-			m_payload.m_buffers.push_back({ reinterpret_cast<const uint8_t*>(pEntity.get()), pEntity->Size });
-			m_payload.m_entities.push_back(pEntity);
+			m_data.Buffers.push_back({ reinterpret_cast<const uint8_t*>(pEntity.get()), pEntity->Size });
+			m_data.Entities.push_back(pEntity);
 			return true;
 		}
 
@@ -85,8 +86,8 @@ namespace catapult { namespace ionet {
 				return false;
 
 			if (!range.empty()) {
-				m_payload.m_buffers.push_back({ reinterpret_cast<const uint8_t*>(range.data()), rangeSize });
-				m_payload.m_entities.push_back(std::make_shared<model::EntityRange<TEntity>>(std::move(range)));
+				m_data.Buffers.push_back({ reinterpret_cast<const uint8_t*>(range.data()), rangeSize });
+				m_data.Entities.push_back(std::make_shared<model::EntityRange<TEntity>>(std::move(range)));
 			}
 
 			return true;
@@ -99,8 +100,8 @@ namespace catapult { namespace ionet {
 				return false;
 
 			auto pValue = std::make_shared<TValue>(value);
-			m_payload.m_buffers.push_back({ reinterpret_cast<const uint8_t*>(pValue.get()), sizeof(TValue) });
-			m_payload.m_entities.push_back(pValue);
+			m_data.Buffers.push_back({ reinterpret_cast<const uint8_t*>(pValue.get()), sizeof(TValue) });
+			m_data.Entities.push_back(pValue);
 			return true;
 		}
 
@@ -114,8 +115,8 @@ namespace catapult { namespace ionet {
 			if (!values.empty()) {
 				auto pValues = utils::MakeSharedWithSize<uint8_t>(valuesSize);
 				std::memcpy(pValues.get(), values.data(), valuesSize);
-				m_payload.m_buffers.push_back({ pValues.get(), valuesSize });
-				m_payload.m_entities.push_back(pValues);
+				m_data.Buffers.push_back({ pValues.get(), valuesSize });
+				m_data.Entities.push_back(pValues);
 			}
 
 			return true;
@@ -141,14 +142,13 @@ namespace catapult { namespace ionet {
 	public:
 		/// Builds the packet payload.
 		PacketPayload build() {
-			return m_hasError ? PacketPayload() : std::move(m_payload);
+			return m_hasError ? PacketPayload() : PacketPayload(m_header, std::move(m_data));
 		}
 
 	private:
 		bool increaseSize(uint32_t numBytes) {
 			// check for overflow and against m_maxPacketDataSize
-			auto& header = m_payload.m_header;
-			if (m_hasError || !utils::CheckedAdd(header.Size, numBytes) || !IsPacketDataSizeValid(header, m_maxPacketDataSize)) {
+			if (m_hasError || !utils::CheckedAdd(m_header.Size, numBytes) || !IsPacketDataSizeValid(m_header, m_maxPacketDataSize)) {
 				m_hasError = true;
 				return false;
 			}
@@ -158,7 +158,8 @@ namespace catapult { namespace ionet {
 
 	private:
 		uint32_t m_maxPacketDataSize;
-		PacketPayload m_payload;
+		PacketHeader m_header;
+		PacketPayload::PacketData m_data;
 		bool m_hasError;
 	};
 }}
@@ -175,9 +175,10 @@ namespace catapult { namespace ionet {
 					return;
 				}
 
+				// write header and all data buffers with a single gather write
 				auto pContext = std::make_shared<WriteContext>(payload, callback);
-				boost::asio::async_write(m_socket, pContext->headerBuffer(), m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
+				boost::asio::async_write(m_socket, pContext->buffers(), m_wrapper.wrap([pContext](const auto& ec, auto) {
+					pContext->complete(ec);
 				}));
 			}
 
@@ -186,47 +187,29 @@ namespace catapult { namespace ionet {
 			public:
 				WriteContext(const PacketPayload& payload, const PacketSocket::WriteCallback& callback)
 						: m_payload(payload)
-						, m_callback(callback)
-						, m_nextBufferIndex(0)
-				{}
-
-			public:
-				auto headerBuffer() const {
+						, m_callback(callback) {
 					const auto& header = m_payload.header();
-					return boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header));
+					m_buffers.reserve(1 + m_payload.buffers().size());
+					m_buffers.push_back(boost::asio::buffer(reinterpret_cast<const uint8_t*>(&header), sizeof(header)));
+					for (const auto& rawBuffer : m_payload.buffers())
+						m_buffers.push_back(boost::asio::buffer(rawBuffer.pData, rawBuffer.Size));
 				}
 
-				auto nextDataBuffer() {
-					auto rawBuffer = m_payload.buffers()[m_nextBufferIndex++];
-					return boost::asio::buffer(rawBuffer.pData, rawBuffer.Size);
+			public:
+				const auto& buffers() const {
+					return m_buffers;
 				}
 
-				bool tryComplete(const boost::system::error_code& ec) {
-					auto lastCode = mapWriteErrorCodeToSocketOperationCode(ec);
-					if (SocketOperationCode::Success != lastCode || m_nextBufferIndex >= m_payload.buffers().size()) {
-						m_callback(lastCode);
-						return true;
-					}
-
-					return false;
+				void complete(const boost::system::error_code& ec) {
+					m_callback(mapWriteErrorCodeToSocketOperationCode(ec));
 				}
 
 			private:
 				const PacketPayload m_payload;
 				const PacketSocket::WriteCallback m_callback;
-				size_t m_nextBufferIndex;
+				std::vector<boost::asio::const_buffer> m_buffers;
 			};
 
-			void writeNext(const boost::system::error_code& lastEc, const std::shared_ptr<WriteContext>& pContext) {
-				if (pContext->tryComplete(lastEc))
-					return;
-
-				auto buffer = pContext->nextDataBuffer();
-				boost::asio::async_write(m_socket, buffer, m_wrapper.wrap([this, pContext](const auto& ec, auto) {
-					this->writeNext(ec, pContext);
-				}));
-			}
-
 		private:
 			Socket& m_socket;
 			TSocketCallbackWrapper& m_wrapper;
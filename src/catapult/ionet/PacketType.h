@@ -67,6 +67,9 @@ namespace catapult { namespace ionet {
 	/* Sub cache merkle roots have been requested. */ \
 	ENUM_VALUE(Sub_Cache_Merkle_Roots, 12) \
 	\
+	/* Packet wrapping the compressed data of another packet. */ \
+	ENUM_VALUE(Compressed_Payload, 13) \
+	\
 	/* partial transactions packets have types [0x100, 0x110) */ \
 	\
 	/* Partial aggregate transactions have been pushed by an api-node. */ \
@@ -163,6 +166,9 @@ namespace catapult { namespace ionet {
 	/* Unlocked accounts have been requested by a client. */ \
 	ENUM_VALUE(Unlocked_Accounts, 0x304) \
 	\
+	/* Request for the current diagnostic histogram values. */ \
+	ENUM_VALUE(Diagnostic_Histograms, 0x305) \
+	\
 	/* diagnostic info packets have types [0x400, 0x500) - ordered by facility code name */ \
 	\
 	/* Account infos have been requested by a client. */ \
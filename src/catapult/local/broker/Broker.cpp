@@ -23,6 +23,7 @@
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/ProcessBootstrapper.h"
 #include "catapult/io/FileQueue.h"
+#include "catapult/io/FileQueueWatcher.h"
 #include "catapult/local/HostUtils.h"
 #include "catapult/subscribers/BlockChangeReader.h"
 #include "catapult/subscribers/BrokerMessageReaders.h"
@@ -31,12 +32,20 @@
 #include "catapult/subscribers/StateChangeReader.h"
 #include "catapult/subscribers/TransactionStatusReader.h"
 #include "catapult/subscribers/UtChangeReader.h"
-#include "catapult/thread/Scheduler.h"
+#include "catapult/thread/ThreadGroup.h"
+#include "catapult/thread/ThreadInfo.h"
 #include "catapult/utils/StackLogger.h"
+#include <atomic>
 
 namespace catapult { namespace local {
 
 	namespace {
+		// maximum time between two ingestions of the same queue when no updates are detected
+		constexpr auto Max_Ingestion_Interval = utils::TimeSpan::FromMilliseconds(500);
+
+		// number of block changes that are processed (and flushed) together when the broker is far behind the server
+		constexpr size_t Block_Change_Catch_Up_Batch_Size = 250;
+
 		class DefaultBroker final : public Broker {
 		public:
 			explicit DefaultBroker(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper)
@@ -50,6 +59,7 @@ namespace catapult { namespace local {
 					, m_pStateChangeSubscriber(m_pBootstrapper->subscriptionManager().createStateChangeSubscriber())
 					, m_pTransactionStatusSubscriber(m_pBootstrapper->subscriptionManager().createTransactionStatusSubscriber())
 					, m_pluginManager(m_pBootstrapper->pluginManager())
+					, m_isShutdown(false)
 			{}
 
 			~DefaultBroker() override {
@@ -72,6 +82,11 @@ namespace catapult { namespace local {
 			void shutdown() override {
 				utils::StackLogger stackLogger("shutting down broker", utils::LogLevel::info);
 
+				m_isShutdown = true;
+				for (const auto& pWatcher : m_queueWatchers)
+					pWatcher->notify();
+
+				m_ingestionThreads.join();
 				m_pBootstrapper->pool().shutdown();
 			}
 
@@ -79,34 +94,43 @@ namespace catapult { namespace local {
 			void startIngestion() {
 				using namespace catapult::subscribers;
 
-				auto pServiceGroup = m_pBootstrapper->pool().pushServiceGroup("scheduler");
-				auto pScheduler = pServiceGroup->pushService(thread::CreateScheduler);
-				pScheduler->addTask(createIngestionTask("block_change", *m_pBlockChangeSubscriber, ReadNextBlockChange));
-				pScheduler->addTask(createIngestionTask("unconfirmed_transactions_change", *m_pUtChangeSubscriber, ReadNextUtChange));
-				pScheduler->addTask(createIngestionTask("partial_transactions_change", *m_pPtChangeSubscriber, ReadNextPtChange));
-				pScheduler->addTask(createIngestionTask("finalization", *m_pFinalizationSubscriber, ReadNextFinalization));
-				pScheduler->addTask(createIngestionTask("state_change", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
+				startQueueIngestion("block_change", *m_pBlockChangeSubscriber, ReadNextBlockChange, Block_Change_Catch_Up_Batch_Size);
+				startQueueIngestion("unconfirmed_transactions_change", *m_pUtChangeSubscriber, ReadNextUtChange);
+				startQueueIngestion("partial_transactions_change", *m_pPtChangeSubscriber, ReadNextPtChange);
+				startQueueIngestion("finalization", *m_pFinalizationSubscriber, ReadNextFinalization);
+				startQueueIngestion("state_change", *m_pStateChangeSubscriber, [&catapultCache = m_catapultCache](
 						auto& inputStream,
 						auto& subscriber) {
 					return ReadNextStateChange(inputStream, catapultCache.changesStorages(), subscriber);
-				}));
-				pScheduler->addTask(createIngestionTask("transaction_status", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus));
+				});
+				startQueueIngestion("transaction_status", *m_pTransactionStatusSubscriber, ReadNextTransactionStatus);
 			}
 
 			template<typename TSubscriber, typename TMessageReader>
-			thread::Task createIngestionTask(const std::string& queueName, TSubscriber& subscriber, TMessageReader readNextMessage) {
-				thread::Task task;
-				task.StartDelay = utils::TimeSpan::FromMilliseconds(100);
-				task.NextDelay = thread::CreateUniformDelayGenerator(utils::TimeSpan::FromMilliseconds(500));
-				task.Name = queueName;
-
+			void startQueueIngestion(
+					const std::string& queueName,
+					TSubscriber& subscriber,
+					TMessageReader readNextMessage,
+					size_t catchUpBatchSize = 0) {
+				// create watcher before first ingestion so that no updates are missed
 				auto queuePath = m_dataDirectory.spoolDir(queueName).str();
-				task.Callback = [&subscriber, readNextMessage, queuePath]() {
-					subscribers::ReadAll({ queuePath, "index_broker_r.dat", "index.dat" }, subscriber, readNextMessage);
-					return thread::make_ready_future(thread::TaskResult::Continue);
+				auto pWatcher = std::make_shared<io::FileQueueWatcher>(queuePath, "index.dat");
+				m_queueWatchers.push_back(pWatcher);
+
+				// drain the queue immediately after each update of its writer index
+				auto descriptor = subscribers::MessageQueueDescriptor{ queuePath, "index_broker_r.dat", "index.dat" };
+				auto drainQueue = [&subscriber, readNextMessage, catchUpBatchSize, descriptor]() {
+					subscribers::ReadAll(descriptor, catchUpBatchSize, subscriber, readNextMessage);
 				};
 
-				return task;
+				m_ingestionThreads.spawn([&isShutdown = m_isShutdown, drainQueue, queueName, pWatcher]() {
+					thread::SetThreadName(queueName + " ingestion");
+
+					while (!isShutdown) {
+						drainQueue();
+						pWatcher->wait(Max_Ingestion_Interval);
+					}
+				});
 			}
 
 		private:
@@ -126,6 +150,10 @@ namespace catapult { namespace local {
 			std::unique_ptr<subscribers::TransactionStatusSubscriber> m_pTransactionStatusSubscriber;
 
 			plugins::PluginManager& m_pluginManager;
+
+			std::atomic_bool m_isShutdown;
+			std::vector<std::shared_ptr<io::FileQueueWatcher>> m_queueWatchers;
+			thread::ThreadGroup m_ingestionThreads;
 		};
 	}
 
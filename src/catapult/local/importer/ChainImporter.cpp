@@ -69,7 +69,7 @@ namespace catapult { namespace local {
 
 		class DefaultChainImporter final : public ChainImporter {
 		public:
-			explicit DefaultChainImporter(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper)
+			DefaultChainImporter(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper, StatelessBlockVerification verification)
 					: m_pBootstrapper(std::move(pBootstrapper))
 					, m_config(m_pBootstrapper->config())
 					, m_dataDirectory(config::CatapultDataDirectoryPreparer::Prepare(m_config.User.DataDirectory))
@@ -84,6 +84,7 @@ namespace catapult { namespace local {
 							m_catapultCache,
 							m_dataDirectory))
 					, m_pluginManager(m_pBootstrapper->pluginManager())
+					, m_verification(verification)
 			{}
 
 			~DefaultChainImporter() override {
@@ -126,8 +127,10 @@ namespace catapult { namespace local {
 
 				// load rest of chain
 				loadAllBlocks([this](auto&& loadedBlockStatus) {
-					if (m_pBlockChangeSubscriber)
+					if (m_pBlockChangeSubscriber) {
 						m_pBlockChangeSubscriber->notifyBlock(loadedBlockStatus.BlockElement);
+						m_pBlockChangeSubscriber->flush();
+					}
 
 					m_pStateChangeSubscriber->notifyScoreChange(loadedBlockStatus.ChainScore);
 					m_pStateChangeSubscriber->notifyStateChange(loadedBlockStatus.StateChangeInfo);
@@ -145,12 +148,18 @@ namespace catapult { namespace local {
 				// disable load optimizations (loading from the saved state is optimization enough) in order to prevent
 				// discontinuities in block analysis (e.g. statistic cache expects consecutive blocks)
 				auto observerFactory = [&pluginManager = m_pluginManager](const auto&) { return pluginManager.createObserver(); };
-				auto partialScore = LoadBlockChain(observerFactory, m_pluginManager, stateRef(), Height(2), statusConsumer);
+				auto partialScore = LoadBlockChain(
+						observerFactory,
+						m_pluginManager,
+						stateRef(),
+						Height(2),
+						statusConsumer,
+						m_verification);
 				m_score += partialScore;
 			}
 
 			void generateFinalizationNotifications() {
-				io::FileDatabase proofFileDatabase(m_dataDirectory.rootDir(), { m_config.Node.FileDatabaseBatchSize, ".proof" });
+				io::FileDatabase proofFileDatabase(m_dataDirectory.rootDir(), { m_config.Node.FileDatabaseBatchSize, ".proof", false });
 				for (uint64_t id = 2; proofFileDatabase.contains(id); ++id) {
 					auto pProofStream = proofFileDatabase.inputStream(id);
 
@@ -197,10 +206,13 @@ namespace catapult { namespace local {
 			std::unique_ptr<subscribers::StateChangeSubscriber> m_pStateChangeSubscriber;
 
 			plugins::PluginManager& m_pluginManager;
+			StatelessBlockVerification m_verification;
 		};
 	}
 
-	std::unique_ptr<ChainImporter> CreateChainImporter(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper) {
-		return CreateAndBootHost<DefaultChainImporter>(std::move(pBootstrapper));
+	std::unique_ptr<ChainImporter> CreateChainImporter(
+			std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper,
+			StatelessBlockVerification verification) {
+		return CreateAndBootHost<DefaultChainImporter>(std::move(pBootstrapper), verification);
 	}
 }}
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "catapult/local/ProcessHost.h"
+#include "catapult/local/recovery/MultiBlockLoader.h"
 #include <memory>
 
 namespace catapult { namespace extensions { class ProcessBootstrapper; } }
@@ -31,5 +32,8 @@ namespace catapult { namespace local {
 	class ChainImporter : public ProcessHost {};
 
 	/// Creates and boots a chain importer around the specified bootstrapper (\a pBootstrapper).
-	std::unique_ptr<ChainImporter> CreateChainImporter(std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper);
+	/// Imported blocks are verified using \a verification before they are executed.
+	std::unique_ptr<ChainImporter> CreateChainImporter(
+			std::unique_ptr<extensions::ProcessBootstrapper>&& pBootstrapper,
+			StatelessBlockVerification verification = StatelessBlockVerification::None);
 }}
@@ -24,15 +24,29 @@
 #include "catapult/cache/ReadOnlyCatapultCache.h"
 #include "catapult/chain/BlockExecutor.h"
 #include "catapult/chain/BlockScorer.h"
+#include "catapult/crypto/MerkleHashBuilder.h"
+#include "catapult/crypto/SecureRandomGenerator.h"
+#include "catapult/crypto/Signer.h"
 #include "catapult/extensions/LocalNodeStateRef.h"
 #include "catapult/io/BlockStorageCache.h"
 #include "catapult/model/Block.h"
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/Elements.h"
+#include "catapult/model/EntityHasher.h"
+#include "catapult/model/NotificationSubscriber.h"
+#include "catapult/model/Notifications.h"
 #include "catapult/observers/NotificationObserverAdapter.h"
 #include "catapult/plugins/PluginManager.h"
 #include "catapult/subscribers/StateChangeInfo.h"
+#include "catapult/thread/Future.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/thread/ThreadGroup.h"
 #include "catapult/utils/StackLogger.h"
+#include <boost/asio.hpp>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 namespace catapult { namespace local {
 
@@ -103,6 +117,239 @@ namespace catapult { namespace local {
 			const utils::StackTimer& m_stopwatch;
 			size_t m_numLogs;
 		};
+
+		// region StatelessBlockVerifier
+
+		class SignatureCapturingNotificationSubscriber : public model::NotificationSubscriber {
+		public:
+			explicit SignatureCapturingNotificationSubscriber(const GenerationHashSeed& generationHashSeed)
+					: m_generationHashSeed(generationHashSeed)
+			{}
+
+		public:
+			const auto& inputs() const {
+				return m_inputs;
+			}
+
+		public:
+			void notify(const model::Notification& notification) override {
+				if (model::SignatureNotification::Notification_Type != notification.Type)
+					return;
+
+				const auto& signatureNotification = static_cast<const model::SignatureNotification&>(notification);
+				std::vector<RawBuffer> buffers;
+				if (model::SignatureNotification::ReplayProtectionMode::Enabled == signatureNotification.DataReplayProtectionMode)
+					buffers.push_back(m_generationHashSeed);
+
+				buffers.push_back(signatureNotification.Data);
+				m_inputs.push_back({ signatureNotification.SignerPublicKey, buffers, signatureNotification.Signature });
+			}
+
+		private:
+			const GenerationHashSeed& m_generationHashSeed;
+			std::vector<crypto::SignatureInput> m_inputs;
+		};
+
+		void FillSecureRandom(uint8_t* pOut, size_t count) {
+			crypto::SecureRandomGenerator().fill(pOut, count);
+		}
+
+		// verifies block elements on worker threads
+		class StatelessBlockVerifier {
+		public:
+			StatelessBlockVerifier(const plugins::PluginManager& pluginManager, StatelessBlockVerification verification)
+					: m_generationHashSeed(pluginManager.config().Network.GenerationHashSeed)
+					, m_transactionRegistry(pluginManager.transactionRegistry())
+					, m_pPublisher(pluginManager.createNotificationPublisher())
+					, m_verification(verification) {
+				if (StatelessBlockVerification::None == m_verification)
+					return;
+
+				m_pPool = thread::CreateIoThreadPool(std::max(1u, std::thread::hardware_concurrency()), "block verifier");
+				m_pPool->start();
+			}
+
+			~StatelessBlockVerifier() {
+				if (m_pPool)
+					m_pPool->join();
+			}
+
+		public:
+			thread::future<bool> verify(const std::shared_ptr<const model::BlockElement>& pBlockElement) {
+				if (!m_pPool)
+					return thread::make_ready_future(true);
+
+				auto pPromise = std::make_shared<thread::promise<bool>>();
+				auto future = pPromise->get_future();
+				boost::asio::post(m_pPool->ioContext(), [this, pBlockElement, pPromise]() {
+					try {
+						pPromise->set_value(verifyHashes(*pBlockElement) && verifySignatures(*pBlockElement));
+					} catch (...) {
+						pPromise->set_exception(std::current_exception());
+					}
+				});
+
+				return future;
+			}
+
+		private:
+			bool verifyHashes(const model::BlockElement& blockElement) const {
+				const auto& block = blockElement.Block;
+				if (model::CalculateHash(block) != blockElement.EntityHash)
+					return false;
+
+				crypto::MerkleHashBuilder transactionsHashBuilder(blockElement.Transactions.size());
+				auto transactionElementIter = blockElement.Transactions.cbegin();
+				for (const auto& transaction : block.Transactions()) {
+					if (blockElement.Transactions.cend() == transactionElementIter)
+						return false;
+
+					auto transactionElement = model::TransactionElement(transaction);
+					model::UpdateHashes(m_transactionRegistry, m_generationHashSeed, transactionElement);
+					if (transactionElement.EntityHash != transactionElementIter->EntityHash)
+						return false;
+
+					if (transactionElement.MerkleComponentHash != transactionElementIter->MerkleComponentHash)
+						return false;
+
+					transactionsHashBuilder.update(transactionElement.MerkleComponentHash);
+					++transactionElementIter;
+				}
+
+				if (blockElement.Transactions.cend() != transactionElementIter)
+					return false;
+
+				Hash256 transactionsHash;
+				transactionsHashBuilder.final(transactionsHash);
+				return block.TransactionsHash == transactionsHash;
+			}
+
+			bool verifySignatures(const model::BlockElement& blockElement) const {
+				if (StatelessBlockVerification::Hashes_And_Signatures != m_verification)
+					return true;
+
+				// block signature notification is published along with the block notifications
+				SignatureCapturingNotificationSubscriber sub(m_generationHashSeed);
+				const auto& block = blockElement.Block;
+				m_pPublisher->publish(model::WeakEntityInfo(block, blockElement.EntityHash), sub);
+				for (const auto& transactionElement : blockElement.Transactions) {
+					auto entityInfo = model::WeakEntityInfo(transactionElement.Transaction, transactionElement.EntityHash, block);
+					m_pPublisher->publish(entityInfo, sub);
+				}
+
+				const auto& inputs = sub.inputs();
+				return crypto::VerifyMultiShortCircuit(FillSecureRandom, inputs.data(), inputs.size());
+			}
+
+		private:
+			GenerationHashSeed m_generationHashSeed;
+			const model::TransactionRegistry& m_transactionRegistry;
+			std::unique_ptr<const model::NotificationPublisher> m_pPublisher;
+			StatelessBlockVerification m_verification;
+			std::unique_ptr<thread::IoThreadPool> m_pPool;
+		};
+
+		// endregion
+
+		// region BlockElementPrefetcher
+
+		struct PrefetchedBlockElement {
+			std::shared_ptr<const model::BlockElement> pBlockElement;
+			thread::future<bool> IsVerified;
+		};
+
+		// loads and deserializes block elements on a dedicated thread so that disk access overlaps block execution
+		// (at most Max_Prefetched_Blocks loaded block elements are buffered and, optionally, verified at any time)
+		class BlockElementPrefetcher {
+		private:
+			static constexpr size_t Max_Prefetched_Blocks = 16;
+
+		public:
+			BlockElementPrefetcher(
+					const io::BlockStorageView& storage,
+					StatelessBlockVerifier& verifier,
+					Height startHeight,
+					Height endHeight)
+					: m_storage(storage)
+					, m_verifier(verifier)
+					, m_startHeight(startHeight)
+					, m_endHeight(endHeight)
+					, m_isStopped(false) {
+				m_threads.spawn([this]() { run(); });
+			}
+
+			~BlockElementPrefetcher() {
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					m_isStopped = true;
+				}
+
+				m_condition.notify_all();
+				m_threads.join();
+			}
+
+		public:
+			PrefetchedBlockElement next() {
+				std::unique_lock<std::mutex> lock(m_mutex);
+				m_condition.wait(lock, [this]() { return !m_blockElements.empty() || m_pException; });
+
+				// rethrow a loading failure only after all block elements loaded before it have been consumed
+				if (m_blockElements.empty())
+					std::rethrow_exception(m_pException);
+
+				auto prefetchedBlockElement = std::move(m_blockElements.front());
+				m_blockElements.pop_front();
+				lock.unlock();
+
+				m_condition.notify_all();
+				return prefetchedBlockElement;
+			}
+
+		private:
+			void run() {
+				for (auto height = m_startHeight; height <= m_endHeight; height = height + Height(1)) {
+					PrefetchedBlockElement prefetchedBlockElement;
+					std::exception_ptr pException;
+					try {
+						prefetchedBlockElement.pBlockElement = m_storage.loadBlockElement(height);
+						prefetchedBlockElement.IsVerified = m_verifier.verify(prefetchedBlockElement.pBlockElement);
+					} catch (...) {
+						pException = std::current_exception();
+					}
+
+					{
+						std::unique_lock<std::mutex> lock(m_mutex);
+						m_condition.wait(lock, [this]() { return m_isStopped || m_blockElements.size() < Max_Prefetched_Blocks; });
+						if (m_isStopped)
+							return;
+
+						if (pException)
+							m_pException = pException;
+						else
+							m_blockElements.push_back(std::move(prefetchedBlockElement));
+					}
+
+					m_condition.notify_all();
+					if (pException)
+						return;
+				}
+			}
+
+		private:
+			const io::BlockStorageView& m_storage;
+			StatelessBlockVerifier& m_verifier;
+			Height m_startHeight;
+			Height m_endHeight;
+
+			std::deque<PrefetchedBlockElement> m_blockElements;
+			std::exception_ptr m_pException;
+			bool m_isStopped;
+			std::mutex m_mutex;
+			std::condition_variable m_condition;
+			thread::ThreadGroup m_threads;
+		};
+
+		// endregion
 	}
 
 	class BlockChainLoader {
@@ -115,12 +362,14 @@ namespace catapult { namespace local {
 				const plugins::PluginManager& pluginManager,
 				const extensions::LocalNodeStateRef& stateRef,
 				Height startHeight,
-				const consumer<LoadedBlockStatus&&>& statusConsumer)
+				const consumer<LoadedBlockStatus&&>& statusConsumer,
+				StatelessBlockVerification verification)
 				: m_observerFactory(observerFactory)
 				, m_pluginManager(pluginManager)
 				, m_stateRef(stateRef)
 				, m_startHeight(startHeight)
 				, m_statusConsumer(statusConsumer)
+				, m_verification(verification)
 		{}
 
 	public:
@@ -134,8 +383,14 @@ namespace catapult { namespace local {
 			model::ChainScore score;
 			Hash256 stateHash;
 			auto chainHeight = storage.chainHeight();
+			StatelessBlockVerifier verifier(m_pluginManager, m_verification);
+			BlockElementPrefetcher prefetcher(storage, verifier, height, chainHeight);
 			while (chainHeight >= height) {
-				auto pBlockElement = storage.loadBlockElement(height);
+				auto prefetchedBlockElement = prefetcher.next();
+				if (!prefetchedBlockElement.IsVerified.get())
+					CATAPULT_THROW_RUNTIME_ERROR_1("block failed stateless verification", height);
+
+				auto pBlockElement = std::move(prefetchedBlockElement.pBlockElement);
 				score += model::ChainScore(chain::CalculateScore(pParentBlockElement->Block, pBlockElement->Block));
 
 				const auto& blockElement = *pBlockElement;
@@ -191,6 +446,7 @@ namespace catapult { namespace local {
 		const extensions::LocalNodeStateRef& m_stateRef;
 		Height m_startHeight;
 		consumer<LoadedBlockStatus&&> m_statusConsumer;
+		StatelessBlockVerification m_verification;
 	};
 
 	model::ChainScore LoadBlockChain(
@@ -198,8 +454,9 @@ namespace catapult { namespace local {
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
 			Height startHeight,
-			const consumer<LoadedBlockStatus&&>& statusConsumer) {
-		BlockChainLoader loader(observerFactory, pluginManager, stateRef, startHeight, statusConsumer);
+			const consumer<LoadedBlockStatus&&>& statusConsumer,
+			StatelessBlockVerification verification) {
+		BlockChainLoader loader(observerFactory, pluginManager, stateRef, startHeight, statusConsumer, verification);
 
 		utils::StackLogger logger("load block chain", utils::LogLevel::important);
 		utils::StackTimer stopwatch;
@@ -65,13 +65,27 @@ namespace catapult { namespace local {
 		const subscribers::StateChangeInfo& StateChangeInfo;
 	};
 
+	/// Stateless verification performed on loaded blocks before they are executed.
+	enum class StatelessBlockVerification {
+		/// Blocks are trusted and are not verified.
+		None,
+
+		/// Block and transaction hashes (including block transactions hashes) are recalculated and compared to stored hashes.
+		Hashes,
+
+		/// Hashes are verified and all block and transaction signatures are batch verified.
+		Hashes_And_Signatures
+	};
+
 	/// Loads a block chain from storage using the supplied observer factory (\a observerFactory) and plugin manager (\a pluginManager)
 	/// and updating \a stateRef starting with the block at \a startHeight.
 	/// Each loaded block and supporting information is passed to \a statusConsumer.
+	/// Upcoming blocks are optionally verified (\a verification) on worker threads while preceding blocks are executed.
 	model::ChainScore LoadBlockChain(
 			const BlockDependentNotificationObserverFactory& observerFactory,
 			const plugins::PluginManager& pluginManager,
 			const extensions::LocalNodeStateRef& stateRef,
 			Height startHeight,
-			const consumer<LoadedBlockStatus&&>& statusConsumer = consumer<LoadedBlockStatus>());
+			const consumer<LoadedBlockStatus&&>& statusConsumer = consumer<LoadedBlockStatus>(),
+			StatelessBlockVerification verification = StatelessBlockVerification::None);
 }}
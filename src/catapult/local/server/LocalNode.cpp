@@ -153,10 +153,19 @@ namespace catapult { namespace local {
 		std::unique_ptr<subscribers::StateChangeSubscriber> CreateStateChangeSubscriber(
 				subscribers::SubscriptionManager& subscriptionManager,
 				const cache::CatapultCache& catapultCache,
+				const config::NodeConfiguration& nodeConfig,
 				const config::CatapultDataDirectory& dataDirectory) {
 			subscriptionManager.addStateChangeSubscriber(CreateFileStateChangeStorage(
 					std::make_unique<io::FileQueueWriter>(dataDirectory.spoolDir("state_change").str(), "index_server.dat"),
 					[&catapultCache]() { return catapultCache.changesStorages(); }));
+
+			// journal state changes so that checkpoints only need to save the changes since the previous checkpoint
+			if (extensions::IsIncrementalStateCheckpointingEnabled(nodeConfig)) {
+				subscriptionManager.addStateChangeSubscriber(CreateFileStateChangeStorage(
+						extensions::CreateStateChangeJournalOutputStream(dataDirectory),
+						[&catapultCache]() { return catapultCache.changesStorages(); }));
+			}
+
 			subscriptionManager.addStateChangeSubscriber(std::make_unique<CommitImportanceFilesStateChangeSubscriber>(dataDirectory));
 			return subscriptionManager.createStateChangeSubscriber();
 		}
@@ -207,7 +216,8 @@ namespace catapult { namespace local {
 					, m_catapultCache({}) // note that sub caches are added in boot
 					, m_storage(
 							m_pBootstrapper->subscriptionManager().createBlockStorage(m_pBlockChangeSubscriber),
-							CreateStagingBlockStorage(m_dataDirectory, m_config.Node.FileDatabaseBatchSize))
+							CreateStagingBlockStorage(m_dataDirectory, m_config.Node.FileDatabaseBatchSize),
+							m_config.Node.HotBlocksCacheMaxMemorySize)
 					, m_pUtCache(m_pBootstrapper->subscriptionManager().createUtCache(extensions::GetUtCacheOptions(m_config.Node)))
 					, m_pFinalizationSubscriber(m_pBootstrapper->subscriptionManager().createFinalizationSubscriber())
 					, m_pNodeSubscriber(CreateNodeSubscriber(
@@ -218,6 +228,7 @@ namespace catapult { namespace local {
 					, m_pStateChangeSubscriber(CreateStateChangeSubscriber(
 							m_pBootstrapper->subscriptionManager(),
 							m_catapultCache,
+							m_config.Node,
 							m_dataDirectory))
 					, m_pTransactionStatusSubscriber(m_pBootstrapper->subscriptionManager().createTransactionStatusSubscriber())
 					, m_pluginManager(m_pBootstrapper->pluginManager())
@@ -294,6 +305,17 @@ namespace catapult { namespace local {
 					return source.view().memorySize().megabytes();
 				});
 
+				const auto& storage = m_storage;
+				m_counters.emplace_back(utils::DiagnosticCounterId("HOT BLK HIT"), [&storage]() {
+					return storage.statistics().NumHotBlockHits;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("HOT BLK MISS"), [&storage]() {
+					return storage.statistics().NumHotBlockMisses;
+				});
+				m_counters.emplace_back(utils::DiagnosticCounterId("HOT BLK MEM"), [&storage]() {
+					return storage.statistics().HotBlocksMemorySize.megabytes();
+				});
+
 				AddNodeCounters(m_counters, m_nodes);
 			}
 
@@ -348,8 +370,8 @@ namespace catapult { namespace local {
 				if (!m_isBooted)
 					return;
 
-				constexpr auto SaveStateToDirectoryWithCheckpointing = extensions::SaveStateToDirectoryWithCheckpointing;
-				SaveStateToDirectoryWithCheckpointing(m_dataDirectory, m_config.Node, m_catapultCache, m_score.get());
+				constexpr auto SaveStateToDirectory = extensions::SaveStateToDirectoryWithIncrementalCheckpointing;
+				SaveStateToDirectory(m_dataDirectory, m_config.Node, m_catapultCache, m_score.get());
 			}
 
 		public:
@@ -31,7 +31,9 @@ namespace catapult { namespace model {
 	namespace {
 		class AddressCollector : public NotificationSubscriber {
 		public:
-			explicit AddressCollector(NetworkIdentifier networkIdentifier) : m_networkIdentifier(networkIdentifier)
+			AddressCollector(NetworkIdentifier networkIdentifier, UnresolvedAddressSet& addresses)
+					: m_networkIdentifier(networkIdentifier)
+					, m_addresses(addresses)
 			{}
 
 		public:
@@ -42,11 +44,6 @@ namespace catapult { namespace model {
 					m_addresses.insert(toAddress(static_cast<const AccountPublicKeyNotification&>(notification).PublicKey));
 			}
 
-		public:
-			const UnresolvedAddressSet& addresses() const {
-				return m_addresses;
-			}
-
 		private:
 			UnresolvedAddress toAddress(const Key& publicKey) const {
 				auto resolvedAddress = PublicKeyToAddress(publicKey, m_networkIdentifier);
@@ -55,15 +52,26 @@ namespace catapult { namespace model {
 
 		private:
 			NetworkIdentifier m_networkIdentifier;
-			UnresolvedAddressSet m_addresses;
+			UnresolvedAddressSet& m_addresses;
 		};
 	}
 
 	UnresolvedAddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher) {
 		Hash256 transactionHash;
 		WeakEntityInfo weakInfo(transaction, transactionHash);
-		AddressCollector sub(NetworkIdentifier(weakInfo.entity().Network));
+		UnresolvedAddressSet addresses;
+		AddressCollector sub(NetworkIdentifier(weakInfo.entity().Network), addresses);
 		notificationPublisher.publish(weakInfo, sub);
-		return sub.addresses();
+		return addresses;
+	}
+
+	UnresolvedAddressSet ExtractAddresses(const WeakEntityInfos& entityInfos, const NotificationPublisher& notificationPublisher) {
+		UnresolvedAddressSet addresses;
+		for (const auto& entityInfo : entityInfos) {
+			AddressCollector sub(NetworkIdentifier(entityInfo.entity().Network), addresses);
+			notificationPublisher.publish(entityInfo, sub);
+		}
+
+		return addresses;
 	}
 }}
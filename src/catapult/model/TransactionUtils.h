@@ -21,6 +21,7 @@
 
 #pragma once
 #include "ContainerTypes.h"
+#include "WeakEntityInfo.h"
 
 namespace catapult {
 	namespace model {
@@ -33,4 +34,7 @@ namespace catapult { namespace model {
 
 	/// Extracts all addresses that are involved in \a transaction using \a notificationPublisher.
 	UnresolvedAddressSet ExtractAddresses(const Transaction& transaction, const NotificationPublisher& notificationPublisher);
+
+	/// Extracts all addresses that are involved in \a entityInfos using \a notificationPublisher.
+	UnresolvedAddressSet ExtractAddresses(const WeakEntityInfos& entityInfos, const NotificationPublisher& notificationPublisher);
 }}
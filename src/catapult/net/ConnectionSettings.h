@@ -20,6 +20,7 @@
 **/
 
 #pragma once
+#include "catapult/ionet/PacketCompressionSocketDecorator.h"
 #include "catapult/ionet/PacketSocketOptions.h"
 #include "catapult/model/NetworkIdentifier.h"
 #include "catapult/model/NodeIdentity.h"
@@ -41,6 +42,8 @@ namespace catapult { namespace net {
 				, SocketWorkingBufferSensitivity(0) // memory reclamation disabled
 				, MaxPacketDataSize(utils::FileSize::FromBytes(Default_Max_Packet_Data_Size))
 				, OutgoingProtocols(ionet::IpProtocol::IPv4)
+				, EnablePacketCompression(false)
+				, PacketCompressionThreshold(utils::FileSize::FromKilobytes(4))
 				, AllowIncomingSelfConnections(true)
 				, AllowOutgoingSelfConnections(false)
 		{}
@@ -67,6 +70,12 @@ namespace catapult { namespace net {
 		/// Outgoing connection protocols.
 		ionet::IpProtocol OutgoingProtocols;
 
+		/// \c true if block and transaction packets should be compressed when sent to peers that support compression.
+		bool EnablePacketCompression;
+
+		/// Minimum data size of a block or transaction packet that is compressed.
+		utils::FileSize PacketCompressionThreshold;
+
 		/// Allows incoming self connections when \c true.
 		bool AllowIncomingSelfConnections;
 
@@ -88,5 +97,16 @@ namespace catapult { namespace net {
 			options.SslOptions = SslOptions;
 			return options;
 		}
+
+		/// Gets the packet compression settings represented by the configured settings.
+		ionet::PacketCompressionSettings toPacketCompressionSettings() const {
+			ionet::PacketCompressionSettings settings;
+			if (EnablePacketCompression)
+				settings.CompressiblePacketTypes = { ionet::PacketType::Pull_Blocks, ionet::PacketType::Push_Transactions };
+
+			settings.MinCompressiblePacketDataSize = PacketCompressionThreshold.bytes();
+			settings.MaxPacketDataSize = MaxPacketDataSize.bytes();
+			return settings;
+		}
 	};
 }}
@@ -71,13 +71,17 @@ namespace catapult { namespace net {
 
 				auto socketOptions = m_settings.toSocketOptions();
 				const auto& endpoint = node.endpoint();
-				auto cancel = ionet::Connect(m_ioContext, socketOptions, endpoint, [pThis = shared_from_this(), identityKey, pRequest](
-						auto result,
-						const auto& connectedSocketInfo) {
+				// only nodes explicitly advertising compression support are able to read compressed packets
+				auto isRemoteCompressionCapable = HasFlag(ionet::NodeRoles::Compression, node.metadata().Roles);
+				auto cancel = ionet::Connect(m_ioContext, socketOptions, endpoint, [
+						pThis = shared_from_this(),
+						identityKey,
+						isRemoteCompressionCapable,
+						pRequest](auto result, const auto& connectedSocketInfo) {
 					if (ionet::ConnectResult::Connected != result)
 						return pRequest->callback(PeerConnectCode::Socket_Error, ionet::PacketSocketInfo());
 
-					pThis->verify(identityKey, connectedSocketInfo, pRequest);
+					pThis->verify(identityKey, isRemoteCompressionCapable, connectedSocketInfo, pRequest);
 				});
 
 				pRequest->setTimeoutHandler([pThis = shared_from_this(), cancel]() {
@@ -90,6 +94,7 @@ namespace catapult { namespace net {
 			template<typename TRequest>
 			void verify(
 					const Key& expectedIdentityKey,
+					bool isRemoteCompressionCapable,
 					const ionet::PacketSocketInfo& connectedSocketInfo,
 					const std::shared_ptr<TRequest>& pRequest) {
 				if (expectedIdentityKey != connectedSocketInfo.publicKey()) {
@@ -100,7 +105,14 @@ namespace catapult { namespace net {
 				}
 
 				m_sockets.insert(connectedSocketInfo.socket());
-				pRequest->callback(PeerConnectCode::Accepted, connectedSocketInfo);
+
+				// only advertise compression support to the remote node when compression is enabled locally
+				auto pSocket = ionet::AddPacketCompression(
+						connectedSocketInfo.socket(),
+						m_settings.toPacketCompressionSettings(),
+						m_settings.EnablePacketCompression && isRemoteCompressionCapable);
+				ionet::PacketSocketInfo decoratedSocketInfo(connectedSocketInfo.host(), connectedSocketInfo.publicKey(), pSocket);
+				pRequest->callback(PeerConnectCode::Accepted, decoratedSocketInfo);
 			}
 
 		public:
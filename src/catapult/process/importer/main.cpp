@@ -42,6 +42,7 @@ int main(int argc, const char** argv) {
 		pBootstrapper->loadExtensions();
 
 		// create the local node
-		return local::CreateChainImporter(std::move(pBootstrapper));
+		// (imported blocks are not validated, so verify hashes and signatures on worker threads while preceding blocks execute)
+		return local::CreateChainImporter(std::move(pBootstrapper), local::StatelessBlockVerification::Hashes_And_Signatures);
 	});
 }
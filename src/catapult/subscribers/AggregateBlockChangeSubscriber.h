@@ -39,5 +39,9 @@ namespace catapult { namespace subscribers {
 		void notifyDropBlocksAfter(Height height) override {
 			this->forEach([height](auto& subscriber) { subscriber.notifyDropBlocksAfter(height); });
 		}
+
+		void flush() override {
+			this->forEach([](auto& subscriber) { subscriber.flush(); });
+		}
 	};
 }}
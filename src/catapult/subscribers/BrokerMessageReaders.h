@@ -41,6 +41,12 @@ namespace catapult { namespace subscribers {
 				subscriber.flush();
 			}
 		};
+
+		template<typename TSubscriber, typename TMessageReader>
+		void ReadAllWithoutFlush(io::InputStream& inputStream, TSubscriber& subscriber, TMessageReader readNextMessage) {
+			while (!inputStream.eof())
+				readNextMessage(inputStream, subscriber);
+		}
 	}
 
 	// endregion
@@ -48,9 +54,7 @@ namespace catapult { namespace subscribers {
 	/// Reads all messages from \a inputStream into \a subscriber using \a readNextMessage.
 	template<typename TSubscriber, typename TMessageReader>
 	void ReadAll(io::InputStream& inputStream, TSubscriber& subscriber, TMessageReader readNextMessage) {
-		while (!inputStream.eof())
-			readNextMessage(inputStream, subscriber);
-
+		detail::ReadAllWithoutFlush(inputStream, subscriber, readNextMessage);
 		detail::Flusher<TSubscriber>::Flush(subscriber);
 	}
 
@@ -66,6 +70,25 @@ namespace catapult { namespace subscribers {
 		}
 	}
 
+	/// Reads all messages from \a reader into \a subscriber using \a readNextMessage in batches of at most \a maxBatchSize messages.
+	/// \note Subscriber is flushed once per batch and messages are only consumed after the flush succeeds.
+	template<typename TSubscriber, typename TMessageReader>
+	void ReadAllBatched(io::FileQueueReader& reader, size_t maxBatchSize, TSubscriber& subscriber, TMessageReader readNextMessage) {
+		while (true) {
+			auto messages = reader.peekNextMessages(maxBatchSize);
+			if (messages.empty())
+				return;
+
+			for (const auto& buffer : messages) {
+				io::BufferInputStreamAdapter<std::vector<uint8_t>> inputStream(buffer);
+				detail::ReadAllWithoutFlush(inputStream, subscriber, readNextMessage);
+			}
+
+			detail::Flusher<TSubscriber>::Flush(subscriber);
+			reader.skip(static_cast<uint32_t>(messages.size()));
+		}
+	}
+
 	/// Describes a message queue.
 	struct MessageQueueDescriptor {
 		/// Path of the message queue.
@@ -79,15 +102,35 @@ namespace catapult { namespace subscribers {
 	};
 
 	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage.
+	/// When at least \a catchUpBatchSize messages are pending, messages are read in batches of \a catchUpBatchSize (catch-up mode).
+	/// \note Catch-up mode is disabled when \a catchUpBatchSize is zero.
 	template<typename TSubscriber, typename TMessageReader>
-	void ReadAll(const MessageQueueDescriptor& descriptor, TSubscriber& subscriber, TMessageReader readNextMessage) {
+	void ReadAll(
+			const MessageQueueDescriptor& descriptor,
+			size_t catchUpBatchSize,
+			TSubscriber& subscriber,
+			TMessageReader readNextMessage) {
 		io::FileQueueReader reader(descriptor.QueuePath, descriptor.IndexReaderFilename, descriptor.IndexWriterFilename);
 
 		auto numPendingMessages = reader.pending();
 		if (0 == numPendingMessages)
 			return;
 
-		CATAPULT_LOG(debug) << "preparing to process " << numPendingMessages << " messages from " << descriptor.QueuePath;
-		subscribers::ReadAll(reader, subscriber, readNextMessage);
+		if (0 == catchUpBatchSize || numPendingMessages < catchUpBatchSize) {
+			CATAPULT_LOG(debug) << "preparing to process " << numPendingMessages << " messages from " << descriptor.QueuePath;
+			subscribers::ReadAll(reader, subscriber, readNextMessage);
+			return;
+		}
+
+		CATAPULT_LOG(info)
+				<< "preparing to process " << numPendingMessages << " messages from " << descriptor.QueuePath
+				<< " in catch-up mode (batch size " << catchUpBatchSize << ")";
+		subscribers::ReadAllBatched(reader, catchUpBatchSize, subscriber, readNextMessage);
+	}
+
+	/// Reads all messages from queue described by \a descriptor into \a subscriber using \a readNextMessage.
+	template<typename TSubscriber, typename TMessageReader>
+	void ReadAll(const MessageQueueDescriptor& descriptor, TSubscriber& subscriber, TMessageReader readNextMessage) {
+		ReadAll(descriptor, 0, subscriber, readNextMessage);
 	}
 }}
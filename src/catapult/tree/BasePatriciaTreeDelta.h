@@ -72,6 +72,12 @@ namespace catapult { namespace tree {
 			return m_tree.set(key, value);
 		}
 
+		/// Sets all key value \a pairs in the tree.
+		template<typename TPairs>
+		void setBatch(const TPairs& pairs) {
+			m_tree.setBatch(pairs);
+		}
+
 		/// Removes the value associated with \a key from the tree.
 		bool unset(const KeyType& key) {
 			return m_tree.unset(key);
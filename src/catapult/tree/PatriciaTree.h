@@ -21,6 +21,8 @@
 
 #pragma once
 #include "TreeNode.h"
+#include <algorithm>
+#include <vector>
 
 namespace catapult { namespace tree {
 
@@ -150,6 +152,132 @@ namespace catapult { namespace tree {
 
 		// endregion
 
+		// region setBatch
+
+	public:
+		/// Sets all key value \a pairs in the tree.
+		/// \note This is equivalent to calling set for each pair in order, but each branch node along the paths of \a pairs
+		///       is copied and relinked once instead of once per pair.
+		template<typename TPairs>
+		void setBatch(const TPairs& pairs) {
+			PathValuePairs encodedPairs;
+			for (const auto& pair : pairs)
+				encodedPairs.push_back({ TreeNodePath(TEncoder::EncodeKey(pair.first)), TEncoder::EncodeValue(pair.second) });
+
+			if (encodedPairs.empty())
+				return;
+
+			// sort pairs by path so that pairs sharing a prefix are adjacent
+			std::stable_sort(encodedPairs.begin(), encodedPairs.end(), [](const auto& lhs, const auto& rhs) {
+				return IsPathLess(lhs.Path, rhs.Path);
+			});
+
+			// when a key is set multiple times, only its last value is retained
+			PathValuePairs uniquePairs;
+			uniquePairs.reserve(encodedPairs.size());
+			for (auto i = 0u; i < encodedPairs.size(); ++i) {
+				if (encodedPairs.size() == i + 1 || encodedPairs[i + 1].Path != encodedPairs[i].Path)
+					uniquePairs.push_back(std::move(encodedPairs[i]));
+			}
+
+			m_rootNode = setBatch(m_rootNode, std::move(uniquePairs));
+		}
+
+	private:
+		struct PathValuePair {
+			TreeNodePath Path;
+			Hash256 Value;
+		};
+
+		using PathValuePairs = std::vector<PathValuePair>;
+
+	private:
+		// all pairs must be unique, sorted by path and have paths relative to node
+		TreeNode setBatch(const TreeNode& node, PathValuePairs&& pairs) {
+			if (1 == pairs.size())
+				return set(node, { pairs[0].Path, pairs[0].Value });
+
+			// if the node is empty, create a new subtree containing all pairs
+			if (node.empty())
+				return createSubtree(std::move(pairs));
+
+			if (node.isLeaf()) {
+				// merge the leaf node into the pairs unless its value is being changed
+				const auto& leafNode = node.asLeafNode();
+				auto iter = std::lower_bound(pairs.begin(), pairs.end(), leafNode.path(), [](const auto& pair, const auto& path) {
+					return IsPathLess(pair.Path, path);
+				});
+
+				if (pairs.end() == iter || iter->Path != leafNode.path())
+					pairs.insert(iter, PathValuePair{ leafNode.path(), leafNode.value() });
+
+				return createSubtree(std::move(pairs));
+			}
+
+			// the current node is a branch node that needs updating
+			const auto& branchPath = node.path();
+			auto differenceIndex = branchPath.size();
+			for (const auto& pair : pairs)
+				differenceIndex = std::min(differenceIndex, FindFirstDifferenceIndex(branchPath, pair.Path));
+
+			auto branchNode = BranchTreeNode(node.asBranchNode());
+			if (differenceIndex == branchPath.size()) {
+				updateBranchLinks(branchNode, differenceIndex, std::move(pairs));
+				return TreeNode(branchNode);
+			}
+
+			// the branch path is not shared by all pairs, so split the branch at the shared path
+			auto newBranchNode = BranchTreeNode(branchPath.subpath(0, differenceIndex));
+			auto branchLinkIndex = branchPath.nibbleAt(differenceIndex);
+			branchNode.setPath(branchPath.subpath(differenceIndex + 1));
+			setLink(newBranchNode, branchNode, branchLinkIndex);
+
+			updateBranchLinks(newBranchNode, differenceIndex, std::move(pairs));
+			return TreeNode(newBranchNode);
+		}
+
+		TreeNode createSubtree(PathValuePairs&& pairs) {
+			if (1 == pairs.size())
+				return TreeNode(createLeaf({ pairs[0].Path, pairs[0].Value }));
+
+			// since pairs are sorted, the path shared by the first and last pairs is shared by all pairs
+			auto differenceIndex = FindFirstDifferenceIndex(pairs.front().Path, pairs.back().Path);
+			auto branchNode = BranchTreeNode(pairs.front().Path.subpath(0, differenceIndex));
+			updateBranchLinks(branchNode, differenceIndex, std::move(pairs));
+			return TreeNode(branchNode);
+		}
+
+		void updateBranchLinks(BranchTreeNode& branchNode, size_t linkNibbleIndex, PathValuePairs&& pairs) {
+			// since pairs are sorted, all pairs connecting to the same link are adjacent
+			auto groupBegin = pairs.cbegin();
+			while (pairs.cend() != groupBegin) {
+				auto linkIndex = groupBegin->Path.nibbleAt(linkNibbleIndex);
+				auto groupEnd = std::find_if(groupBegin, pairs.cend(), [linkNibbleIndex, linkIndex](const auto& pair) {
+					return linkIndex != pair.Path.nibbleAt(linkNibbleIndex);
+				});
+
+				PathValuePairs linkPairs;
+				linkPairs.reserve(static_cast<size_t>(std::distance(groupBegin, groupEnd)));
+				for (auto iter = groupBegin; groupEnd != iter; ++iter)
+					linkPairs.push_back({ iter->Path.subpath(linkNibbleIndex + 1), iter->Value });
+
+				// update each link (and the subtree below it) exactly once
+				auto nextNode = branchNode.hasLink(linkIndex) ? getLinkedNode(branchNode, linkIndex) : TreeNode();
+				setLink(branchNode, setBatch(nextNode, std::move(linkPairs)), linkIndex);
+				groupBegin = groupEnd;
+			}
+		}
+
+		static bool IsPathLess(const TreeNodePath& lhs, const TreeNodePath& rhs) {
+			auto differenceIndex = FindFirstDifferenceIndex(lhs, rhs);
+			if (lhs.size() == differenceIndex || rhs.size() == differenceIndex)
+				return lhs.size() < rhs.size();
+
+			return lhs.nibbleAt(differenceIndex) < rhs.nibbleAt(differenceIndex);
+		}
+
+		// endregion
+
 		// region unset
 
 	public:
@@ -0,0 +1,139 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "DiagnosticHistogram.h"
+#include "IntegerMath.h"
+#include "catapult/exceptions.h"
+#include <algorithm>
+#include <atomic>
+
+namespace catapult { namespace utils {
+
+	namespace {
+		constexpr size_t Num_Sub_Buckets = 4;
+		constexpr size_t Num_Shards = 16;
+
+		size_t GetThreadShardIndex() {
+			static std::atomic<size_t> nextShardIndex(0);
+			thread_local size_t shardIndex = nextShardIndex++ % Num_Shards;
+			return shardIndex;
+		}
+	}
+
+	// region DiagnosticHistogramValues
+
+	DiagnosticHistogramValues::DiagnosticHistogramValues() : DiagnosticHistogramValues(BucketCounts(), 0)
+	{}
+
+	DiagnosticHistogramValues::DiagnosticHistogramValues(const BucketCounts& bucketCounts, uint64_t maxValue)
+			: m_bucketCounts(bucketCounts)
+			, m_count(0)
+			, m_maxValue(maxValue) {
+		for (auto bucketCount : m_bucketCounts)
+			m_count += bucketCount;
+	}
+
+	uint64_t DiagnosticHistogramValues::count() const {
+		return m_count;
+	}
+
+	uint64_t DiagnosticHistogramValues::max() const {
+		return m_maxValue;
+	}
+
+	uint64_t DiagnosticHistogramValues::percentile(uint8_t percentile) const {
+		if (0 == percentile || 100 < percentile)
+			CATAPULT_THROW_INVALID_ARGUMENT_1("percentile must be in range [1, 100]", static_cast<uint16_t>(percentile));
+
+		if (0 == m_count)
+			return 0;
+
+		// find the bucket containing the value with the (one-based) rank ceil(count * percentile / 100)
+		auto rank = std::max<uint64_t>(1, (m_count * percentile + 99) / 100);
+		uint64_t numValues = 0;
+		for (auto i = 0u; i < Num_Buckets; ++i) {
+			numValues += m_bucketCounts[i];
+			if (numValues >= rank)
+				return std::min(BucketUpperBound(i), m_maxValue);
+		}
+
+		return m_maxValue;
+	}
+
+	size_t DiagnosticHistogramValues::BucketIndex(uint64_t value) {
+		if (value < Num_Sub_Buckets)
+			return static_cast<size_t>(value);
+
+		// use the two bits after the most significant bit to select a linear sub bucket
+		auto exponent = Log2(value);
+		auto subBucketIndex = (value >> (exponent - 2)) & (Num_Sub_Buckets - 1);
+		return static_cast<size_t>(Num_Sub_Buckets * (exponent - 1) + subBucketIndex);
+	}
+
+	uint64_t DiagnosticHistogramValues::BucketUpperBound(size_t index) {
+		if (index < Num_Sub_Buckets)
+			return index;
+
+		auto exponent = index / Num_Sub_Buckets + 1;
+		auto subBucketIndex = index % Num_Sub_Buckets;
+		auto lowerBound = static_cast<uint64_t>(Num_Sub_Buckets + subBucketIndex) << (exponent - 2);
+		return lowerBound + ((static_cast<uint64_t>(1) << (exponent - 2)) - 1);
+	}
+
+	// endregion
+
+	// region DiagnosticHistogram
+
+	struct alignas(64) DiagnosticHistogram::Shard {
+		std::array<std::atomic<uint64_t>, DiagnosticHistogramValues::Num_Buckets> BucketCounts{};
+		std::atomic<uint64_t> MaxValue{};
+	};
+
+	DiagnosticHistogram::DiagnosticHistogram() : m_pShards(std::make_unique<Shard[]>(Num_Shards))
+	{}
+
+	DiagnosticHistogram::~DiagnosticHistogram() = default;
+
+	void DiagnosticHistogram::record(uint64_t value) {
+		auto& shard = m_pShards[GetThreadShardIndex()];
+		shard.BucketCounts[DiagnosticHistogramValues::BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+
+		auto maxValue = shard.MaxValue.load(std::memory_order_relaxed);
+		while (maxValue < value && !shard.MaxValue.compare_exchange_weak(maxValue, value, std::memory_order_relaxed))
+		{}
+	}
+
+	DiagnosticHistogramValues DiagnosticHistogram::values() const {
+		DiagnosticHistogramValues::BucketCounts bucketCounts{};
+		uint64_t maxValue = 0;
+		for (auto i = 0u; i < Num_Shards; ++i) {
+			const auto& shard = m_pShards[i];
+			for (auto j = 0u; j < DiagnosticHistogramValues::Num_Buckets; ++j)
+				bucketCounts[j] += shard.BucketCounts[j].load(std::memory_order_relaxed);
+
+			maxValue = std::max(maxValue, shard.MaxValue.load(std::memory_order_relaxed));
+		}
+
+		return DiagnosticHistogramValues(bucketCounts, maxValue);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,92 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#pragma once
+#include "NonCopyable.h"
+#include <array>
+#include <memory>
+#include <stdint.h>
+
+namespace catapult { namespace utils {
+
+	/// Values (merged buckets) of a diagnostic histogram.
+	class DiagnosticHistogramValues {
+	public:
+		/// Number of buckets.
+		/// \note Each power of two range is split into four linear buckets, so bucket upper bounds are within 25% of recorded values.
+		static constexpr size_t Num_Buckets = 252;
+
+		/// Bucket counts.
+		using BucketCounts = std::array<uint64_t, Num_Buckets>;
+
+	public:
+		/// Creates empty values.
+		DiagnosticHistogramValues();
+
+		/// Creates values around \a bucketCounts and \a maxValue.
+		DiagnosticHistogramValues(const BucketCounts& bucketCounts, uint64_t maxValue);
+
+	public:
+		/// Gets the number of recorded values.
+		uint64_t count() const;
+
+		/// Gets the maximum recorded value.
+		uint64_t max() const;
+
+		/// Gets an upper bound of the value at \a percentile, which must be in the range [1, 100].
+		/// \note \c 0 is returned when no values have been recorded.
+		uint64_t percentile(uint8_t percentile) const;
+
+	public:
+		/// Gets the index of the bucket containing \a value.
+		static size_t BucketIndex(uint64_t value);
+
+		/// Gets the largest value contained in the bucket with \a index.
+		static uint64_t BucketUpperBound(size_t index);
+
+	private:
+		BucketCounts m_bucketCounts;
+		uint64_t m_count;
+		uint64_t m_maxValue;
+	};
+
+	/// Lock-free histogram of diagnostic values (e.g. latencies).
+	/// \note Values are recorded into per-thread shards that are merged when read.
+	class DiagnosticHistogram : public NonCopyable {
+	public:
+		/// Creates an empty histogram.
+		DiagnosticHistogram();
+
+		/// Destroys the histogram.
+		~DiagnosticHistogram();
+
+	public:
+		/// Records \a value.
+		void record(uint64_t value);
+
+		/// Gets the (merged) values of all recorded values.
+		DiagnosticHistogramValues values() const;
+
+	private:
+		struct Shard;
+		std::unique_ptr<Shard[]> m_pShards;
+	};
+}}
@@ -0,0 +1,132 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_tx/MemoryUtCache.h"
+#include "catapult/model/EntityInfo.h"
+#include "catapult/utils/MemoryUtils.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace cache {
+
+	namespace {
+		constexpr auto Transaction_Size = SizeOf32<model::Transaction>() + 48u;
+
+		// region test data
+
+		MemoryCacheOptions CreateOptions() {
+			return MemoryCacheOptions(utils::FileSize::FromMegabytes(4), utils::FileSize::FromMegabytes(1024));
+		}
+
+		model::TransactionInfo CreateRandomTransactionInfo(Timestamp deadline) {
+			auto pTransaction = utils::MakeSharedWithSize<model::Transaction>(Transaction_Size);
+			std::memset(static_cast<void*>(pTransaction.get()), 0, Transaction_Size);
+
+			pTransaction->Size = Transaction_Size;
+			bench::FillWithRandomData(pTransaction->SignerPublicKey);
+			pTransaction->Deadline = deadline;
+
+			Hash256 hash;
+			bench::FillWithRandomData(hash);
+			return model::TransactionInfo(pTransaction, hash);
+		}
+
+		// seeds \a cache with \a numTransactions transactions and removes every tenth one in order to create holes
+		void SeedCache(MemoryUtCache& cache, size_t numTransactions) {
+			std::vector<Hash256> hashes;
+			{
+				auto modifier = cache.modifier();
+				for (auto i = 0u; i < numTransactions; ++i) {
+					auto transactionInfo = CreateRandomTransactionInfo(Timestamp(i + 1));
+					hashes.push_back(transactionInfo.EntityHash);
+					modifier.add(transactionInfo);
+				}
+			}
+
+			auto modifier = cache.modifier();
+			for (auto i = 0u; i < hashes.size(); i += 10)
+				modifier.remove(hashes[i]);
+		}
+
+		// returns short hashes of all transactions in \a cache except for every hundredth one
+		utils::ShortHashesSet CreateKnownShortHashes(const MemoryUtCache& cache) {
+			utils::ShortHashesSet knownShortHashes;
+			auto i = 0u;
+			for (auto shortHash : cache.view().shortHashes()) {
+				if (0 != i++ % 100)
+					knownShortHashes.insert(shortHash);
+			}
+
+			return knownShortHashes;
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkShortHashes(benchmark::State& state) {
+			MemoryUtCache cache(CreateOptions());
+			SeedCache(cache, static_cast<size_t>(state.range(0)));
+
+			for (auto _ : state) {
+				auto shortHashes = cache.view().shortHashes();
+				benchmark::DoNotOptimize(shortHashes.size());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(cache.view().size() * state.iterations()));
+		}
+
+		void BenchmarkUnknownTransactions(benchmark::State& state) {
+			MemoryUtCache cache(CreateOptions());
+			SeedCache(cache, static_cast<size_t>(state.range(0)));
+			auto knownShortHashes = CreateKnownShortHashes(cache);
+
+			size_t numUnknownTransactions = 0;
+			for (auto _ : state) {
+				auto transactions = cache.view().unknownTransactions(Timestamp(), BlockFeeMultiplier(), knownShortHashes);
+				numUnknownTransactions = transactions.size();
+				benchmark::DoNotOptimize(numUnknownTransactions);
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(cache.view().size() * state.iterations()));
+			state.counters["unknown"] = static_cast<double>(numUnknownTransactions);
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkShortHashes", catapult::cache::BenchmarkShortHashes)
+			->UseRealTime()
+			->Unit(benchmark::kMicrosecond)
+			->Arg(10'000)
+			->Arg(100'000)
+			->Arg(250'000);
+
+	benchmark::RegisterBenchmark("BenchmarkUnknownTransactions", catapult::cache::BenchmarkUnknownTransactions)
+			->UseRealTime()
+			->Unit(benchmark::kMicrosecond)
+			->Arg(10'000)
+			->Arg(100'000)
+			->Arg(250'000);
+}
@@ -0,0 +1,183 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "harvesting/src/Harvester.h"
+#include "catapult/cache/SubCachePluginAdapter.h"
+#include "catapult/cache_core/AccountStateCache.h"
+#include "catapult/cache_core/AccountStateCacheStorage.h"
+#include "catapult/cache_core/BlockStatisticCache.h"
+#include "catapult/cache_core/BlockStatisticCacheStorage.h"
+#include "catapult/model/BlockUtils.h"
+#include "catapult/thread/IoThreadPool.h"
+#include "catapult/utils/Logging.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+#include <thread>
+
+namespace catapult { namespace harvesting {
+
+	namespace {
+		constexpr auto Harvesting_Mosaic_Id = MosaicId(1234);
+
+		auto CreateRandomKeyPair() {
+			return crypto::KeyPair::FromPrivate(crypto::PrivateKey::Generate(bench::RandomByte));
+		}
+
+		model::BlockChainConfiguration CreateConfiguration() {
+			auto config = model::BlockChainConfiguration::Uninitialized();
+			config.Network.Identifier = model::NetworkIdentifier::Private_Test;
+			config.HarvestingMosaicId = Harvesting_Mosaic_Id;
+			config.BlockGenerationTargetTime = utils::TimeSpan::FromSeconds(60);
+			config.ImportanceGrouping = 123;
+			config.VotingSetGrouping = 1;
+			config.MaxDifficultyBlocks = 60;
+			config.TotalChainImportance = Importance(8'999'999'998'000'000);
+			return config;
+		}
+
+		template<typename TCache, typename TStorageTraits, typename... TArgs>
+		std::unique_ptr<cache::SubCachePlugin> MakeSubCachePlugin(TArgs&&... args) {
+			auto pCache = std::make_unique<TCache>(std::forward<TArgs>(args)...);
+			return std::make_unique<cache::SubCachePluginAdapter<TCache, TStorageTraits>>(std::move(pCache));
+		}
+
+		cache::CatapultCache CreateCatapultCache(const model::BlockChainConfiguration& config) {
+			cache::AccountStateCacheTypes::Options options{
+				config.Network.Identifier,
+				config.ImportanceGrouping,
+				config.VotingSetGrouping,
+				config.MinHarvesterBalance,
+				config.MaxHarvesterBalance,
+				config.MinVoterBalance,
+				config.CurrencyMosaicId,
+				config.HarvestingMosaicId
+			};
+
+			std::vector<std::unique_ptr<cache::SubCachePlugin>> subCaches(2);
+			subCaches[cache::AccountStateCache::Id] = MakeSubCachePlugin<cache::AccountStateCache, cache::AccountStateCacheStorage>(
+					cache::CacheConfiguration(),
+					options);
+			subCaches[cache::BlockStatisticCache::Id] = MakeSubCachePlugin<cache::BlockStatisticCache, cache::BlockStatisticCacheStorage>(
+					config.MaxDifficultyBlocks);
+			return cache::CatapultCache(std::move(subCaches));
+		}
+
+		class HarvesterContext {
+		public:
+			explicit HarvesterContext(size_t numAccounts)
+					: m_config(CreateConfiguration())
+					, m_cache(CreateCatapultCache(m_config))
+					, m_unlockedAccounts(numAccounts, [](const auto&) { return 0; })
+					, m_pLastBlock(model::CreateBlock(
+							model::Entity_Type_Block_Normal,
+							model::PreviousBlockContext(),
+							m_config.Network.Identifier,
+							Key(),
+							{}))
+					, m_lastBlockElement(*m_pLastBlock) {
+				m_pLastBlock->Height = Height(1);
+				m_pLastBlock->Timestamp = Timestamp();
+				bench::FillWithRandomData(m_lastBlockElement.GenerationHash);
+
+				auto delta = m_cache.createDelta();
+				auto& accountStateCache = delta.sub<cache::AccountStateCache>();
+				auto unlockedAccountsModifier = m_unlockedAccounts.modifier();
+				for (auto i = 0u; i < numAccounts; ++i) {
+					auto signingKeyPair = CreateRandomKeyPair();
+					auto vrfKeyPair = CreateRandomKeyPair();
+
+					accountStateCache.addAccount(signingKeyPair.publicKey(), Height(1));
+					auto& accountState = accountStateCache.find(signingKeyPair.publicKey()).get();
+					accountState.ImportanceSnapshots.set(Importance(1'000'000), model::ImportanceHeight(1));
+					accountState.SupplementalPublicKeys.vrf().set(vrfKeyPair.publicKey());
+
+					unlockedAccountsModifier.add(BlockGeneratorAccountDescriptor(std::move(signingKeyPair), std::move(vrfKeyPair)));
+				}
+
+				delta.sub<cache::BlockStatisticCache>().insert(state::BlockStatistic(Height(1)));
+				m_cache.commit(Height(1));
+			}
+
+		public:
+			Harvester createHarvester(thread::IoThreadPool* pPool) const {
+				auto blockGenerator = [](const auto&, auto) { return nullptr; };
+				return pPool
+						? Harvester(m_cache, m_config, Address(), m_unlockedAccounts, blockGenerator, *pPool)
+						: Harvester(m_cache, m_config, Address(), m_unlockedAccounts, blockGenerator);
+			}
+
+			const model::BlockElement& lastBlockElement() const {
+				return m_lastBlockElement;
+			}
+
+		private:
+			model::BlockChainConfiguration m_config;
+			cache::CatapultCache m_cache;
+			UnlockedAccounts m_unlockedAccounts;
+			std::unique_ptr<model::Block> m_pLastBlock;
+			model::BlockElement m_lastBlockElement;
+		};
+
+		void BenchmarkHarvest(benchmark::State& state, thread::IoThreadPool* pPool) {
+			HarvesterContext context(static_cast<size_t>(state.range(0)));
+			auto harvester = context.createHarvester(pPool);
+
+			// no time elapsed since the last block, so no account has a hit and all unlocked accounts are evaluated
+			auto numBlocks = 0u;
+			for (auto _ : state) {
+				if (harvester.harvest(context.lastBlockElement(), Timestamp()))
+					++numBlocks;
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(state.range(0) * state.iterations()));
+			if (0 != numBlocks)
+				CATAPULT_LOG(warning) << numBlocks << " calls to harvest produced blocks";
+		}
+
+		void BenchmarkHarvestSerial(benchmark::State& state) {
+			BenchmarkHarvest(state, nullptr);
+		}
+
+		void BenchmarkHarvestParallel(benchmark::State& state) {
+			auto pPool = thread::CreateIoThreadPool(std::thread::hardware_concurrency(), "harvesting");
+			pPool->start();
+			BenchmarkHarvest(state, pPool.get());
+			pPool->join();
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkHarvestSerial", catapult::harvesting::BenchmarkHarvestSerial)
+			->UseRealTime()
+			->Arg(16)
+			->Arg(128)
+			->Arg(1024)
+			->Arg(4096);
+
+	benchmark::RegisterBenchmark("BenchmarkHarvestParallel", catapult::harvesting::BenchmarkHarvestParallel)
+			->UseRealTime()
+			->Arg(16)
+			->Arg(128)
+			->Arg(1024)
+			->Arg(4096);
+}
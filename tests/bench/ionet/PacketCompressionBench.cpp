@@ -0,0 +1,150 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/PacketCompression.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
+#include "catapult/model/Transaction.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace ionet {
+
+	namespace {
+		constexpr auto Num_Accounts = 1'000u;
+		constexpr auto Transaction_Body_Size = 48u;
+
+		// region test data
+
+		// generates transactions that resemble transfers between a fixed set of accounts, which is the dominant content of
+		// Pull_Blocks and Push_Transactions packets
+		class TransactionGenerator {
+		public:
+			TransactionGenerator() : m_accounts(Num_Accounts) {
+				for (auto& account : m_accounts)
+					bench::FillWithRandomData(account);
+			}
+
+		public:
+			std::shared_ptr<model::Transaction> generate(Timestamp deadline) const {
+				auto size = SizeOf32<model::Transaction>() + Transaction_Body_Size;
+				auto pTransaction = utils::MakeSharedWithSize<model::Transaction>(size);
+				std::memset(static_cast<void*>(pTransaction.get()), 0, size);
+
+				pTransaction->Size = size;
+				bench::FillWithRandomData(pTransaction->Signature);
+				pTransaction->SignerPublicKey = m_accounts[bench::Random() % Num_Accounts];
+				pTransaction->Version = 1;
+				pTransaction->Network = model::NetworkIdentifier::Public;
+				pTransaction->Type = static_cast<model::EntityType>(0x4154);
+				pTransaction->MaxFee = Amount(bench::Random() % 1'000'000);
+				pTransaction->Deadline = deadline;
+
+				// recipient, mosaic id and amount
+				auto* pBody = reinterpret_cast<uint8_t*>(pTransaction.get() + 1);
+				const auto& recipient = m_accounts[bench::Random() % Num_Accounts];
+				std::memcpy(pBody, recipient.data(), Address::Size);
+				reinterpret_cast<uint64_t&>(pBody[Transaction_Body_Size - 16]) = 0x6BED'913F'A202'23F8;
+				reinterpret_cast<uint64_t&>(pBody[Transaction_Body_Size - 8]) = bench::Random() % 100'000'000;
+				return pTransaction;
+			}
+
+		private:
+			std::vector<Key> m_accounts;
+		};
+
+		PacketPayload GeneratePayload(size_t numTransactions) {
+			TransactionGenerator generator;
+			std::vector<std::shared_ptr<model::Transaction>> transactions;
+			for (auto i = 0u; i < numTransactions; ++i)
+				transactions.push_back(generator.generate(Timestamp(1'000'000 + i * 1'000)));
+
+			PacketPayloadBuilder builder(PacketType::Pull_Blocks);
+			builder.appendEntities(transactions);
+			return builder.build();
+		}
+
+		std::shared_ptr<Packet> PayloadToPacket(const PacketPayload& payload) {
+			auto pPacket = CreateSharedPacket<Packet>(payload.header().Size - SizeOf32<Packet>());
+			pPacket->Type = payload.header().Type;
+
+			auto* pData = pPacket->Data();
+			for (const auto& buffer : payload.buffers()) {
+				std::memcpy(pData, buffer.pData, buffer.Size);
+				pData += buffer.Size;
+			}
+
+			return pPacket;
+		}
+
+		void SetCounters(benchmark::State& state, const PacketHeader& uncompressedHeader, const PacketHeader& compressedHeader) {
+			state.SetBytesProcessed(static_cast<int64_t>(uncompressedHeader.Size * state.iterations()));
+			state.counters["ratio"] = static_cast<double>(compressedHeader.Size) / uncompressedHeader.Size;
+			state.counters["saved_bytes"] = static_cast<double>(uncompressedHeader.Size - compressedHeader.Size);
+		}
+
+		// endregion
+
+		// region benchmarks
+
+		void BenchmarkCompress(benchmark::State& state) {
+			auto payload = GeneratePayload(static_cast<size_t>(state.range(0)));
+
+			PacketPayload compressedPayload;
+			for (auto _ : state) {
+				compressedPayload = CompressPacketPayload(payload);
+				benchmark::DoNotOptimize(compressedPayload.header().Size);
+			}
+
+			SetCounters(state, payload.header(), compressedPayload.header());
+		}
+
+		void BenchmarkDecompress(benchmark::State& state) {
+			auto payload = GeneratePayload(static_cast<size_t>(state.range(0)));
+			auto pCompressedPacket = PayloadToPacket(CompressPacketPayload(payload));
+
+			for (auto _ : state) {
+				auto pPacket = DecompressPacket(*pCompressedPacket, payload.header().Size);
+				benchmark::DoNotOptimize(pPacket->Size);
+			}
+
+			SetCounters(state, payload.header(), *pCompressedPacket);
+		}
+
+		// endregion
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkCompress", catapult::ionet::BenchmarkCompress)
+			->UseRealTime()
+			->Unit(benchmark::kMicrosecond)
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(10'000);
+
+	benchmark::RegisterBenchmark("BenchmarkDecompress", catapult::ionet::BenchmarkDecompress)
+			->UseRealTime()
+			->Unit(benchmark::kMicrosecond)
+			->Arg(100)
+			->Arg(1'000)
+			->Arg(10'000);
+}
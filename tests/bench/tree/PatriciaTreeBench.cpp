@@ -0,0 +1,145 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/tree/MemoryDataSource.h"
+#include "catapult/tree/PatriciaTree.h"
+#include "tests/bench/nodeps/Random.h"
+#include <benchmark/benchmark.h>
+
+namespace catapult { namespace tree {
+
+	namespace {
+		constexpr auto Num_Seed_Values = 100'000u;
+
+		class Hash256Encoder {
+		public:
+			using KeyType = Hash256;
+			using ValueType = Hash256;
+
+		public:
+			static const KeyType& EncodeKey(const KeyType& key) {
+				return key;
+			}
+
+			static const Hash256& EncodeValue(const ValueType& value) {
+				return value;
+			}
+		};
+
+		using BenchPatriciaTree = PatriciaTree<Hash256Encoder, MemoryDataSource>;
+		using KeyValuePairs = std::vector<std::pair<Hash256, Hash256>>;
+
+		Hash256 GenerateRandomHash() {
+			Hash256 hash;
+			bench::FillWithRandomData(hash);
+			return hash;
+		}
+
+		class BenchContext {
+		public:
+			BenchContext() : m_dataSource(DataSourceVerbosity::Off) {
+				BenchPatriciaTree tree(m_dataSource);
+				for (auto i = 0u; i < Num_Seed_Values; ++i) {
+					auto key = GenerateRandomHash();
+					tree.set(key, GenerateRandomHash());
+					m_seedKeys.push_back(key);
+				}
+
+				tree.saveAll();
+				m_rootHash = tree.root();
+			}
+
+		public:
+			std::unique_ptr<BenchPatriciaTree> createTree() {
+				auto pTree = std::make_unique<BenchPatriciaTree>(m_dataSource);
+				pTree->tryLoad(m_rootHash);
+				return pTree;
+			}
+
+			KeyValuePairs generateChanges(size_t count) const {
+				// half of the changes update existing values and half of the changes insert new values
+				KeyValuePairs pairs;
+				for (auto i = 0u; i < count; ++i) {
+					auto key = 0 == i % 2 ? m_seedKeys[bench::Random() % m_seedKeys.size()] : GenerateRandomHash();
+					pairs.emplace_back(key, GenerateRandomHash());
+				}
+
+				return pairs;
+			}
+
+		private:
+			MemoryDataSource m_dataSource;
+			std::vector<Hash256> m_seedKeys;
+			Hash256 m_rootHash;
+		};
+
+		BenchContext& GetBenchContext() {
+			static BenchContext context;
+			return context;
+		}
+
+		template<typename TApplyChanges>
+		void BenchmarkApplyChanges(benchmark::State& state, TApplyChanges applyChanges) {
+			auto& context = GetBenchContext();
+			auto numChanges = static_cast<size_t>(state.range(0));
+
+			for (auto _ : state) {
+				state.PauseTiming();
+				auto pTree = context.createTree();
+				auto pairs = context.generateChanges(numChanges);
+				state.ResumeTiming();
+
+				applyChanges(*pTree, pairs);
+				benchmark::DoNotOptimize(pTree->root());
+			}
+
+			state.SetItemsProcessed(static_cast<int64_t>(numChanges * state.iterations()));
+		}
+
+		void BenchmarkSet(benchmark::State& state) {
+			BenchmarkApplyChanges(state, [](auto& tree, const auto& pairs) {
+				for (const auto& pair : pairs)
+					tree.set(pair.first, pair.second);
+			});
+		}
+
+		void BenchmarkSetBatch(benchmark::State& state) {
+			BenchmarkApplyChanges(state, [](auto& tree, const auto& pairs) {
+				tree.setBatch(pairs);
+			});
+		}
+	}
+}}
+
+void RegisterTests();
+void RegisterTests() {
+	benchmark::RegisterBenchmark("BenchmarkSet", catapult::tree::BenchmarkSet)
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond)
+			->Arg(10'000)
+			->Arg(100'000);
+
+	benchmark::RegisterBenchmark("BenchmarkSetBatch", catapult::tree::BenchmarkSetBatch)
+			->UseRealTime()
+			->Unit(benchmark::kMillisecond)
+			->Arg(10'000)
+			->Arg(100'000);
+}
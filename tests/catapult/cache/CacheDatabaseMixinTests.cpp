@@ -124,6 +124,26 @@ namespace catapult { namespace cache {
 		EXPECT_EQ(deltaset::ConditionalContainerMode::Storage, decltype(mixin)::GetContainerMode(config));
 	}
 
+	TEST(TEST_CLASS, CanInitializeDatabaseWithPatriciaTreePruningSupport) {
+		// Arrange:
+		test::TempDirectoryGuard dbDirGuard;
+		auto databaseConfig = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+		databaseConfig.PatriciaTreeRetainedRoots = 5;
+		CacheConfiguration config(dbDirGuard.name(), databaseConfig, PatriciaTreeStorageMode::Enabled);
+
+		// Act:
+		ConcreteCacheDatabaseMixin mixin(config, { "default", "foo", "bar" });
+
+		// Assert:
+		EXPECT_TRUE(mixin.hasPatriciaTreeSupport());
+
+		auto expectedColumnFamilyNames = std::vector<std::string>{ "default", "foo", "bar", "patricia_tree", "patricia_tree_stale" };
+		EXPECT_EQ(expectedColumnFamilyNames, mixin.database().columnFamilyNames());
+		EXPECT_FALSE(mixin.database().canPrune());
+
+		EXPECT_EQ(deltaset::ConditionalContainerMode::Storage, decltype(mixin)::GetContainerMode(config));
+	}
+
 	TEST(TEST_CLASS, CanFlushWhenCacheDatabaseIsDisabled) {
 		// Arrange:
 		CacheConfiguration config;
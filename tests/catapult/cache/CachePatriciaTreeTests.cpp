@@ -241,4 +241,150 @@ namespace catapult { namespace cache {
 	}
 
 	// endregion
+
+	// region enabled - pruning
+
+	namespace {
+		class PruningCacheDatabaseHolder {
+		public:
+			explicit PruningCacheDatabaseHolder(uint32_t numRetainedRoots)
+					: m_database(CacheDatabaseSettings(
+							m_dbDirGuard.name(),
+							CreateDatabaseConfig(numRetainedRoots),
+							{ "default", "patricia_tree", "patricia_tree_stale" },
+							FilterPruningMode::Disabled))
+			{}
+
+		public:
+			CacheDatabase& database() {
+				return m_database;
+			}
+
+			bool contains(const Hash256& nodeHash) {
+				RdbDataIterator iter;
+				m_database.get(1, HashToString(nodeHash), iter);
+				return RdbDataIterator::End() != iter;
+			}
+
+		private:
+			static config::NodeConfiguration::CacheDatabaseSubConfiguration CreateDatabaseConfig(uint32_t numRetainedRoots) {
+				auto databaseConfig = config::NodeConfiguration::CacheDatabaseSubConfiguration();
+				databaseConfig.PatriciaTreeRetainedRoots = numRetainedRoots;
+				return databaseConfig;
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			CacheDatabase m_database;
+		};
+
+		Hash256 SetAndCommit(CachePatriciaTree<DatabaseBasePatriciaTree>& tree, uint32_t key, const std::string& value) {
+			auto pDeltaTree = tree.rebase();
+			pDeltaTree->set(key, value);
+			tree.commit();
+			return tree.get()->root();
+		}
+	}
+
+	TEST(TEST_CLASS, Enabled_PruningRetainsNodesReachableFromRetainedRoots) {
+		// Arrange:
+		PruningCacheDatabaseHolder holder(2);
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+
+		// Act:
+		std::vector<Hash256> rootHashes;
+		for (auto i = 0u; i < 3; ++i)
+			rootHashes.push_back(SetAndCommit(tree, 0x01'23'4A'B6, "value " + std::to_string(i)));
+
+		// Assert: current root and two previous roots are retained
+		for (const auto& rootHash : rootHashes)
+			EXPECT_TRUE(holder.contains(rootHash)) << rootHash;
+	}
+
+	TEST(TEST_CLASS, Enabled_PruningDeletesNodesNotReachableFromRetainedRoots) {
+		// Arrange:
+		PruningCacheDatabaseHolder holder(2);
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+
+		// Act:
+		std::vector<Hash256> rootHashes;
+		for (auto i = 0u; i < 5; ++i)
+			rootHashes.push_back(SetAndCommit(tree, 0x01'23'4A'B6, "value " + std::to_string(i)));
+
+		// Assert: current root and two previous roots are retained
+		EXPECT_FALSE(holder.contains(rootHashes[0]));
+		EXPECT_FALSE(holder.contains(rootHashes[1]));
+		for (auto i = 2u; i < 5; ++i)
+			EXPECT_TRUE(holder.contains(rootHashes[i])) << i;
+	}
+
+	TEST(TEST_CLASS, Enabled_PruningDoesNotDeleteUnchangedSubtrees) {
+		// Arrange:
+		PruningCacheDatabaseHolder holder(1);
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+
+		// - create a branch with two leaves and get the hash of the leaf that will not change
+		SetAndCommit(tree, 0x01'23'4A'B6, "alpha");
+		SetAndCommit(tree, 0x01'23'4A'99, "beta");
+
+		std::vector<tree::TreeNode> nodePath;
+		tree.get()->lookup(0x01'23'4A'99, nodePath);
+		ASSERT_EQ(2u, nodePath.size());
+		auto unchangedLeafHash = nodePath.back().hash();
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i)
+			SetAndCommit(tree, 0x01'23'4A'B6, "value " + std::to_string(i));
+
+		// Assert:
+		EXPECT_TRUE(holder.contains(unchangedLeafHash));
+		EXPECT_TRUE(holder.contains(tree.get()->root()));
+	}
+
+	TEST(TEST_CLASS, Enabled_PruningDoesNotDeleteRevivedNodes) {
+		// Arrange:
+		PruningCacheDatabaseHolder holder(1);
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+
+		// - change value and then change it back, which revives the original root
+		auto rootHash1 = SetAndCommit(tree, 0x01'23'4A'B6, "alpha");
+		auto rootHash2 = SetAndCommit(tree, 0x01'23'4A'B6, "beta");
+		auto rootHash3 = SetAndCommit(tree, 0x01'23'4A'B6, "alpha");
+
+		// Sanity:
+		EXPECT_EQ(rootHash1, rootHash3);
+
+		// Act:
+		auto rootHash4 = SetAndCommit(tree, 0x01'23'4A'99, "gamma");
+
+		// Assert: revived root is retained as previous root but the intermediate root is pruned
+		EXPECT_TRUE(holder.contains(rootHash1));
+		EXPECT_FALSE(holder.contains(rootHash2));
+		EXPECT_TRUE(holder.contains(rootHash4));
+	}
+
+	TEST(TEST_CLASS, Enabled_PruningResumesAfterReload) {
+		// Arrange:
+		PruningCacheDatabaseHolder holder(1);
+		std::vector<Hash256> rootHashes;
+		{
+			CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+			for (auto i = 0u; i < 2; ++i)
+				rootHashes.push_back(SetAndCommit(tree, 0x01'23'4A'B6, "value " + std::to_string(i)));
+		}
+
+		// Sanity:
+		EXPECT_TRUE(holder.contains(rootHashes[0]));
+
+		// Act:
+		CachePatriciaTree<DatabaseBasePatriciaTree> tree(true, holder.database(), 1);
+		rootHashes.push_back(SetAndCommit(tree, 0x01'23'4A'B6, "value 2"));
+
+		// Assert:
+		EXPECT_FALSE(holder.contains(rootHashes[0]));
+		EXPECT_TRUE(holder.contains(rootHashes[1]));
+		EXPECT_TRUE(holder.contains(rootHashes[2]));
+	}
+
+	// endregion
 }}
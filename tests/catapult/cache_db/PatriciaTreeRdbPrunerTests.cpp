@@ -0,0 +1,166 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/cache_db/PatriciaTreeRdbPruner.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/Random.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace cache {
+
+#define TEST_CLASS PatriciaTreeRdbPrunerTests
+
+	// region PatriciaTreeStaleNodesSerializer
+
+	TEST(TEST_CLASS, CanRoundtripStaleNodes) {
+		// Arrange:
+		PatriciaTreeStaleNodes staleNodes{ 123, test::GenerateRandomDataVector<Hash256>(3) };
+
+		// Act:
+		auto serialized = PatriciaTreeStaleNodesSerializer::SerializeValue(staleNodes);
+		auto result = PatriciaTreeStaleNodesSerializer::DeserializeValue({
+			reinterpret_cast<const uint8_t*>(serialized.data()),
+			serialized.size()
+		});
+
+		// Assert:
+		EXPECT_EQ(sizeof(uint64_t) + sizeof(uint32_t) + 3 * Hash256::Size, serialized.size());
+		EXPECT_EQ(123u, result.Generation);
+		EXPECT_EQ(staleNodes.NodeHashes, result.NodeHashes);
+	}
+
+	TEST(TEST_CLASS, KeyToBoundaryReturnsGeneration) {
+		EXPECT_EQ(123u, PatriciaTreeStaleNodesSerializer::KeyToBoundary(123));
+	}
+
+	// endregion
+
+	// region PatriciaTreeRdbPruner
+
+	namespace {
+		class PrunerTestContext {
+		public:
+			explicit PrunerTestContext(uint32_t numRetainedRoots)
+					: m_database(RocksDatabaseSettings(
+							m_dbDirGuard.name(),
+							{ "default", "patricia_tree_stale" },
+							FilterPruningMode::Disabled))
+					, m_container(m_database, 0)
+					, m_pruner(m_container, m_database, 1, numRetainedRoots)
+			{}
+
+		public:
+			auto& pruner() {
+				return m_pruner;
+			}
+
+			bool contains(const Hash256& nodeHash) const {
+				return m_container.cend() != m_container.find(nodeHash);
+			}
+
+			Hash256 save(const tree::TreeNode& node) {
+				m_container.insert(std::make_pair(node.hash(), node.copy()));
+				m_pruner.notifySaved(node);
+				return node.hash();
+			}
+
+		private:
+			test::TempDirectoryGuard m_dbDirGuard;
+			RocksDatabase m_database;
+			PatriciaTreeContainer m_container;
+			PatriciaTreeRdbPruner m_pruner;
+		};
+
+		tree::TreeNode CreateLeaf(uint8_t nibble) {
+			return tree::TreeNode(tree::LeafTreeNode(tree::TreeNodePath(nibble), test::GenerateRandomByteArray<Hash256>()));
+		}
+	}
+
+	TEST(TEST_CLASS, CannotCreatePrunerWithoutRetainedRoots) {
+		EXPECT_THROW(PrunerTestContext(0), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCreatePruner) {
+		// Act:
+		PrunerTestContext context(1);
+
+		// Assert:
+		EXPECT_EQ(0u, context.pruner().generation());
+		EXPECT_EQ(0u, context.pruner().numStaleNodes());
+	}
+
+	TEST(TEST_CLASS, CommitWithoutChangesHasNoEffect) {
+		// Arrange:
+		PrunerTestContext context(1);
+
+		// Act:
+		auto numPrunedNodes = context.pruner().commit(Hash256(), Hash256());
+
+		// Assert:
+		EXPECT_EQ(0u, numPrunedNodes);
+		EXPECT_EQ(0u, context.pruner().generation());
+		EXPECT_EQ(0u, context.pruner().numStaleNodes());
+	}
+
+	TEST(TEST_CLASS, CommitMarksReplacedAndUnreachableSavedNodesAsStale) {
+		// Arrange:
+		PrunerTestContext context(1);
+		auto rootHash1 = context.save(CreateLeaf(0x01));
+		context.pruner().commit(Hash256(), rootHash1);
+
+		// - save an intermediate node that is not reachable from the new root
+		context.save(CreateLeaf(0x02));
+		auto rootHash2 = context.save(CreateLeaf(0x03));
+
+		// Act:
+		auto numPrunedNodes = context.pruner().commit(rootHash1, rootHash2);
+
+		// Assert:
+		EXPECT_EQ(0u, numPrunedNodes);
+		EXPECT_EQ(2u, context.pruner().generation());
+		EXPECT_EQ(2u, context.pruner().numStaleNodes());
+	}
+
+	TEST(TEST_CLASS, CommitPrunesStaleNodesOlderThanRetainedRoots) {
+		// Arrange:
+		PrunerTestContext context(1);
+		std::vector<Hash256> rootHashes{ Hash256() };
+		for (auto i = 0u; i < 2; ++i) {
+			rootHashes.push_back(context.save(CreateLeaf(static_cast<uint8_t>(i))));
+			context.pruner().commit(rootHashes[i], rootHashes[i + 1]);
+		}
+
+		// Act:
+		rootHashes.push_back(context.save(CreateLeaf(0x0F)));
+		auto numPrunedNodes = context.pruner().commit(rootHashes[2], rootHashes[3]);
+
+		// Assert:
+		EXPECT_EQ(1u, numPrunedNodes);
+		EXPECT_EQ(3u, context.pruner().generation());
+		EXPECT_EQ(1u, context.pruner().numStaleNodes());
+
+		EXPECT_FALSE(context.contains(rootHashes[1]));
+		EXPECT_TRUE(context.contains(rootHashes[2]));
+		EXPECT_TRUE(context.contains(rootHashes[3]));
+	}
+
+	// endregion
+}}
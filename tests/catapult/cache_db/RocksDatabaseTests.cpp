@@ -222,6 +222,15 @@ namespace catapult { namespace cache {
 		EXPECT_THROW(database.get(0, "hello", iter), catapult_invalid_argument);
 	}
 
+	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowMultiGet) {
+		// Arrange:
+		RocksDatabase database;
+
+		// Act + Assert:
+		std::vector<RdbDataIterator> iters;
+		EXPECT_THROW(database.multiGet(0, { "hello" }, iters), catapult_invalid_argument);
+	}
+
 	TEST(TEST_CLASS, DefaultCreatedRdbDoesNotAllowPut) {
 		// Arrange:
 		RocksDatabase database;
@@ -384,6 +393,82 @@ namespace catapult { namespace cache {
 
 	// endregion
 
+	// region multiGet
+
+	TEST(TEST_CLASS, MultiGetWithoutKeysReturnsNoValues) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings());
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, {}, iters);
+
+		// Assert:
+		EXPECT_TRUE(iters.empty());
+	}
+
+	TEST(TEST_CLASS, CanMultiGetFromDb_AllExistent) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "world", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[0], "apple", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "world", "apple", "hello" }, iters);
+
+		// Assert:
+		ASSERT_EQ(3u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		test::AssertIteratorValue("incredible", iters[1]);
+		test::AssertIteratorValue("amazing", iters[2]);
+	}
+
+	TEST(TEST_CLASS, CanMultiGetFromDb_SomeNonexistent) {
+		// Arrange:
+		test::RdbTestContext context(DefaultSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[0], "apple", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(0, { "hello", "world", "apple", "nonexistent" }, iters);
+
+		// Assert:
+		ASSERT_EQ(4u, iters.size());
+		test::AssertIteratorValue("amazing", iters[0]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[1]);
+		test::AssertIteratorValue("incredible", iters[2]);
+		EXPECT_EQ(RdbDataIterator::End(), iters[3]);
+	}
+
+	TEST(TEST_CLASS, CanMultiGetFromDb_DifferentColumns) {
+		// Arrange:
+		test::RdbTestContext context(MultiColumnSettings(), [](auto& db, const auto& columns) {
+			db.Put(rocksdb::WriteOptions(), columns[0], "hello", "amazing");
+			db.Put(rocksdb::WriteOptions(), columns[1], "hello", "awesome");
+			db.Put(rocksdb::WriteOptions(), columns[1], "world", "incredible");
+		});
+		auto& database = context.database();
+
+		// Act:
+		std::vector<RdbDataIterator> iters;
+		database.multiGet(1, { "hello", "world" }, iters);
+
+		// Assert: only values from the second column are returned
+		ASSERT_EQ(2u, iters.size());
+		test::AssertIteratorValue("awesome", iters[0]);
+		test::AssertIteratorValue("incredible", iters[1]);
+	}
+
+	// endregion
+
 	// region iterators
 
 	namespace {
@@ -494,6 +579,51 @@ namespace catapult { namespace cache {
 		});
 	}
 
+	TEST(TEST_CLASS, PruneHasNoEffectWhenPruningIsDisabled) {
+		// Arrange: create 120 even keys (0 - 238)
+		auto evenSeeder = test::CreateEvenDbSeeder(120);
+		test::RdbTestContext context(DefaultSettings(), evenSeeder);
+
+		// Act:
+		auto numPruned = context.database().prune(0, 200);
+
+		// Assert:
+		EXPECT_EQ(0u, numPruned);
+		for (auto i = 0u; i < 240; i += 2)
+			AssertHasValidKey(context.database(), i);
+	}
+
+	TEST(TEST_CLASS, PatriciaTreeStaleColumnIsAlwaysPrunable) {
+		// Arrange: seed both columns with 120 even keys (0 - 238)
+		auto evenSeeder = [](auto& db, const auto& columns) {
+			for (auto* pColumn : columns) {
+				for (auto i = 0u; i < 120; ++i) {
+					auto key = static_cast<uint64_t>(i * 2);
+					db.Put(rocksdb::WriteOptions(), pColumn, test::ToSlice(key), test::EvenKeyToValue(key));
+				}
+			}
+		};
+		test::RdbTestContext context(CreateSettings({ "default", "patricia_tree_stale" }), evenSeeder);
+		auto& database = context.database();
+
+		// Act: prune all keys < 200 from both columns
+		auto numPrunedDefault = database.prune(0, 200);
+		auto numPrunedStale = database.prune(1, 200);
+
+		// Assert: only stale column was pruned
+		EXPECT_FALSE(database.canPrune());
+		EXPECT_EQ(0u, numPrunedDefault);
+		EXPECT_EQ(100u, numPrunedStale);
+
+		for (auto i = 0u; i < 240; i += 2) {
+			RdbDataIterator iter;
+			database.get(1, test::ToSlice(i), iter);
+			EXPECT_EQ(i >= 200, RdbDataIterator::End() != iter) << i;
+
+			AssertHasValidKey(database, i);
+		}
+	}
+
 	// endregion
 
 	// region batch processing
@@ -549,6 +549,74 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	namespace {
+		void AssertShortHashesMatchTransactions(const MemoryUtCache& cache, size_t expectedSize) {
+			// Arrange:
+			auto view = cache.view();
+			std::vector<utils::ShortHash> expectedShortHashes;
+			view.forEach([&expectedShortHashes](const auto& info) {
+				expectedShortHashes.push_back(utils::ToShortHash(info.EntityHash));
+				return true;
+			});
+
+			// Act:
+			auto shortHashes = view.shortHashes();
+
+			// Assert:
+			ASSERT_EQ(expectedSize, expectedShortHashes.size());
+			EXPECT_EQ(expectedShortHashes, std::vector<utils::ShortHash>(shortHashes.cbegin(), shortHashes.cend()));
+		}
+
+		void RemoveFirstTransactions(MemoryUtCache& cache, size_t count) {
+			std::vector<Hash256> hashes;
+			cache.view().forEach([count, &hashes](const auto& info) {
+				hashes.push_back(info.EntityHash);
+				return count != hashes.size();
+			});
+
+			test::RemoveAll(cache, hashes);
+		}
+	}
+
+	TEST(TEST_CLASS, ShortHashesExcludesRemovedTransactionsWhenIndexIsNotCompacted) {
+		// Arrange: remove too few transactions to trigger compaction
+		auto pCache = test::CreateSeededMemoryUtCache(10);
+		RemoveFirstTransactions(*pCache, 4);
+
+		// Act + Assert:
+		AssertShortHashesMatchTransactions(*pCache, 6);
+	}
+
+	TEST(TEST_CLASS, ShortHashesExcludesRemovedTransactionsWhenIndexIsCompacted) {
+		// Arrange: remove enough transactions to trigger compaction
+		auto pCache = test::CreateSeededMemoryUtCache(10);
+		test::RemoveAll(*pCache, ExtractEverySecondHash(*pCache));
+
+		// Act + Assert:
+		AssertShortHashesMatchTransactions(*pCache, 5);
+	}
+
+	TEST(TEST_CLASS, ShortHashesPreservesInsertionOrderAcrossCompactions) {
+		// Arrange: remove enough transactions to trigger compaction and add new transactions afterwards
+		auto pCache = test::CreateSeededMemoryUtCache(10);
+		RemoveFirstTransactions(*pCache, 7);
+		test::AddAll(*pCache, test::CreateTransactionInfos(5));
+		RemoveFirstTransactions(*pCache, 2);
+
+		// Act + Assert:
+		AssertShortHashesMatchTransactions(*pCache, 6);
+	}
+
+	TEST(TEST_CLASS, ShortHashesReturnsShortHashesOfTransactionsAddedAfterRemoveAll) {
+		// Arrange:
+		auto pCache = test::CreateSeededMemoryUtCache(10);
+		pCache->modifier().removeAll();
+		test::AddAll(*pCache, test::CreateTransactionInfos(3));
+
+		// Act + Assert:
+		AssertShortHashesMatchTransactions(*pCache, 3);
+	}
+
 	// endregion
 
 	// region unknownTransactions
@@ -610,6 +678,18 @@ namespace catapult { namespace cache {
 		}
 	}
 
+	TEST(TEST_CLASS, UnknownTransactionsExcludesRemovedTransactions) {
+		// Arrange:
+		auto pCache = test::CreateSeededMemoryUtCache(10);
+		test::RemoveAll(*pCache, ExtractEverySecondHash(*pCache));
+
+		// Act:
+		auto transactions = pCache->view().unknownTransactions(Timestamp(), BlockFeeMultiplier(), {});
+
+		// Assert:
+		AssertDeadlines(transactions, { 2, 4, 6, 8, 10 });
+	}
+
 	TEST(TEST_CLASS, UnknownTransactionsReturnsTransactionsWithTotalSizeOfAtMostMaxResponseSize) {
 		// Arrange: determine transaction size from a generated transaction
 		auto transactionSize = test::GetDefaultRandomTransactionSize();
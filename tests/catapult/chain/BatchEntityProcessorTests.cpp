@@ -33,9 +33,22 @@ namespace catapult { namespace chain {
 	namespace {
 		class ProcessorTestContext {
 		public:
-			ProcessorTestContext() : m_processor(CreateBatchEntityProcessor(m_executionConfig.Config))
+			ProcessorTestContext() : ProcessorTestContext(false)
 			{}
 
+			explicit ProcessorTestContext(bool enableAccountPrefetch)
+					: m_processor(CreateBatchEntityProcessor(CreateExecutionConfiguration(m_executionConfig, enableAccountPrefetch)))
+			{}
+
+		private:
+			static ExecutionConfiguration CreateExecutionConfiguration(
+					const test::MockExecutionConfiguration& mockExecutionConfig,
+					bool enableAccountPrefetch) {
+				auto config = mockExecutionConfig.Config;
+				config.EnableAccountPrefetch = enableAccountPrefetch;
+				return config;
+			}
+
 		public:
 			const auto& statefulValidatorParams() const {
 				return m_executionConfig.pValidator->params();
@@ -216,6 +229,22 @@ namespace catapult { namespace chain {
 		context.assertEntityInfos(entityInfos);
 	}
 
+	TEST(TEST_CLASS, CanProcessMultipleEntitiesWithAccountPrefetch) {
+		// Arrange:
+		ProcessorTestContext context(true);
+		auto pBlock = test::GenerateBlockWithTransactions(3);
+		auto entityInfos = ExtractEntityInfosFromBlock(*pBlock);
+
+		// Act:
+		auto result = context.process(Height(247), Timestamp(723), entityInfos);
+
+		// Assert: all entities are published twice (once for collecting prefetch addresses and once for processing)
+		//         but validators and observers are only called during processing
+		EXPECT_EQ(ValidationResult::Success, result);
+		context.assertCounters(8, 8, 8);
+		context.assertContexts(Height(247), Timestamp(723));
+	}
+
 	namespace {
 		void AssertValidatorContext(const validators::ValidatorContext& context, Height height, Timestamp blockTime) {
 			EXPECT_EQ(height, context.Height);
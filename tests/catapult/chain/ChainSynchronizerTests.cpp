@@ -24,6 +24,7 @@
 #include "catapult/model/BlockChainConfiguration.h"
 #include "catapult/model/BlockUtils.h"
 #include "catapult/model/ChainScore.h"
+#include "catapult/model/EntityHasher.h"
 #include "catapult/model/EntityRange.h"
 #include "tests/catapult/chain/test/MockChainApi.h"
 #include "tests/test/core/HashTestUtils.h"
@@ -65,6 +66,7 @@ namespace catapult { namespace chain {
 					, LocalHashes(HashRange::CopyRange(localHashes))
 					, pIo(std::make_shared<MockPacketIo>())
 					, pChainApi(std::make_shared<MockChainApi>(remoteScore, std::move(pRemoteLastBlock)))
+					, LocalHeight(Default_Height)
 					, BlockRangeConsumerCalls(0)
 					, Config(CreateConfiguration()) {
 				pChainApi->setHashes(Last_Finalized_Height, remoteHashes);
@@ -89,8 +91,12 @@ namespace catapult { namespace chain {
 			HashRange LocalHashes;
 			std::shared_ptr<MockPacketIo> pIo;
 			std::shared_ptr<MockChainApi> pChainApi;
+			Height LocalHeight;
 			size_t BlockRangeConsumerCalls;
 			std::vector<model::NodeIdentity> BlockRangeSourceIdentities;
+			std::vector<Height> BlockRangeStartHeights;
+			std::vector<std::shared_ptr<MockChainApi>> AdditionalChainApis;
+			std::vector<size_t> RemoteChainApisSupplierCalls;
 			ChainSynchronizerConfiguration Config;
 			disruptor::ProcessingCompleteFunc ProcessingComplete;
 		};
@@ -102,7 +108,7 @@ namespace catapult { namespace chain {
 		enum class ConsumerMode { Normal, Full };
 
 		RemoteNodeSynchronizer<api::RemoteChainApi> CreateSynchronizer(TestContext& context, ConsumerMode mode = ConsumerMode::Normal) {
-			auto pVerifiableBlock = test::GenerateBlockWithTransactions(0, Default_Height);
+			auto pVerifiableBlock = test::GenerateBlockWithTransactions(0, context.LocalHeight);
 			auto pLocal = std::make_shared<MockChainApi>(context.LocalScore, std::move(pVerifiableBlock));
 			pLocal->setHashes(Last_Finalized_Height, context.LocalHashes);
 
@@ -111,11 +117,24 @@ namespace catapult { namespace chain {
 			auto blockRangeConsumer = [mode, &context](const auto& range, const auto& processingComplete) {
 				++context.BlockRangeConsumerCalls;
 				context.BlockRangeSourceIdentities.push_back(range.SourceIdentity);
+				context.BlockRangeStartHeights.push_back(range.Range.cbegin()->Height);
 				context.ProcessingComplete = processingComplete;
 				return ConsumerMode::Normal == mode ? context.BlockRangeConsumerCalls : 0;
 			};
 
-			return CreateChainSynchronizer(pLocal, context.Config, finalizedHeightSupplier, blockRangeConsumer);
+			auto remoteChainApisSupplier = [&context](auto maxRemoteChainApis) {
+				context.RemoteChainApisSupplierCalls.push_back(maxRemoteChainApis);
+
+				std::vector<std::shared_ptr<const api::RemoteChainApi>> remoteChainApis;
+				for (const auto& pChainApi : context.AdditionalChainApis) {
+					if (remoteChainApis.size() < maxRemoteChainApis)
+						remoteChainApis.push_back(pChainApi);
+				}
+
+				return remoteChainApis;
+			};
+
+			return CreateChainSynchronizer(pLocal, context.Config, finalizedHeightSupplier, remoteChainApisSupplier, blockRangeConsumer);
 		}
 
 		disruptor::ConsumerCompletionResult CreateContinueResult() {
@@ -385,6 +404,318 @@ namespace catapult { namespace chain {
 
 	// endregion
 
+	// region chain synchronization - parallel download
+
+	namespace {
+		constexpr auto Num_Blocks_Per_Chunk = 5u;
+
+		std::vector<std::shared_ptr<Block>> GenerateLinkedBlocks(Height startHeight, size_t numBlocks) {
+			std::vector<std::shared_ptr<Block>> blocks;
+			for (auto i = 0u; i < numBlocks; ++i) {
+				std::shared_ptr<Block> pBlock = test::GenerateBlockWithTransactions(0, startHeight + Height(i));
+				if (!blocks.empty())
+					pBlock->PreviousBlockHash = CalculateHash(*blocks.back());
+
+				blocks.push_back(pBlock);
+			}
+
+			return blocks;
+		}
+
+		void AddBlocks(MockChainApi& chainApi, const std::vector<std::shared_ptr<Block>>& blocks) {
+			for (const auto& pBlock : blocks)
+				chainApi.addBlock(test::CopyEntity(*pBlock));
+		}
+
+		TestContext CreateParallelTestContext(size_t numAdditionalPeers, uint32_t maxParallelSyncPeers) {
+			// local chain is a prefix of remote chain (fork depth 0), so blocks are pulled starting at Default_Height
+			auto context = CreateTestContextWithHashes(9, 10);
+			context.LocalHeight = Default_Height - Height(1);
+			context.Config.MaxParallelSyncPeers = maxParallelSyncPeers;
+
+			auto blocks = GenerateLinkedBlocks(Default_Height, (1 + numAdditionalPeers) * Num_Blocks_Per_Chunk);
+			AddBlocks(*context.pChainApi, blocks);
+			context.pChainApi->setNumBlocksPerBlocksFromRequest({ Num_Blocks_Per_Chunk });
+			for (auto i = 0u; i < numAdditionalPeers; ++i) {
+				auto pChainApi = std::make_shared<MockChainApi>(ChainScore(11), Default_Height);
+				AddBlocks(*pChainApi, blocks);
+				pChainApi->setNumBlocksPerBlocksFromRequest({ Num_Blocks_Per_Chunk });
+				context.AdditionalChainApis.push_back(pChainApi);
+			}
+
+			return context;
+		}
+
+		void AssertParallelSync(const TestContext& context, size_t numBlockConsumerCalls) {
+			ASSERT_EQ(numBlockConsumerCalls, context.BlockRangeConsumerCalls);
+			ASSERT_EQ(numBlockConsumerCalls, context.BlockRangeSourceIdentities.size());
+
+			for (auto i = 0u; i < numBlockConsumerCalls; ++i) {
+				const auto& expectedChainApi = 0 == i ? *context.pChainApi : *context.AdditionalChainApis[i - 1];
+				EXPECT_EQ(expectedChainApi.remoteIdentity().PublicKey, context.BlockRangeSourceIdentities[i].PublicKey) << i;
+				EXPECT_EQ(Default_Height + Height(i * Num_Blocks_Per_Chunk), context.BlockRangeStartHeights[i]) << i;
+			}
+		}
+
+		void AssertParallelPullRequests(const TestContext& context) {
+			for (auto i = 0u; i <= context.AdditionalChainApis.size(); ++i) {
+				const auto& chainApi = 0 == i ? *context.pChainApi : *context.AdditionalChainApis[i - 1];
+				ASSERT_EQ(1u, chainApi.blocksFromRequests().size()) << i;
+
+				const auto& params = chainApi.blocksFromRequests()[0];
+				EXPECT_EQ(Default_Height + Height(i * Num_Blocks_Per_Chunk), params.first) << i;
+				EXPECT_EQ(5u, params.second.NumBlocks) << i;
+				EXPECT_EQ(23u, params.second.NumBytes) << i;
+			}
+		}
+
+		void AssertNoAdditionalPullRequests(const TestContext& context) {
+			ASSERT_EQ(1u, context.pChainApi->blocksFromRequests().size());
+			EXPECT_EQ(Default_Height, context.pChainApi->blocksFromRequests()[0].first);
+
+			for (auto i = 0u; i < context.AdditionalChainApis.size(); ++i)
+				EXPECT_TRUE(context.AdditionalChainApis[i]->blocksFromRequests().empty()) << i;
+		}
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadIsBypassedWhenDisabled) {
+		// Arrange:
+		auto context = CreateParallelTestContext(2, 0);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_TRUE(context.RemoteChainApisSupplierCalls.empty());
+		AssertSync(context, 1);
+		AssertDefaultSinglePullRequest(*context.pChainApi);
+		EXPECT_TRUE(context.AdditionalChainApis[0]->blocksFromRequests().empty());
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadIsBypassedWhenNoAdditionalPeersAreAvailable) {
+		// Arrange:
+		auto context = CreateParallelTestContext(0, 2);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(std::vector<size_t>({ 2 }), context.RemoteChainApisSupplierCalls);
+		AssertSync(context, 1);
+		AssertDefaultSinglePullRequest(*context.pChainApi);
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadIsBypassedWhenLocalChainIsForked) {
+		// Arrange: common block has height 10 + 4 (fork depth 6)
+		auto context = CreateTestContextWithHashes(4, 10, 6);
+		context.Config.MaxParallelSyncPeers = 2;
+		context.AdditionalChainApis.push_back(std::make_shared<MockChainApi>(ChainScore(11), Default_Height));
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: all blocks are pulled from a single peer
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_TRUE(context.RemoteChainApisSupplierCalls.empty());
+		AssertSync(context, 1);
+		EXPECT_EQ(3u, context.pChainApi->blocksFromRequests().size());
+		EXPECT_TRUE(context.AdditionalChainApis[0]->blocksFromRequests().empty());
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadIsBypassedWhenFirstChunkIsIncomplete) {
+		// Arrange: remote is less than one full chunk ahead
+		auto context = CreateParallelTestContext(3, 3);
+		context.pChainApi->setNumBlocksPerBlocksFromRequest({ Num_Blocks_Per_Chunk - 1 });
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: additional peers are not checked out
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_TRUE(context.RemoteChainApisSupplierCalls.empty());
+		AssertParallelSync(context, 1);
+		AssertNoAdditionalPullRequests(context);
+	}
+
+	TEST(TEST_CLASS, CanDownloadBlocksFromMultiplePeersInParallel) {
+		// Arrange:
+		auto context = CreateParallelTestContext(3, 3);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: all chunks are consumed in height order
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(std::vector<size_t>({ 3 }), context.RemoteChainApisSupplierCalls);
+		AssertParallelSync(context, 4);
+		AssertParallelPullRequests(context);
+	}
+
+	TEST(TEST_CLASS, CanDownloadBlocksFromMultiplePeersInParallelWhenResponsesAreDelayed) {
+		// Arrange: delay the first peers more than the last peers
+		auto context = CreateParallelTestContext(2, 2);
+		context.pChainApi->setDelay(utils::TimeSpan::FromMilliseconds(30));
+		context.AdditionalChainApis[0]->setDelay(utils::TimeSpan::FromMilliseconds(20));
+		context.AdditionalChainApis[1]->setDelay(utils::TimeSpan::FromMilliseconds(10));
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: all chunks are consumed in height order
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertParallelSync(context, 3);
+		AssertParallelPullRequests(context);
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadUsesAtMostConfiguredNumberOfAdditionalPeers) {
+		// Arrange: supplier returns at most one additional peer
+		auto context = CreateParallelTestContext(3, 1);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		EXPECT_EQ(std::vector<size_t>({ 1 }), context.RemoteChainApisSupplierCalls);
+		AssertParallelSync(context, 2);
+		EXPECT_TRUE(context.AdditionalChainApis[1]->blocksFromRequests().empty());
+		EXPECT_TRUE(context.AdditionalChainApis[2]->blocksFromRequests().empty());
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadUsesAtMostAsManyAdditionalPeersAsChunksFitIntoUnprocessedBudget) {
+		// Arrange: budget allows four chunks of blocks to be unprocessed
+		auto context = CreateParallelTestContext(3, 3);
+		context.Config.MaxChainBytesPerSyncAttempt = Num_Blocks_Per_Chunk * test::GenerateBlockWithTransactions(0, Default_Height)->Size;
+		auto additionalChainApis = std::move(context.AdditionalChainApis);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// - pull a single (unprocessed) chunk from the primary peer because no additional peers are available
+		auto code1 = synchronizer(*context.pChainApi).get();
+		context.AdditionalChainApis = std::move(additionalChainApis);
+
+		// Act: only three more chunks fit into the budget
+		auto code2 = synchronizer(*context.pChainApi).get();
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code1);
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code2);
+		EXPECT_EQ(std::vector<size_t>({ 3, 2 }), context.RemoteChainApisSupplierCalls);
+		EXPECT_EQ(4u, context.BlockRangeConsumerCalls);
+
+		std::vector<Height> expectedStartHeights;
+		for (auto i = 0u; i < 4; ++i)
+			expectedStartHeights.push_back(Default_Height + Height(i * Num_Blocks_Per_Chunk));
+
+		EXPECT_EQ(expectedStartHeights, context.BlockRangeStartHeights);
+		EXPECT_TRUE(context.AdditionalChainApis[2]->blocksFromRequests().empty());
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadStopsAfterIncompleteChunk) {
+		// Arrange: second peer returns fewer blocks than requested
+		auto context = CreateParallelTestContext(3, 3);
+		context.AdditionalChainApis[1]->setNumBlocksPerBlocksFromRequest({ Num_Blocks_Per_Chunk - 2 });
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: incomplete chunk is consumed but following chunk is not
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertParallelSync(context, 3);
+		AssertParallelPullRequests(context);
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadStopsAtChunkNotLinkedToPreviousChunk) {
+		// Arrange: second peer returns blocks from a different chain
+		auto context = CreateParallelTestContext(3, 3);
+		auto pChainApi = std::make_shared<MockChainApi>(ChainScore(11), Default_Height);
+		AddBlocks(*pChainApi, GenerateLinkedBlocks(Default_Height, 4 * Num_Blocks_Per_Chunk));
+		pChainApi->setNumBlocksPerBlocksFromRequest({ Num_Blocks_Per_Chunk });
+		context.AdditionalChainApis[1] = pChainApi;
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: unlinked chunk and all following chunks are not consumed
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertParallelSync(context, 2);
+		AssertParallelPullRequests(context);
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadStopsAtFailedChunk) {
+		// Arrange:
+		auto context = CreateParallelTestContext(3, 3);
+		context.AdditionalChainApis[1]->setError(MockChainApi::EntryPoint::Blocks_From);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: failure of additional peer does not affect interaction with primary peer
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Success, code);
+		AssertParallelSync(context, 2);
+		AssertParallelPullRequests(context);
+	}
+
+	TEST(TEST_CLASS, ParallelDownloadStopsWhenConsumerIsFull) {
+		// Arrange:
+		auto context = CreateParallelTestContext(3, 3);
+		auto synchronizer = CreateSynchronizer(context, ConsumerMode::Full);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: additional peers are not checked out
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Neutral, code);
+		EXPECT_TRUE(context.RemoteChainApisSupplierCalls.empty());
+		AssertParallelSync(context, 1);
+		AssertNoAdditionalPullRequests(context);
+	}
+
+	TEST(TEST_CLASS, NeutralInteractionWhenFirstChunkOfParallelDownloadHasNoBlocks) {
+		// Arrange:
+		auto context = CreateParallelTestContext(3, 3);
+		context.pChainApi->setNumBlocksPerBlocksFromRequest({ 0 });
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: no chunks are consumed and additional peers are not checked out
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Neutral, code);
+		context.assertNoCalls();
+		EXPECT_TRUE(context.RemoteChainApisSupplierCalls.empty());
+		AssertNoAdditionalPullRequests(context);
+	}
+
+	TEST(TEST_CLASS, FailedInteractionWhenFirstChunkOfParallelDownloadFails) {
+		// Arrange:
+		auto context = CreateParallelTestContext(3, 3);
+		context.pChainApi->setError(MockChainApi::EntryPoint::Blocks_From);
+		auto synchronizer = CreateSynchronizer(context);
+
+		// Act:
+		auto code = synchronizer(*context.pChainApi).get();
+
+		// Assert: no chunks are consumed and additional peers are not checked out
+		EXPECT_EQ(ionet::NodeInteractionResultCode::Failure, code);
+		context.assertNoCalls();
+		EXPECT_TRUE(context.RemoteChainApisSupplierCalls.empty());
+		AssertNoAdditionalPullRequests(context);
+	}
+
+	// endregion
+
 	// region unprocessed elements
 
 	namespace {
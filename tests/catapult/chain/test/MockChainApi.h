@@ -69,6 +69,7 @@ namespace catapult { namespace mocks {
 		}
 
 		/// Adds a block (\a pBlock) to the block map.
+		/// \note Added blocks are returned by blocks-from requests instead of randomly generated blocks.
 		void addBlock(std::unique_ptr<model::Block>&& pBlock) {
 			auto height = pBlock->Height;
 			m_blocks.emplace(height, std::move(pBlock));
@@ -199,7 +200,13 @@ namespace catapult { namespace mocks {
 			std::vector<std::unique_ptr<const model::Block>> blocks;
 			std::vector<const model::Block*> rawBlocks;
 			for (auto i = 0u; i < numBlocks; ++i) {
-				blocks.push_back(test::GenerateBlockWithTransactions(0, startHeight + Height(i)));
+				auto height = startHeight + Height(i);
+				auto iter = m_blocks.find(height);
+				if (m_blocks.cend() != iter)
+					blocks.push_back(test::CopyEntity(*iter->second));
+				else
+					blocks.push_back(test::GenerateBlockWithTransactions(0, height));
+
 				rawBlocks.push_back(blocks[i].get());
 			}
 
@@ -108,8 +108,12 @@ namespace catapult { namespace config {
 			EXPECT_FALSE(config.EnableSingleThreadPool);
 			EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 			EXPECT_TRUE(config.EnableAutoSyncCleanup);
+			EXPECT_FALSE(config.EnableIncrementalStateCheckpoints);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(64), config.StateChangeJournalCheckpointSize);
 
 			EXPECT_EQ(100u, config.FileDatabaseBatchSize);
+			EXPECT_FALSE(config.EnableFileDatabaseMemoryMapping);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(64), config.HotBlocksCacheMaxMemorySize);
 
 			EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 			EXPECT_EQ(Amount(10'000'000), config.TransactionSpamThrottlingMaxBoostFee);
@@ -117,6 +121,7 @@ namespace catapult { namespace config {
 			EXPECT_EQ(84u, config.MaxHashesPerSyncAttempt);
 			EXPECT_EQ(42u, config.MaxBlocksPerSyncAttempt);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(100), config.MaxChainBytesPerSyncAttempt);
+			EXPECT_EQ(0u, config.MaxParallelSyncPeers);
 
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(10), config.ShortLivedCacheTransactionDuration);
 			EXPECT_EQ(utils::TimeSpan::FromMinutes(100), config.ShortLivedCacheBlockDuration);
@@ -135,6 +140,8 @@ namespace catapult { namespace config {
 			EXPECT_EQ(utils::FileSize::FromKilobytes(512), config.SocketWorkingBufferSize);
 			EXPECT_EQ(100u, config.SocketWorkingBufferSensitivity);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(150), config.MaxPacketDataSize);
+			EXPECT_TRUE(config.EnablePacketCompression);
+			EXPECT_EQ(utils::FileSize::FromKilobytes(4), config.PacketCompressionThreshold);
 
 			EXPECT_EQ(4096u, config.BlockDisruptorSlotCount);
 			EXPECT_EQ(utils::FileSize::FromMegabytes(300), config.BlockDisruptorMaxMemorySize);
@@ -146,6 +153,8 @@ namespace catapult { namespace config {
 
 			EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 			EXPECT_TRUE(config.EnableDispatcherInputAuditing);
+			EXPECT_EQ(disruptor::ConsumerWaitStrategy::Spin_Then_Park, config.DispatcherWaitStrategy);
+			EXPECT_EQ(100u, config.MinHashCalculationBatchSize);
 
 			EXPECT_EQ(5'000u, config.MaxTrackedNodes);
 
@@ -165,6 +174,20 @@ namespace catapult { namespace config {
 
 			EXPECT_EQ(utils::FileSize::FromMegabytes(5), config.CacheDatabase.MaxWriteBatchSize);
 
+			EXPECT_EQ(0u, config.CacheDatabase.PatriciaTreeRetainedRoots);
+
+			EXPECT_EQ(10u, config.CacheDatabase.PrimaryColumn.BloomFilterBitsPerKey);
+			EXPECT_EQ(CacheDatabaseCompression::Snappy, config.CacheDatabase.PrimaryColumn.Compression);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.PrimaryColumn.MemtableSize);
+
+			EXPECT_EQ(10u, config.CacheDatabase.PatriciaTreeColumn.BloomFilterBitsPerKey);
+			EXPECT_EQ(CacheDatabaseCompression::Snappy, config.CacheDatabase.PatriciaTreeColumn.Compression);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.PatriciaTreeColumn.MemtableSize);
+
+			EXPECT_EQ(0u, config.CacheDatabase.SecondaryColumn.BloomFilterBitsPerKey);
+			EXPECT_EQ(CacheDatabaseCompression::Snappy, config.CacheDatabase.SecondaryColumn.Compression);
+			EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.SecondaryColumn.MemtableSize);
+
 			EXPECT_EQ("", config.Local.Host);
 			EXPECT_EQ("", config.Local.FriendlyName);
 			EXPECT_EQ(ionet::GetCurrentServerVersion(), config.Local.Version);
@@ -342,12 +365,13 @@ namespace catapult { namespace config {
 	namespace {
 		constexpr auto Generation_Hash_Seed_String = "272C4ECC55B7A42A07478A9550543C62673D1599A8362CC662E019049B76B7F2";
 
-		auto CreateCatapultConfiguration() {
+		auto CreateCatapultConfiguration(bool enablePacketCompression = false) {
 			test::MutableCatapultConfiguration config;
 			config.BlockChain.Network.Identifier = model::NetworkIdentifier::Private_Test;
 			config.BlockChain.Network.GenerationHashSeed = utils::ParseByteArray<GenerationHashSeed>(Generation_Hash_Seed_String);
 
 			config.Node.Port = 9876;
+			config.Node.EnablePacketCompression = enablePacketCompression;
 			config.Node.Local.Host = "alice.com";
 			config.Node.Local.FriendlyName = "a GREAT node";
 			config.Node.Local.Version = ionet::NodeVersion(123);
@@ -384,5 +408,16 @@ namespace catapult { namespace config {
 		EXPECT_EQ(ionet::NodeRoles::Api, metadata.Roles);
 	}
 
+	TEST(TEST_CLASS, CanExtractLocalNodeAdvertisingCompressionSupportFromConfiguration) {
+		// Arrange:
+		auto config = CreateCatapultConfiguration(true);
+
+		// Act:
+		auto node = ToLocalNode(config);
+
+		// Assert:
+		EXPECT_EQ(ionet::NodeRoles::Api | ionet::NodeRoles::Compression, node.metadata().Roles);
+	}
+
 	// endregion
 }}
@@ -43,8 +43,12 @@ namespace catapult { namespace config {
 							{ "enableSingleThreadPool", "true" },
 							{ "enableCacheDatabaseStorage", "true" },
 							{ "enableAutoSyncCleanup", "true" },
+							{ "enableIncrementalStateCheckpoints", "true" },
+							{ "stateChangeJournalCheckpointSize", "17MB" },
 
 							{ "fileDatabaseBatchSize", "888" },
+							{ "enableFileDatabaseMemoryMapping", "true" },
+							{ "hotBlocksCacheMaxMemorySize", "56MB" },
 
 							{ "enableTransactionSpamThrottling", "true" },
 							{ "transactionSpamThrottlingMaxBoostFee", "54'123" },
@@ -52,6 +56,7 @@ namespace catapult { namespace config {
 							{ "maxHashesPerSyncAttempt", "74" },
 							{ "maxBlocksPerSyncAttempt", "50" },
 							{ "maxChainBytesPerSyncAttempt", "2MB" },
+							{ "maxParallelSyncPeers", "3" },
 
 							{ "shortLivedCacheTransactionDuration", "17h" },
 							{ "shortLivedCacheBlockDuration", "23m" },
@@ -70,6 +75,8 @@ namespace catapult { namespace config {
 							{ "socketWorkingBufferSize", "128KB" },
 							{ "socketWorkingBufferSensitivity", "6225" },
 							{ "maxPacketDataSize", "10MB" },
+							{ "enablePacketCompression", "true" },
+							{ "packetCompressionThreshold", "3KB" },
 
 							{ "blockDisruptorSlotCount", "1000" },
 							{ "blockDisruptorMaxMemorySize", "15MB" },
@@ -81,6 +88,8 @@ namespace catapult { namespace config {
 
 							{ "enableDispatcherAbortWhenFull", "true" },
 							{ "enableDispatcherInputAuditing", "true" },
+							{ "dispatcherWaitStrategy", "spin" },
+							{ "minHashCalculationBatchSize", "77" },
 
 							{ "maxTrackedNodes", "222" },
 
@@ -102,7 +111,33 @@ namespace catapult { namespace config {
 							{ "blockCacheSize", "111MB" },
 							{ "memtableMemoryBudget", "45MB" },
 
-							{ "maxWriteBatchSize", "17KB" }
+							{ "maxWriteBatchSize", "17KB" },
+
+							{ "patriciaTreeRetainedRoots", "23" }
+						}
+					},
+					{
+						"cache_database.primary",
+						{
+							{ "bloomFilterBitsPerKey", "12" },
+							{ "compression", "lz4" },
+							{ "memtableSize", "32MB" }
+						}
+					},
+					{
+						"cache_database.patricia_tree",
+						{
+							{ "bloomFilterBitsPerKey", "9" },
+							{ "compression", "zstd" },
+							{ "memtableSize", "16MB" }
+						}
+					},
+					{
+						"cache_database.secondary",
+						{
+							{ "bloomFilterBitsPerKey", "3" },
+							{ "compression", "snappy" },
+							{ "memtableSize", "4MB" }
 						}
 					},
 					{
@@ -165,8 +200,12 @@ namespace catapult { namespace config {
 				EXPECT_FALSE(config.EnableSingleThreadPool);
 				EXPECT_FALSE(config.EnableCacheDatabaseStorage);
 				EXPECT_FALSE(config.EnableAutoSyncCleanup);
+				EXPECT_FALSE(config.EnableIncrementalStateCheckpoints);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.StateChangeJournalCheckpointSize);
 
 				EXPECT_EQ(0u, config.FileDatabaseBatchSize);
+				EXPECT_FALSE(config.EnableFileDatabaseMemoryMapping);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.HotBlocksCacheMaxMemorySize);
 
 				EXPECT_FALSE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(), config.TransactionSpamThrottlingMaxBoostFee);
@@ -174,6 +213,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(0u, config.MaxHashesPerSyncAttempt);
 				EXPECT_EQ(0u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(0u, config.MaxParallelSyncPeers);
 
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(0), config.ShortLivedCacheBlockDuration);
@@ -192,6 +232,8 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.SocketWorkingBufferSize);
 				EXPECT_EQ(0u, config.SocketWorkingBufferSensitivity);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.MaxPacketDataSize);
+				EXPECT_FALSE(config.EnablePacketCompression);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.PacketCompressionThreshold);
 
 				EXPECT_EQ(0u, config.BlockDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.BlockDisruptorMaxMemorySize);
@@ -203,6 +245,8 @@ namespace catapult { namespace config {
 
 				EXPECT_FALSE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_FALSE(config.EnableDispatcherInputAuditing);
+				EXPECT_EQ(disruptor::ConsumerWaitStrategy::Sleep, config.DispatcherWaitStrategy);
+				EXPECT_EQ(0u, config.MinHashCalculationBatchSize);
 
 				EXPECT_EQ(0u, config.MaxTrackedNodes);
 
@@ -222,6 +266,18 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromMegabytes(0), config.CacheDatabase.MaxWriteBatchSize);
 
+				EXPECT_EQ(0u, config.CacheDatabase.PatriciaTreeRetainedRoots);
+
+				for (const auto* pColumnConfig : {
+					&config.CacheDatabase.PrimaryColumn,
+					&config.CacheDatabase.PatriciaTreeColumn,
+					&config.CacheDatabase.SecondaryColumn
+				}) {
+					EXPECT_EQ(0u, pColumnConfig->BloomFilterBitsPerKey);
+					EXPECT_EQ(CacheDatabaseCompression::None, pColumnConfig->Compression);
+					EXPECT_EQ(utils::FileSize::FromMegabytes(0), pColumnConfig->MemtableSize);
+				}
+
 				EXPECT_EQ("", config.Local.Host);
 				EXPECT_EQ("", config.Local.FriendlyName);
 				EXPECT_EQ(ionet::NodeVersion(), config.Local.Version);
@@ -260,8 +316,12 @@ namespace catapult { namespace config {
 				EXPECT_TRUE(config.EnableSingleThreadPool);
 				EXPECT_TRUE(config.EnableCacheDatabaseStorage);
 				EXPECT_TRUE(config.EnableAutoSyncCleanup);
+				EXPECT_TRUE(config.EnableIncrementalStateCheckpoints);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(17), config.StateChangeJournalCheckpointSize);
 
 				EXPECT_EQ(888u, config.FileDatabaseBatchSize);
+				EXPECT_TRUE(config.EnableFileDatabaseMemoryMapping);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(56), config.HotBlocksCacheMaxMemorySize);
 
 				EXPECT_TRUE(config.EnableTransactionSpamThrottling);
 				EXPECT_EQ(Amount(54'123), config.TransactionSpamThrottlingMaxBoostFee);
@@ -269,6 +329,7 @@ namespace catapult { namespace config {
 				EXPECT_EQ(74u, config.MaxHashesPerSyncAttempt);
 				EXPECT_EQ(50u, config.MaxBlocksPerSyncAttempt);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(2), config.MaxChainBytesPerSyncAttempt);
+				EXPECT_EQ(3u, config.MaxParallelSyncPeers);
 
 				EXPECT_EQ(utils::TimeSpan::FromHours(17), config.ShortLivedCacheTransactionDuration);
 				EXPECT_EQ(utils::TimeSpan::FromMinutes(23), config.ShortLivedCacheBlockDuration);
@@ -287,6 +348,8 @@ namespace catapult { namespace config {
 				EXPECT_EQ(utils::FileSize::FromKilobytes(128), config.SocketWorkingBufferSize);
 				EXPECT_EQ(6225u, config.SocketWorkingBufferSensitivity);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(10), config.MaxPacketDataSize);
+				EXPECT_TRUE(config.EnablePacketCompression);
+				EXPECT_EQ(utils::FileSize::FromKilobytes(3), config.PacketCompressionThreshold);
 
 				EXPECT_EQ(1000u, config.BlockDisruptorSlotCount);
 				EXPECT_EQ(utils::FileSize::FromMegabytes(15), config.BlockDisruptorMaxMemorySize);
@@ -298,6 +361,8 @@ namespace catapult { namespace config {
 
 				EXPECT_TRUE(config.EnableDispatcherAbortWhenFull);
 				EXPECT_TRUE(config.EnableDispatcherInputAuditing);
+				EXPECT_EQ(disruptor::ConsumerWaitStrategy::Spin, config.DispatcherWaitStrategy);
+				EXPECT_EQ(77u, config.MinHashCalculationBatchSize);
 
 				EXPECT_EQ(222u, config.MaxTrackedNodes);
 
@@ -317,6 +382,20 @@ namespace catapult { namespace config {
 
 				EXPECT_EQ(utils::FileSize::FromKilobytes(17), config.CacheDatabase.MaxWriteBatchSize);
 
+				EXPECT_EQ(23u, config.CacheDatabase.PatriciaTreeRetainedRoots);
+
+				EXPECT_EQ(12u, config.CacheDatabase.PrimaryColumn.BloomFilterBitsPerKey);
+				EXPECT_EQ(CacheDatabaseCompression::Lz4, config.CacheDatabase.PrimaryColumn.Compression);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(32), config.CacheDatabase.PrimaryColumn.MemtableSize);
+
+				EXPECT_EQ(9u, config.CacheDatabase.PatriciaTreeColumn.BloomFilterBitsPerKey);
+				EXPECT_EQ(CacheDatabaseCompression::Zstd, config.CacheDatabase.PatriciaTreeColumn.Compression);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(16), config.CacheDatabase.PatriciaTreeColumn.MemtableSize);
+
+				EXPECT_EQ(3u, config.CacheDatabase.SecondaryColumn.BloomFilterBitsPerKey);
+				EXPECT_EQ(CacheDatabaseCompression::Snappy, config.CacheDatabase.SecondaryColumn.Compression);
+				EXPECT_EQ(utils::FileSize::FromMegabytes(4), config.CacheDatabase.SecondaryColumn.MemtableSize);
+
 				EXPECT_EQ("alice.com", config.Local.Host);
 				EXPECT_EQ("a GREAT node", config.Local.FriendlyName);
 				EXPECT_EQ(ionet::NodeVersion(0x04010203), config.Local.Version);
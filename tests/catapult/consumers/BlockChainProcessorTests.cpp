@@ -29,6 +29,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/test/nodeps/ParamsCapture.h"
 #include "tests/TestHarness.h"
@@ -206,15 +207,21 @@ namespace catapult { namespace consumers {
 		struct ProcessorTestContext {
 		public:
 			explicit ProcessorTestContext(ReceiptValidationMode receiptValidationMode = ReceiptValidationMode::Disabled)
+					: ProcessorTestContext(receiptValidationMode, nullptr)
+			{}
+
+			ProcessorTestContext(ReceiptValidationMode receiptValidationMode, thread::IoThreadPool* pPool)
 					: BlockHitPredicateFactory(BlockHitPredicate) {
-				Processor = CreateBlockChainProcessor(
-						[this](const auto& cache) {
-							return BlockHitPredicateFactory(cache);
-						},
-						[this](auto height, auto timestamp, const auto& entities, auto& state) {
-							return BatchEntityProcessor(height, timestamp, entities, state);
-						},
-						receiptValidationMode);
+				auto blockHitPredicateFactory = [this](const auto& cache) {
+					return BlockHitPredicateFactory(cache);
+				};
+				auto batchEntityProcessor = [this](auto height, auto timestamp, const auto& entities, auto& state) {
+					return BatchEntityProcessor(height, timestamp, entities, state);
+				};
+
+				Processor = pPool
+						? CreateBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode, *pPool)
+						: CreateBlockChainProcessor(blockHitPredicateFactory, batchEntityProcessor, receiptValidationMode);
 			}
 
 		public:
@@ -493,6 +500,49 @@ namespace catapult { namespace consumers {
 
 	// endregion
 
+	// region valid - pool
+
+	TEST(TEST_CLASS, CanProcessMultipleBlocksWithPool) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool(2);
+		ProcessorTestContext context(ReceiptValidationMode::Disabled, pPool.get());
+		auto pParentBlock = test::GenerateEmptyRandomBlock();
+		auto elements = test::CreateBlockElements(3);
+		PrepareChain(Height(11), *pParentBlock, elements);
+
+		// Act:
+		auto result = context.Process(*pParentBlock, elements);
+
+		// Assert:
+		EXPECT_EQ(ValidationResult::Success, result);
+		EXPECT_EQ(3u, context.BlockHitPredicate.params().size());
+		EXPECT_EQ(3u, context.BatchEntityProcessor.params().size());
+		context.assertBlockHitPredicateCalls(*pParentBlock, elements);
+		context.assertBatchEntityProcessorCalls(elements);
+	}
+
+	TEST(TEST_CLASS, ExecuteShortCircuitsOnInconsistentStateHashWithPool) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool(2);
+		ProcessorTestContext context(ReceiptValidationMode::Disabled, pPool.get());
+		auto pParentBlock = test::GenerateEmptyRandomBlock();
+		auto elements = test::CreateBlockElements(3);
+		PrepareChain(Height(11), *pParentBlock, elements);
+
+		// - invalidate the second block state hash
+		test::FillWithRandomData(const_cast<model::Block&>(elements[1].Block).StateHash);
+
+		// Act:
+		auto result = context.Process(*pParentBlock, elements);
+
+		// Assert:
+		EXPECT_EQ(chain::Failure_Chain_Block_Inconsistent_State_Hash, result);
+		EXPECT_EQ(2u, context.BlockHitPredicate.params().size());
+		EXPECT_EQ(2u, context.BatchEntityProcessor.params().size());
+	}
+
+	// endregion
+
 	// region valid - remote harvester
 
 	namespace {
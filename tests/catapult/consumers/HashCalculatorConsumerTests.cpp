@@ -29,6 +29,7 @@
 #include "tests/catapult/consumers/test/ConsumerTestUtils.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
+#include "tests/test/core/ThreadPoolTestUtils.h"
 #include "tests/test/core/mocks/MockTransaction.h"
 #include "tests/test/core/mocks/MockTransactionPluginWithCustomBuffers.h"
 #include "tests/test/nodeps/TestConstants.h"
@@ -150,14 +151,18 @@ namespace catapult { namespace consumers {
 			EXPECT_EQ(numExpectedTransactions, numTransactions);
 		}
 
-		void AssertBlockHashesAreCalculatedCorrectly(uint32_t numBlocks, uint32_t numTransactionsPerBlock) {
+		template<typename TCreateConsumer>
+		void AssertBlockHashesAreCalculatedCorrectly(
+				uint32_t numBlocks,
+				uint32_t numTransactionsPerBlock,
+				TCreateConsumer createConsumer) {
 			// Arrange:
 			auto registry = CustomBuffersTraits::CreateTransactionRegistry();
 			auto input = CreateBlockConsumerInput(registry, numBlocks, numTransactionsPerBlock);
 			auto& blockElements = input.blocks();
 
 			// Act:
-			auto result = CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry)(blockElements);
+			auto result = createConsumer(registry)(blockElements);
 
 			// Assert:
 			test::AssertContinued(result);
@@ -165,6 +170,12 @@ namespace catapult { namespace consumers {
 			for (const auto& blockElement : blockElements)
 				AssertCorrectHashes(blockElement, numTransactionsPerBlock);
 		}
+
+		void AssertBlockHashesAreCalculatedCorrectly(uint32_t numBlocks, uint32_t numTransactionsPerBlock) {
+			AssertBlockHashesAreCalculatedCorrectly(numBlocks, numTransactionsPerBlock, [](const auto& registry) {
+				return CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry);
+			});
+		}
 	}
 
 	TEST(BLOCK_TEST_CLASS, CanProcessZeroEntities) {
@@ -269,14 +280,15 @@ namespace catapult { namespace consumers {
 			return ConsumerInput(std::move(range));
 		}
 
-		void AssertTransactionHashesAreCalculatedCorrectly(uint32_t numTransactions) {
+		template<typename TCreateConsumer>
+		void AssertTransactionHashesAreCalculatedCorrectly(uint32_t numTransactions, TCreateConsumer createConsumer) {
 			// Arrange:
 			auto registry = CustomBuffersTraits::CreateTransactionRegistry();
 			auto input = CreateTransactionConsumerInput(numTransactions);
 			auto& transactionElements = input.transactions();
 
 			// Act:
-			auto result = CreateTransactionHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry)(transactionElements);
+			auto result = createConsumer(registry)(transactionElements);
 
 			// Assert:
 			test::AssertContinued(result);
@@ -284,6 +296,12 @@ namespace catapult { namespace consumers {
 			for (const auto& transactionElement : transactionElements)
 				AssertCorrectHash(transactionElement);
 		}
+
+		void AssertTransactionHashesAreCalculatedCorrectly(uint32_t numTransactions) {
+			AssertTransactionHashesAreCalculatedCorrectly(numTransactions, [](const auto& registry) {
+				return CreateTransactionHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry);
+			});
+		}
 	}
 
 	TEST(TRANSACTION_TEST_CLASS, CanProcessZeroEntities) {
@@ -319,6 +337,53 @@ namespace catapult { namespace consumers {
 
 	// endregion
 
+	// region parallel hash calculation
+
+	namespace {
+		constexpr uint32_t Num_Pool_Threads = 4;
+	}
+
+	TEST(BLOCK_TEST_CLASS, CanProcessMultipleEntitiesWithTransactionsInParallel) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool(Num_Pool_Threads);
+
+		// Act + Assert:
+		for (auto minBatchSize : { 1u, 3u, 100u }) {
+			AssertBlockHashesAreCalculatedCorrectly(7, 5, [&pool = *pPool, minBatchSize](const auto& registry) {
+				return CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry, pool, minBatchSize);
+			});
+		}
+	}
+
+	TEST(BLOCK_TEST_CLASS, MultipleEntitiesAreSkippedInParallelWhenAnyBlockTransactionsHashDoesNotMatch) {
+		// Arrange: corrupt the block transactions hash
+		auto pPool = test::CreateStartedIoThreadPool(Num_Pool_Threads);
+		auto registry = mocks::CreateDefaultTransactionRegistry();
+		auto input = CreateBlockConsumerInput(7, 5);
+		auto& blockElements = input.blocks();
+		const_cast<model::Block&>(blockElements[4].Block).TransactionsHash[0] ^= 0xFF;
+
+		// Act:
+		auto result = CreateBlockHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry, *pPool, 1)(blockElements);
+
+		// Assert: the elements were skipped because a block transactions hash didn't match
+		test::AssertAborted(result, Failure_Consumer_Block_Transactions_Hash_Mismatch, disruptor::ConsumerResultSeverity::Failure);
+	}
+
+	TEST(TRANSACTION_TEST_CLASS, CanProcessMultipleEntitiesInParallel) {
+		// Arrange:
+		auto pPool = test::CreateStartedIoThreadPool(Num_Pool_Threads);
+
+		// Act + Assert:
+		for (auto minBatchSize : { 1u, 3u, 100u }) {
+			AssertTransactionHashesAreCalculatedCorrectly(17, [&pool = *pPool, minBatchSize](const auto& registry) {
+				return CreateTransactionHashCalculatorConsumer(GetNetworkGenerationHashSeed(), registry, pool, minBatchSize);
+			});
+		}
+	}
+
+	// endregion
+
 	// region dependent hash calculation
 
 	namespace {
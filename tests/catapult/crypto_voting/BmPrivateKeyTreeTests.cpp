@@ -418,4 +418,127 @@ namespace catapult { namespace crypto {
 	}
 
 	// endregion
+
+	// region VerifyMulti
+
+	namespace {
+		constexpr auto Num_Verify_Trees = 4u;
+
+		struct SignedMessage {
+			BmKeyIdentifier KeyIdentifier;
+			std::array<uint8_t, 10> Buffer;
+			BmTreeSignature Signature;
+		};
+
+		std::vector<SignedMessage> SignMessages() {
+			// sign one message with every key of multiple trees so that signatures span multiple batches
+			std::vector<SignedMessage> signedMessages;
+			for (auto i = 0u; i < Num_Verify_Trees; ++i) {
+				TestContext context;
+				for (auto keyId = Start_Key.KeyId; keyId <= End_Key.KeyId; ++keyId) {
+					auto messageBuffer = test::GenerateRandomArray<10>();
+					auto signature = context.tree().sign({ keyId }, messageBuffer);
+					signedMessages.push_back({ { keyId }, messageBuffer, signature });
+				}
+			}
+
+			return signedMessages;
+		}
+
+		std::vector<bool> VerifyAll(const std::vector<SignedMessage>& signedMessages) {
+			std::vector<BmTreeSignatureInput> signatureInputs;
+			for (const auto& signedMessage : signedMessages)
+				signatureInputs.push_back({ signedMessage.Signature, signedMessage.KeyIdentifier, signedMessage.Buffer });
+
+			auto randomFiller = [](auto* pOut, auto count) {
+				// can use low entropy source for tests
+				utils::LowEntropyRandomGenerator().fill(pOut, count);
+			};
+			return VerifyMulti(randomFiller, signatureInputs.data(), signatureInputs.size());
+		}
+
+		template<typename TMutator>
+		void AssertVerifyMultiDetectsInvalidSignatures(TMutator mutator) {
+			// Arrange:
+			auto signedMessages = SignMessages();
+			std::vector<bool> expectedResults(signedMessages.size(), true);
+			for (auto index : { 1u, 17u, 31u, 38u }) {
+				mutator(signedMessages[index]);
+				expectedResults[index] = false;
+			}
+
+			// Act:
+			auto results = VerifyAll(signedMessages);
+
+			// Assert:
+			EXPECT_EQ(expectedResults, results);
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenNoSignaturesAreProvided) {
+		// Act:
+		auto results = VerifyAll({});
+
+		// Assert:
+		EXPECT_TRUE(results.empty());
+	}
+
+	TEST(TEST_CLASS, VerifyMultiSucceedsWhenAllSignaturesAreValid) {
+		// Arrange:
+		auto signedMessages = SignMessages();
+
+		// Act:
+		auto results = VerifyAll(signedMessages);
+
+		// Assert:
+		EXPECT_EQ(std::vector<bool>(Num_Verify_Trees * Num_Keys, true), results);
+	}
+
+	TEST(TEST_CLASS, VerifyMultiAgreesWithVerify) {
+		// Arrange:
+		auto signedMessages = SignMessages();
+		signedMessages[5].Buffer[0] ^= 0xFF;
+
+		// Act:
+		auto results = VerifyAll(signedMessages);
+
+		// Assert:
+		ASSERT_EQ(signedMessages.size(), results.size());
+		for (auto i = 0u; i < signedMessages.size(); ++i) {
+			const auto& signedMessage = signedMessages[i];
+			EXPECT_EQ(Verify(signedMessage.Signature, signedMessage.KeyIdentifier, signedMessage.Buffer), results[i]) << "at " << i;
+		}
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenRootSignaturesAreInvalid) {
+		AssertVerifyMultiDetectsInvalidSignatures([](auto& signedMessage) {
+			signedMessage.Signature.Root.Signature[0] ^= 0xFF;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenBottomSignaturesAreInvalid) {
+		AssertVerifyMultiDetectsInvalidSignatures([](auto& signedMessage) {
+			signedMessage.Signature.Bottom.Signature[0] ^= 0xFF;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenBottomPublicKeysAreInvalid) {
+		AssertVerifyMultiDetectsInvalidSignatures([](auto& signedMessage) {
+			signedMessage.Signature.Bottom.ParentPublicKey[0] ^= 0xFF;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenKeyIdentifiersDoNotMatch) {
+		AssertVerifyMultiDetectsInvalidSignatures([](auto& signedMessage) {
+			++signedMessage.KeyIdentifier.KeyId;
+		});
+	}
+
+	TEST(TEST_CLASS, VerifyMultiFailsWhenBuffersAreModified) {
+		AssertVerifyMultiDetectsInvalidSignatures([](auto& signedMessage) {
+			signedMessage.Buffer[0] ^= 0xFF;
+		});
+	}
+
+	// endregion
 }}
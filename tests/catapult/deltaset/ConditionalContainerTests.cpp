@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/deltaset/ConditionalContainer.h"
+#include "catapult/deltaset/BaseSetDelta.h"
 #include "catapult/deltaset/OrderedSet.h"
 #include "catapult/utils/ContainerHelpers.h"
 #include "tests/test/other/DeltaElementsTestUtils.h"
@@ -384,4 +385,194 @@ namespace catapult { namespace deltaset {
 	}
 
 	// endregion
+
+	// region prefetch
+
+	namespace {
+		using PrefetchElementType = SetTraits::Types::MemorySetType::value_type;
+		using PrefetchElements = std::vector<PrefetchElementType>;
+
+		struct StorageAccessCounters {
+			size_t NumFinds = 0;
+			std::vector<PrefetchElements> FindAllKeys;
+		};
+
+		// storage set that supports batched lookups and records all lookups
+		class BatchStorageSetType : public SetTraits::Types::StorageSetType {
+		private:
+			using BaseType = SetTraits::Types::StorageSetType;
+
+		public:
+			explicit BatchStorageSetType(StorageAccessCounters& counters) : m_counters(counters)
+			{}
+
+		public:
+			const_iterator find(const PrefetchElementType& key) const {
+				++m_counters.NumFinds;
+				return BaseType::find(key);
+			}
+
+			std::vector<const_iterator> findAll(const PrefetchElements& keys) const {
+				m_counters.FindAllKeys.push_back(keys);
+
+				std::vector<const_iterator> iterators;
+				for (const auto& key : keys)
+					iterators.push_back(BaseType::find(key));
+
+				return iterators;
+			}
+
+		private:
+			StorageAccessCounters& m_counters;
+		};
+
+		using BatchContainerType = ConditionalContainer<
+			SetTraits::Types::StorageTraits::KeyTraits,
+			BatchStorageSetType,
+			SetTraits::Types::MemorySetType>;
+
+		void SeedContainer(BatchContainerType& container, StorageAccessCounters& counters) {
+			SetTraits::DeltaElementsWrapper wrapper;
+			SetTraits::AddElement(wrapper.Added, "alpha", 5);
+			SetTraits::AddElement(wrapper.Added, "beta", 6);
+			SetTraits::AddElement(wrapper.Added, "gamma", 7);
+			container.update(wrapper.deltas());
+
+			// ignore any lookups made while seeding
+			counters = StorageAccessCounters();
+		}
+
+		PrefetchElements CreatePrefetchKeys() {
+			return { PrefetchElementType("alpha", 5), PrefetchElementType("omega", 9), PrefetchElementType("gamma", 7) };
+		}
+
+		template<typename TAction>
+		void AssertPrefetchForwardsFoundElements(TAction action) {
+			// Arrange:
+			StorageAccessCounters counters;
+			BatchContainerType container(ConditionalContainerMode::Storage, counters);
+			SeedContainer(container, counters);
+
+			// Act:
+			PrefetchElements prefetchedElements;
+			action(container, CreatePrefetchKeys(), [&prefetchedElements](const auto& element) {
+				prefetchedElements.push_back(element);
+			});
+
+			// Assert: a single batched lookup was made and only found elements were forwarded
+			ASSERT_EQ(1u, counters.FindAllKeys.size());
+			EXPECT_EQ(CreatePrefetchKeys(), counters.FindAllKeys[0]);
+			EXPECT_EQ(0u, counters.NumFinds);
+
+			EXPECT_EQ(PrefetchElements({ PrefetchElementType("alpha", 5), PrefetchElementType("gamma", 7) }), prefetchedElements);
+		}
+	}
+
+	TEST(TEST_CLASS, PrefetchForwardsFoundElementsToConsumer_Storage) {
+		AssertPrefetchForwardsFoundElements([](const auto& container, const auto& keys, auto consumer) {
+			container.prefetch(keys, consumer);
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetchForwardsFoundElementsToConsumer_StorageViaFreeFunction) {
+		AssertPrefetchForwardsFoundElements([](const auto& container, const auto& keys, auto consumer) {
+			PrefetchBaseSet(container, keys, consumer);
+		});
+	}
+
+	TEST(TEST_CLASS, PrefetchHasNoEffect_Memory) {
+		// Arrange:
+		StorageAccessCounters counters;
+		BatchContainerType container(ConditionalContainerMode::Memory, counters);
+		SeedContainer(container, counters);
+
+		// Act:
+		auto numPrefetchedElements = 0u;
+		container.prefetch(CreatePrefetchKeys(), [&numPrefetchedElements](const auto&) {
+			++numPrefetchedElements;
+		});
+
+		// Assert:
+		EXPECT_TRUE(counters.FindAllKeys.empty());
+		EXPECT_EQ(0u, numPrefetchedElements);
+	}
+
+	// endregion
+
+	// region prefetch - delta
+
+	namespace {
+		using BatchDeltaType = BaseSetDelta<
+			MutableTypeTraits<PrefetchElementType>,
+			SetStorageTraits<BatchContainerType, SetTraits::Types::MemorySetType>>;
+	}
+
+	TEST(TEST_CLASS, DeltaCanFindPrefetchedElementsWithoutAccessingStorage) {
+		// Arrange:
+		StorageAccessCounters counters;
+		BatchContainerType container(ConditionalContainerMode::Storage, counters);
+		SeedContainer(container, counters);
+
+		BatchDeltaType delta(container);
+
+		// Act:
+		delta.prefetch(CreatePrefetchKeys());
+
+		const auto& readOnlyDelta = delta;
+		auto iter = readOnlyDelta.find(PrefetchElementType("alpha", 5));
+		auto contains = readOnlyDelta.contains(PrefetchElementType("gamma", 7));
+
+		// Assert: prefetched elements were found without single lookups
+		ASSERT_TRUE(!!iter.get());
+		EXPECT_EQ(PrefetchElementType("alpha", 5), *iter.get());
+		EXPECT_TRUE(contains);
+
+		EXPECT_EQ(1u, counters.FindAllKeys.size());
+		EXPECT_EQ(0u, counters.NumFinds);
+
+		// - prefetched elements are not modifications
+		auto deltas = delta.deltas();
+		EXPECT_TRUE(deltas.Added.empty());
+		EXPECT_TRUE(deltas.Removed.empty());
+		EXPECT_TRUE(deltas.Copied.empty());
+	}
+
+	TEST(TEST_CLASS, DeltaDoesNotPrefetchElementsAlreadyInMemory) {
+		// Arrange:
+		StorageAccessCounters counters;
+		BatchContainerType container(ConditionalContainerMode::Storage, counters);
+		SeedContainer(container, counters);
+
+		BatchDeltaType delta(container);
+		delta.insert(PrefetchElementType("omega", 9));
+		delta.prefetch({ PrefetchElementType("alpha", 5) });
+
+		// Act:
+		delta.prefetch(CreatePrefetchKeys());
+
+		// Assert: only gamma needed to be loaded by second prefetch
+		ASSERT_EQ(2u, counters.FindAllKeys.size());
+		EXPECT_EQ(PrefetchElements({ PrefetchElementType("gamma", 7) }), counters.FindAllKeys[1]);
+	}
+
+	TEST(TEST_CLASS, DeltaResetClearsPrefetchedElements) {
+		// Arrange:
+		StorageAccessCounters counters;
+		BatchContainerType container(ConditionalContainerMode::Storage, counters);
+		SeedContainer(container, counters);
+
+		BatchDeltaType delta(container);
+		delta.prefetch(CreatePrefetchKeys());
+
+		// Act:
+		delta.reset();
+		const auto& readOnlyDelta = delta;
+		auto iter = readOnlyDelta.find(PrefetchElementType("alpha", 5));
+
+		// Assert: storage was accessed because prefetched elements were cleared
+		ASSERT_TRUE(!!iter.get());
+		EXPECT_EQ(1u, counters.NumFinds);
+	}
+
+	// endregion
 }}
@@ -53,6 +53,9 @@ namespace catapult { namespace disruptor {
 			EXPECT_EQ(0u, dispatcher.numAddedElements());
 			EXPECT_EQ(0u, dispatcher.numActiveElements());
 			EXPECT_EQ(utils::FileSize(), dispatcher.memorySize());
+			EXPECT_EQ(0u, dispatcher.lastElementLatencyMicros());
+			EXPECT_EQ(0u, dispatcher.maxElementLatencyMicros());
+			EXPECT_EQ(0u, dispatcher.elementLatencyHistogram().values().count());
 			EXPECT_TRUE(dispatcher.isRunning());
 		}
 
@@ -475,6 +478,161 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region wait strategies
+
+	namespace {
+		void AssertCanConsumeAndInspectAllElementsWithWaitStrategy(ConsumerWaitStrategy waitStrategy) {
+			// Arrange:
+			auto options = Test_Dispatcher_Options;
+			options.WaitStrategy = waitStrategy;
+
+			auto ranges = test::PrepareRanges(5);
+			auto expectedHeights = GetExpectedHeights(ranges);
+			CollectedHeights collectedHeights[3];
+			CollectedHeights inspectedHeights;
+			std::vector<CompletionStatus> inspectedStatuses;
+
+			ConsumerDispatcher dispatcher(
+					options,
+					{
+						CreateConsumer(collectedHeights[0]),
+						CreateConsumer(collectedHeights[1]),
+						CreateConsumer(collectedHeights[2])
+					},
+					CreateCollectingInspector(inspectedHeights, inspectedStatuses));
+
+			// - give idle consumers time to exhaust any spinning before elements are pushed
+			test::Sleep(20);
+
+			// Act: push elements one at a time
+			for (auto i = 0u; i < ranges.size(); ++i) {
+				dispatcher.processElement(ConsumerInput(std::move(ranges[i])));
+				WAIT_FOR_VALUE_EXPR(i + 1, inspectedHeights.size());
+			}
+
+			WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+			// Assert:
+			EXPECT_EQ(ranges.size(), dispatcher.numAddedElements());
+			EXPECT_EQ(expectedHeights, collectedHeights[0].get());
+			EXPECT_EQ(expectedHeights, collectedHeights[1].get());
+			EXPECT_EQ(expectedHeights, collectedHeights[2].get());
+			EXPECT_EQ(expectedHeights, inspectedHeights.get());
+			EXPECT_EQ(std::vector<CompletionStatus>(5, CompletionStatus::Normal), inspectedStatuses);
+		}
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithWaitStrategy_Sleep) {
+		AssertCanConsumeAndInspectAllElementsWithWaitStrategy(ConsumerWaitStrategy::Sleep);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithWaitStrategy_Spin) {
+		AssertCanConsumeAndInspectAllElementsWithWaitStrategy(ConsumerWaitStrategy::Spin);
+	}
+
+	TEST(TEST_CLASS, CanConsumeAndInspectAllElementsWithWaitStrategy_SpinThenPark) {
+		AssertCanConsumeAndInspectAllElementsWithWaitStrategy(ConsumerWaitStrategy::Spin_Then_Park);
+	}
+
+	TEST(TEST_CLASS, ShutdownStopsDispatcherWithParkedConsumers) {
+		// Arrange:
+		auto options = Test_Dispatcher_Options;
+		options.WaitStrategy = ConsumerWaitStrategy::Spin_Then_Park;
+		ConsumerDispatcher dispatcher(options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// - give idle consumers time to park
+		test::Sleep(20);
+
+		// Act:
+		dispatcher.shutdown();
+
+		// Assert:
+		EXPECT_FALSE(dispatcher.isRunning());
+	}
+
+	// endregion
+
+	// region element latency
+
+	TEST(TEST_CLASS, ElementLatencyIsUpdatedWhenProcessingIsComplete) {
+		// Arrange:
+		auto ranges = test::PrepareRanges(2);
+		auto sleepingConsumer = [](const auto&) {
+			test::Sleep(5);
+			return ConsumerResult::Continue();
+		};
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { sleepingConsumer });
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert: both elements waited for the consumer at least once
+		EXPECT_LE(5'000u, dispatcher.lastElementLatencyMicros());
+		EXPECT_LE(dispatcher.lastElementLatencyMicros(), dispatcher.maxElementLatencyMicros());
+
+		auto histogramValues = dispatcher.elementLatencyHistogram().values();
+		EXPECT_EQ(2u, histogramValues.count());
+		EXPECT_EQ(dispatcher.maxElementLatencyMicros(), histogramValues.max());
+		EXPECT_LE(5'000u, histogramValues.percentile(50));
+	}
+
+	// endregion
+
+	// region stage timing
+
+	TEST(TEST_CLASS, StageTimingInspectorIsInitiallyEmpty) {
+		// Act:
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { CreateNoOpConsumer(), CreateNoOpConsumer() });
+
+		// Assert:
+		const auto& stageTimingInspector = dispatcher.stageTimingInspector();
+		ASSERT_EQ(2u, stageTimingInspector.numStages());
+		EXPECT_EQ(0u, stageTimingInspector.statistics(0).NumElements);
+		EXPECT_EQ(0u, stageTimingInspector.statistics(1).NumElements);
+	}
+
+	TEST(TEST_CLASS, StageTimingInspectorAggregatesTimesOfStagesThatProcessedElements) {
+		// Arrange: second consumer aborts, so third consumer never processes any element
+		auto ranges = test::PrepareRanges(2);
+		auto sleepingConsumer = [](const auto&) {
+			test::Sleep(5);
+			return ConsumerResult::Continue();
+		};
+		auto abortingConsumer = [](const auto&) {
+			return ConsumerResult::Abort();
+		};
+		ConsumerDispatcher dispatcher(Test_Dispatcher_Options, { sleepingConsumer, abortingConsumer, CreateNoOpConsumer() });
+
+		// Act:
+		ProcessAll(dispatcher, std::move(ranges));
+		WAIT_FOR_ZERO_EXPR(dispatcher.numActiveElements());
+
+		// Assert:
+		const auto& stageTimingInspector = dispatcher.stageTimingInspector();
+		ASSERT_EQ(3u, stageTimingInspector.numStages());
+
+		auto statistics0 = stageTimingInspector.statistics(0);
+		EXPECT_EQ(2u, statistics0.NumElements);
+		EXPECT_LE(10'000u, statistics0.TotalProcessingMicros);
+		EXPECT_EQ(2u, statistics0.ProcessingMicros.count());
+		EXPECT_LE(5'000u, statistics0.ProcessingMicros.percentile(1));
+
+		// - second element waited for the sleeping consumer to process the first element
+		EXPECT_LE(5'000u, statistics0.WaitMicros.max());
+
+		auto statistics1 = stageTimingInspector.statistics(1);
+		EXPECT_EQ(2u, statistics1.NumElements);
+		EXPECT_EQ(2u, statistics1.WaitMicros.count());
+		EXPECT_EQ(2u, statistics1.ProcessingMicros.count());
+
+		auto statistics2 = stageTimingInspector.statistics(2);
+		EXPECT_EQ(0u, statistics2.NumElements);
+		EXPECT_EQ(0u, statistics2.ProcessingMicros.count());
+	}
+
+	// endregion
+
 	// region element marking
 
 	namespace {
@@ -0,0 +1,53 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/ConsumerWaitStrategy.h"
+#include "tests/test/nodeps/ConfigurationTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS ConsumerWaitStrategyTests
+
+	// region parsing
+
+	TEST(TEST_CLASS, CanParseValidStrategyValue) {
+		// Arrange:
+		auto assertSuccessfulParse = [](const auto& input, const auto& expectedParsedValue) {
+			test::AssertParse(input, expectedParsedValue, [](const auto& str, auto& parsedValue) {
+				return TryParseValue(str, parsedValue);
+			});
+		};
+
+		// Assert:
+		assertSuccessfulParse("sleep", ConsumerWaitStrategy::Sleep);
+		assertSuccessfulParse("spin", ConsumerWaitStrategy::Spin);
+		assertSuccessfulParse("spin-then-park", ConsumerWaitStrategy::Spin_Then_Park);
+	}
+
+	TEST(TEST_CLASS, CannotParseInvalidStrategyValue) {
+		test::AssertEnumParseFailure("spin-then-park", ConsumerWaitStrategy::Sleep, [](const auto& str, auto& parsedValue) {
+			return TryParseValue(str, parsedValue);
+		});
+	}
+
+	// endregion
+}}
@@ -81,6 +81,7 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(static_cast<uint64_t>(-1), element.id());
 		EXPECT_FALSE(element.isSkipped());
 		test::AssertContinued(element.completionResult());
+		EXPECT_TRUE(element.stageTimes().empty());
 	}
 
 	ENTITY_TRAITS_BASED_TEST(CanCreateDisruptorElementAroundSingleEntity) {
@@ -165,6 +166,62 @@ namespace catapult { namespace disruptor {
 
 	// endregion
 
+	// region stage times
+
+	TEST(TEST_CLASS, CanCreateDisruptorElementWithStageTimes) {
+		// Arrange:
+		auto startTime = DisruptorClock::now();
+
+		// Act:
+		DisruptorElement element(ConsumerInput(), 21, EmptyProcessingCompleteFunc, 3);
+
+		// Assert:
+		EXPECT_LE(startTime, element.addTime());
+		ASSERT_EQ(3u, element.stageTimes().size());
+		for (const auto& stageTimes : element.stageTimes()) {
+			EXPECT_EQ(DisruptorClock::time_point(), stageTimes.EnterTime);
+			EXPECT_EQ(DisruptorClock::time_point(), stageTimes.ExitTime);
+		}
+	}
+
+	TEST(TEST_CLASS, CanMarkStageEnteredAndExited) {
+		// Arrange:
+		DisruptorElement element(ConsumerInput(), 21, EmptyProcessingCompleteFunc, 3);
+
+		// Act:
+		element.markStageEntered(1);
+		element.markStageExited(1);
+
+		// Assert: only the stage times of the marked stage are set
+		const auto& stageTimes = element.stageTimes();
+		EXPECT_EQ(DisruptorClock::time_point(), stageTimes[0].EnterTime);
+		EXPECT_EQ(DisruptorClock::time_point(), stageTimes[0].ExitTime);
+
+		EXPECT_LE(element.addTime(), stageTimes[1].EnterTime);
+		EXPECT_LE(stageTimes[1].EnterTime, stageTimes[1].ExitTime);
+
+		EXPECT_EQ(DisruptorClock::time_point(), stageTimes[2].EnterTime);
+		EXPECT_EQ(DisruptorClock::time_point(), stageTimes[2].ExitTime);
+	}
+
+	TEST(TEST_CLASS, MarkingUnknownStageHasNoEffect) {
+		// Arrange:
+		DisruptorElement element(ConsumerInput(), 21, EmptyProcessingCompleteFunc, 3);
+
+		// Act:
+		element.markStageEntered(3);
+		element.markStageExited(3);
+
+		// Assert:
+		ASSERT_EQ(3u, element.stageTimes().size());
+		for (const auto& stageTimes : element.stageTimes()) {
+			EXPECT_EQ(DisruptorClock::time_point(), stageTimes.EnterTime);
+			EXPECT_EQ(DisruptorClock::time_point(), stageTimes.ExitTime);
+		}
+	}
+
+	// endregion
+
 	// region IsIntervalElementId
 
 	TEST(TEST_CLASS, IsIntervalElementIdReturnsFalseWhenIntervalIsZero) {
@@ -115,6 +115,17 @@ namespace catapult { namespace disruptor {
 		EXPECT_EQ(16u, disruptor.capacity());
 	}
 
+	TEST(TEST_CLASS, AddCreatesElementWithConfiguredNumberOfStages) {
+		// Arrange:
+		Disruptor disruptor(16, 1, 7);
+
+		// Act:
+		PushBlock(disruptor, test::GenerateEmptyRandomBlock());
+
+		// Assert:
+		EXPECT_EQ(7u, disruptor.elementAt(0).stageTimes().size());
+	}
+
 	namespace {
 		ConsumerResult CreateConsumerResult(uint32_t code, uint8_t resultSeverity) {
 			ConsumerResult result;
@@ -0,0 +1,184 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/disruptor/StageTimingInspector.h"
+#include "tests/test/nodeps/Waits.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace disruptor {
+
+#define TEST_CLASS StageTimingInspectorTests
+
+	namespace {
+		constexpr size_t Num_Stages = 3;
+
+		DisruptorElement CreateElement() {
+			return DisruptorElement(ConsumerInput(), 1, [](auto, auto) {}, Num_Stages);
+		}
+
+		void ProcessStage(DisruptorElement& element, size_t stage, uint32_t waitMillis, uint32_t processingMillis) {
+			test::Sleep(waitMillis);
+			element.markStageEntered(stage);
+			test::Sleep(processingMillis);
+			element.markStageExited(stage);
+		}
+
+		void AssertEmpty(const StageTimingStatistics& statistics) {
+			EXPECT_EQ(0u, statistics.NumElements);
+			EXPECT_EQ(0u, statistics.TotalWaitMicros);
+			EXPECT_EQ(0u, statistics.TotalProcessingMicros);
+			EXPECT_EQ(0u, statistics.WaitMicros.count());
+			EXPECT_EQ(0u, statistics.ProcessingMicros.count());
+		}
+
+		void AssertStatistics(
+				const StageTimingStatistics& statistics,
+				uint64_t expectedNumElements,
+				uint64_t minWaitMicros,
+				uint64_t minProcessingMicros) {
+			EXPECT_EQ(expectedNumElements, statistics.NumElements);
+			EXPECT_LE(minWaitMicros, statistics.TotalWaitMicros);
+			EXPECT_LE(minProcessingMicros, statistics.TotalProcessingMicros);
+			EXPECT_EQ(expectedNumElements, statistics.WaitMicros.count());
+			EXPECT_EQ(expectedNumElements, statistics.ProcessingMicros.count());
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateInspector) {
+		// Act:
+		StageTimingInspector inspector(Num_Stages);
+
+		// Assert:
+		EXPECT_EQ(Num_Stages, inspector.numStages());
+		for (auto i = 0u; i < Num_Stages; ++i)
+			AssertEmpty(inspector.statistics(i));
+	}
+
+	TEST(TEST_CLASS, CannotRetrieveStatisticsForUnknownStage) {
+		// Arrange:
+		StageTimingInspector inspector(Num_Stages);
+
+		// Act + Assert:
+		EXPECT_THROW(inspector.statistics(Num_Stages), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, ElapsedTimeIncreasesOverTime) {
+		// Arrange:
+		StageTimingInspector inspector(Num_Stages);
+
+		// Act:
+		test::Sleep(5);
+
+		// Assert:
+		EXPECT_LE(5'000u, inspector.elapsedMicros());
+	}
+
+	// endregion
+
+	// region inspect
+
+	TEST(TEST_CLASS, InspectAggregatesTimesOfAllProcessingStages) {
+		// Arrange:
+		StageTimingInspector inspector(Num_Stages);
+		auto element = CreateElement();
+		ProcessStage(element, 0, 2, 5);
+		ProcessStage(element, 1, 5, 2);
+		ProcessStage(element, 2, 0, 0);
+
+		// Act:
+		inspector.inspect(element);
+
+		// Assert:
+		AssertStatistics(inspector.statistics(0), 1, 2'000, 5'000);
+		AssertStatistics(inspector.statistics(1), 1, 5'000, 2'000);
+		AssertStatistics(inspector.statistics(2), 1, 0, 0);
+	}
+
+	TEST(TEST_CLASS, InspectIgnoresStagesThatDidNotProcessElement) {
+		// Arrange: skip middle stage
+		StageTimingInspector inspector(Num_Stages);
+		auto element = CreateElement();
+		ProcessStage(element, 0, 0, 2);
+		test::Sleep(5);
+		ProcessStage(element, 2, 0, 0);
+
+		// Act:
+		inspector.inspect(element);
+
+		// Assert: last stage wait is measured from exit of first stage
+		AssertStatistics(inspector.statistics(0), 1, 0, 2'000);
+		AssertEmpty(inspector.statistics(1));
+		AssertStatistics(inspector.statistics(2), 1, 5'000, 0);
+	}
+
+	TEST(TEST_CLASS, InspectIgnoresElementsWithoutStageTimes) {
+		// Arrange:
+		StageTimingInspector inspector(Num_Stages);
+		DisruptorElement element;
+
+		// Act:
+		inspector.inspect(element);
+
+		// Assert:
+		for (auto i = 0u; i < Num_Stages; ++i)
+			AssertEmpty(inspector.statistics(i));
+	}
+
+	TEST(TEST_CLASS, InspectAccumulatesTimesAcrossElements) {
+		// Arrange:
+		StageTimingInspector inspector(Num_Stages);
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i) {
+			auto element = CreateElement();
+			ProcessStage(element, 0, 0, 2);
+			inspector.inspect(element);
+		}
+
+		// Assert:
+		AssertStatistics(inspector.statistics(0), 3, 0, 6'000);
+		AssertEmpty(inspector.statistics(1));
+		AssertEmpty(inspector.statistics(2));
+	}
+
+	// endregion
+
+	// region output
+
+	TEST(TEST_CLASS, CanOutputInspector) {
+		// Arrange:
+		StageTimingInspector inspector(2);
+		auto element = DisruptorElement(ConsumerInput(), 1, [](auto, auto) {}, 2);
+		ProcessStage(element, 0, 0, 0);
+		inspector.inspect(element);
+
+		// Act:
+		auto str = test::ToString(inspector);
+
+		// Assert:
+		EXPECT_NE(std::string::npos, str.find("stage 0: 1 elements"));
+		EXPECT_NE(std::string::npos, str.find("stage 1: 0 elements"));
+	}
+
+	// endregion
+}}
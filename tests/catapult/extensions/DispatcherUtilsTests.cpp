@@ -114,10 +114,17 @@ namespace catapult { namespace extensions {
 			counters[counter.id().name()] = counter.value();
 
 		// Assert:
-		ASSERT_EQ(3u, counters.size());
+		ASSERT_EQ(5u, counters.size());
 		EXPECT_EQ(3u, counters.at("XYZ ELEM TOT"));
 		EXPECT_EQ(2u, counters.at("XYZ ELEM ACT"));
 		EXPECT_EQ(0u, counters.at("XYZ ELEM MEM")); // total size is less than 1MB
+		EXPECT_EQ(pDispatcher->lastElementLatencyMicros(), counters.at("XYZ ELEM LAT"));
+		EXPECT_EQ(pDispatcher->maxElementLatencyMicros(), counters.at("XYZ ELEM LATM"));
+
+		const auto& histogramCounters = locator.histogramCounters();
+		ASSERT_EQ(1u, histogramCounters.size());
+		EXPECT_EQ("XYZ ELEM HIST", histogramCounters[0].id().name());
+		EXPECT_EQ(2u, histogramCounters[0].values().count()); // latency of blocked element is recorded before completion callback
 
 		// Cleanup:
 		isElementCallbackUnblocked.state()->set();
@@ -38,6 +38,7 @@ namespace catapult { namespace extensions {
 		EXPECT_TRUE(!!config.pValidator);
 		EXPECT_TRUE(!!config.pNotificationPublisher);
 		EXPECT_TRUE(!!config.ResolverContextFactory);
+		EXPECT_FALSE(config.EnableAccountPrefetch);
 
 		// - notice that only observers and validators registered in CreateDefaultPluginManagerWithRealPlugins are present
 		std::vector<std::string> expectedObserverNames{
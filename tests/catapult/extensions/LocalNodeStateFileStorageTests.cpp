@@ -20,6 +20,7 @@
 **/
 
 #include "catapult/extensions/LocalNodeStateFileStorage.h"
+#include "catapult/cache/CacheChangesStorage.h"
 #include "catapult/cache/CatapultCache.h"
 #include "catapult/cache/SupplementalData.h"
 #include "catapult/cache_core/AccountStateCache.h"
@@ -29,9 +30,12 @@
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/consumers/BlockChainSyncHandlers.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
+#include "catapult/io/BufferedFileStream.h"
 #include "catapult/io/IndexFile.h"
+#include "catapult/io/PodIoUtils.h"
 #include "catapult/model/Address.h"
 #include "catapult/model/BlockChainConfiguration.h"
+#include "catapult/subscribers/SubscriberOperationTypes.h"
 #include "tests/test/cache/CacheTestUtils.h"
 #include "tests/test/core/AccountStateTestUtils.h"
 #include "tests/test/core/StateTestUtils.h"
@@ -315,6 +319,27 @@ namespace catapult { namespace extensions {
 		RunSaveAndLoadCompleteStateTest(PrepareEmptyDirectory);
 	}
 
+	TEST(TEST_CLASS, CannotLoadCompleteStateWhenAnySubCacheFileIsMissing) {
+		// Arrange: seed and save the cache state with rocks disabled
+		test::TempDirectoryGuard tempDir;
+		auto stateDirectory = config::CatapultDirectory(tempDir.name() + "/zstate");
+		auto blockChainConfig = model::BlockChainConfiguration::Uninitialized();
+		auto originalCache = test::CoreSystemCacheFactory::Create(blockChainConfig);
+		PrepareAndSaveCompleteState(stateDirectory, originalCache);
+
+		// - remove one of the sub cache files
+		std::filesystem::remove(stateDirectory.file("BlockStatisticCache.dat"));
+
+		test::LocalNodeTestState loadedState(
+				blockChainConfig,
+				stateDirectory.str(),
+				test::CoreSystemCacheFactory::Create(blockChainConfig));
+		auto pluginManager = test::CreatePluginManager();
+
+		// Act + Assert: the exception from the worker thread is propagated
+		EXPECT_THROW(LoadStateFromDirectory(stateDirectory, loadedState.ref(), pluginManager), catapult_file_io_error);
+	}
+
 	// endregion
 
 	// region LoadStateFromDirectory / LocalNodeStateSerializer (CatapultCacheDelta)
@@ -424,6 +449,35 @@ namespace catapult { namespace extensions {
 		RunMoveToTest(PrepareDirectoryWithSentinel);
 	}
 
+	TEST(TEST_CLASS, CanMoveTo_IncrementalCheckpointIsMergedIntoDestination) {
+		// Arrange: write an incremental checkpoint in the source directory
+		test::TempDirectoryGuard tempDir;
+		auto stateDirectory = config::CatapultDirectory(tempDir.name() + "/zstate");
+		std::filesystem::create_directories(stateDirectory.path());
+		io::IndexFile(stateDirectory.file("supplemental.dat")).set(123);
+		io::IndexFile(stateDirectory.file("changes_2.dat")).set(234);
+
+		// - write a full snapshot in the destination directory
+		auto stateDirectory2 = config::CatapultDirectory(tempDir.name() + "/zstate2");
+		std::filesystem::create_directories(stateDirectory2.path());
+		io::IndexFile(stateDirectory2.file("supplemental.dat")).set(111);
+		io::IndexFile(stateDirectory2.file("changes_1.dat")).set(222);
+		io::IndexFile(stateDirectory2.file("sentinel")).set(333);
+
+		// Act:
+		LocalNodeStateSerializer serializer(stateDirectory);
+		serializer.moveTo(stateDirectory2);
+
+		// Assert: source files replaced or were added to destination files
+		EXPECT_FALSE(std::filesystem::exists(stateDirectory.path()));
+		EXPECT_EQ(4u, test::CountFilesAndDirectories(stateDirectory2.path()));
+
+		EXPECT_EQ(123u, io::IndexFile(stateDirectory2.file("supplemental.dat")).get());
+		EXPECT_EQ(222u, io::IndexFile(stateDirectory2.file("changes_1.dat")).get());
+		EXPECT_EQ(234u, io::IndexFile(stateDirectory2.file("changes_2.dat")).get());
+		EXPECT_EQ(333u, io::IndexFile(stateDirectory2.file("sentinel")).get());
+	}
+
 	// endregion
 
 	// region SaveStateToDirectoryWithCheckpointing
@@ -521,4 +575,374 @@ namespace catapult { namespace extensions {
 	}
 
 	// endregion
+
+	// region CreateStateChangeJournalOutputStream
+
+	TEST(TEST_CLASS, StateChangeJournalOutputStreamTruncatesJournalOnCreation) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto dataDirectory = config::CatapultDataDirectory(tempDir.name());
+		io::IndexFile(dataDirectory.rootDir().file("state_changes.dat")).set(123);
+
+		// Act:
+		auto pJournal = CreateStateChangeJournalOutputStream(dataDirectory);
+
+		// Assert:
+		EXPECT_EQ(0u, std::filesystem::file_size(dataDirectory.rootDir().file("state_changes.dat")));
+	}
+
+	TEST(TEST_CLASS, StateChangeJournalOutputStreamAppendsDataOnFlush) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto dataDirectory = config::CatapultDataDirectory(tempDir.name());
+		auto journalFilename = dataDirectory.rootDir().file("state_changes.dat");
+		auto pJournal = CreateStateChangeJournalOutputStream(dataDirectory);
+
+		// Act: write and flush twice with a pending write in between
+		io::Write64(*pJournal, 0x0102030405060708);
+		pJournal->flush();
+		auto sizeAfterFirstFlush = std::filesystem::file_size(journalFilename);
+
+		io::Write32(*pJournal, 0x0A0B0C0D);
+		auto sizeBeforeSecondFlush = std::filesystem::file_size(journalFilename);
+		pJournal->flush();
+
+		// Assert:
+		EXPECT_EQ(8u, sizeAfterFirstFlush);
+		EXPECT_EQ(8u, sizeBeforeSecondFlush);
+		ASSERT_EQ(12u, std::filesystem::file_size(journalFilename));
+
+		io::BufferedInputFileStream journalFile(io::RawFile(journalFilename, io::OpenMode::Read_Only));
+		EXPECT_EQ(0x0102030405060708u, io::Read64(journalFile));
+		EXPECT_EQ(0x0A0B0C0Du, io::Read32(journalFile));
+	}
+
+	// endregion
+
+	// region SaveStateToDirectoryWithIncrementalCheckpointing
+
+	namespace {
+		class IncrementalCheckpointingTestContext {
+		public:
+			explicit IncrementalCheckpointingTestContext(bool enableIncrementalStateCheckpoints)
+					: m_dataDirectory(m_tempDir.name())
+					, m_nodeConfig(config::NodeConfiguration::Uninitialized())
+					, m_blockChainConfig(model::BlockChainConfiguration::Uninitialized())
+					, m_cache(test::CoreSystemCacheFactory::Create(m_blockChainConfig))
+					, m_supplementalData(CreateDeterministicSupplementalData()) {
+				m_nodeConfig.EnableCacheDatabaseStorage = false;
+				m_nodeConfig.EnableIncrementalStateCheckpoints = enableIncrementalStateCheckpoints;
+				m_nodeConfig.StateChangeJournalCheckpointSize = utils::FileSize::FromKilobytes(1);
+				RandomSeedCache(m_cache, m_supplementalData.State);
+			}
+
+		public:
+			const config::CatapultDataDirectory& dataDirectory() const {
+				return m_dataDirectory;
+			}
+
+			config::CatapultDirectory stateDirectory() const {
+				return m_dataDirectory.dir("state");
+			}
+
+			std::string journalFilename() const {
+				return m_dataDirectory.rootDir().file("state_changes.dat");
+			}
+
+			uint64_t journalSize() const {
+				return std::filesystem::file_size(journalFilename());
+			}
+
+			uint64_t fullSnapshotSize() const {
+				uint64_t size = 0;
+				for (const auto* filename : { "AccountStateCache.dat", "BlockStatisticCache.dat" })
+					size += std::filesystem::file_size(stateDirectory().file(filename));
+
+				return size;
+			}
+
+		public:
+			void startJournal() {
+				m_pJournal = CreateStateChangeJournalOutputStream(m_dataDirectory);
+			}
+
+			void addAccountAndJournal(Height height) {
+				auto delta = m_cache.createDelta();
+				m_addresses.push_back(test::GenerateRandomByteArray<Address>());
+				delta.sub<cache::AccountStateCache>().addAccount(m_addresses.back(), height);
+
+				io::Write8(*m_pJournal, utils::to_underlying_type(subscribers::StateChangeOperationType::State_Change));
+				io::Write64(*m_pJournal, 1);
+				io::Write(*m_pJournal, height);
+				for (const auto& pStorage : m_cache.changesStorages())
+					pStorage->saveAll(cache::CacheChanges(delta), *m_pJournal);
+
+				m_pJournal->flush();
+				m_cache.commit(height);
+			}
+
+			void save() {
+				constexpr auto SaveState = SaveStateToDirectoryWithIncrementalCheckpointing;
+				SaveState(m_dataDirectory, m_nodeConfig, m_cache, m_supplementalData.ChainScore);
+			}
+
+			bool trySave() {
+				constexpr auto TrySaveState = TrySaveStateToDirectoryWithIncrementalCheckpointing;
+				return TrySaveState(m_dataDirectory, m_nodeConfig, m_cache, m_supplementalData.ChainScore);
+			}
+
+		public:
+			void assertStateFiles(size_t numStateChangesFiles) const {
+				EXPECT_EQ(3 + numStateChangesFiles, test::CountFilesAndDirectories(stateDirectory().path()));
+				for (const auto* filename : { "supplemental.dat", "AccountStateCache.dat", "BlockStatisticCache.dat" })
+					EXPECT_TRUE(std::filesystem::exists(stateDirectory().file(filename))) << filename;
+
+				for (auto i = 1u; i <= numStateChangesFiles; ++i)
+					EXPECT_TRUE(std::filesystem::exists(stateDirectory().file("changes_" + std::to_string(i) + ".dat"))) << i;
+
+				EXPECT_FALSE(std::filesystem::exists(m_dataDirectory.dir("state.tmp").path()));
+				EXPECT_FALSE(std::filesystem::exists(journalFilename()));
+				EXPECT_EQ(consumers::CommitOperationStep::All_Updated, ReadCommitStep(m_dataDirectory));
+			}
+
+			void assertLoadedState(Height expectedHeight) const {
+				test::LocalNodeTestState loadedState(
+						m_blockChainConfig,
+						stateDirectory().str(),
+						test::CoreSystemCacheFactory::Create(m_blockChainConfig));
+				auto pluginManager = test::CreatePluginManager();
+				auto heights = LoadStateFromDirectory(stateDirectory(), loadedState.ref(), pluginManager);
+
+				EXPECT_EQ(expectedHeight, heights.Cache);
+				EXPECT_EQ(m_supplementalData.ChainScore, loadedState.ref().Score.get());
+
+				auto cacheView = loadedState.ref().Cache.createView();
+				test::AssertEqual(m_supplementalData.State, cacheView.dependentState());
+
+				const auto& accountStateCache = cacheView.sub<cache::AccountStateCache>();
+				EXPECT_EQ(Account_Cache_Size + m_addresses.size(), accountStateCache.size());
+				for (const auto& address : m_addresses)
+					EXPECT_TRUE(accountStateCache.contains(address)) << address;
+
+				EXPECT_EQ(Block_Cache_Size, cacheView.sub<cache::BlockStatisticCache>().size());
+			}
+
+		private:
+			test::TempDirectoryGuard m_tempDir;
+			config::CatapultDataDirectory m_dataDirectory;
+			config::NodeConfiguration m_nodeConfig;
+			model::BlockChainConfiguration m_blockChainConfig;
+			cache::CatapultCache m_cache;
+			cache::SupplementalData m_supplementalData;
+			std::unique_ptr<io::OutputStream> m_pJournal;
+			std::vector<Address> m_addresses;
+		};
+	}
+
+	TEST(TEST_CLASS, SaveStateToDirectoryWithIncrementalCheckpointing_SavesFullSnapshotWhenNoStateExists) {
+		// Arrange:
+		IncrementalCheckpointingTestContext context(true);
+		context.startJournal();
+		context.addAccountAndJournal(Height(54322));
+
+		// Act:
+		context.save();
+
+		// Assert: journaled changes are part of the full snapshot
+		context.assertStateFiles(0);
+		context.assertLoadedState(Height(54322));
+	}
+
+	TEST(TEST_CLASS, SaveStateToDirectoryWithIncrementalCheckpointing_SavesFullSnapshotWhenJournalDoesNotExist) {
+		// Arrange:
+		IncrementalCheckpointingTestContext context(true);
+		context.save();
+
+		// Act:
+		context.save();
+
+		// Assert:
+		context.assertStateFiles(0);
+		context.assertLoadedState(Height(54321));
+	}
+
+	TEST(TEST_CLASS, SaveStateToDirectoryWithIncrementalCheckpointing_SavesFullSnapshotWhenIncrementalCheckpointsAreDisabled) {
+		// Arrange:
+		IncrementalCheckpointingTestContext context(false);
+		context.save();
+		context.startJournal();
+		context.addAccountAndJournal(Height(54322));
+
+		// Act:
+		context.save();
+
+		// Assert:
+		context.assertStateFiles(0);
+		context.assertLoadedState(Height(54322));
+	}
+
+	TEST(TEST_CLASS, SaveStateToDirectoryWithIncrementalCheckpointing_SavesIncrementalCheckpointWhenJournalExists) {
+		// Arrange:
+		IncrementalCheckpointingTestContext context(true);
+		context.save();
+		context.startJournal();
+		context.addAccountAndJournal(Height(54322));
+		context.addAccountAndJournal(Height(54323));
+
+		// Act:
+		context.save();
+
+		// Assert:
+		context.assertStateFiles(1);
+		context.assertLoadedState(Height(54323));
+	}
+
+	TEST(TEST_CLASS, SaveStateToDirectoryWithIncrementalCheckpointing_CanSaveMultipleIncrementalCheckpoints) {
+		// Arrange:
+		IncrementalCheckpointingTestContext context(true);
+		context.save();
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i) {
+			context.startJournal();
+			context.addAccountAndJournal(Height(54322 + i));
+			context.save();
+		}
+
+		// Assert:
+		context.assertStateFiles(3);
+		context.assertLoadedState(Height(54324));
+	}
+
+	TEST(TEST_CLASS, SaveStateToDirectoryWithIncrementalCheckpointing_CompactsLongJournalIntoFullSnapshot) {
+		// Arrange: journal more changes than are contained in the full snapshot
+		IncrementalCheckpointingTestContext context(true);
+		context.save();
+		context.startJournal();
+
+		auto height = Height(54322);
+		auto fullSnapshotSize = context.fullSnapshotSize();
+		while (context.journalSize() < fullSnapshotSize) {
+			context.addAccountAndJournal(height);
+			height = height + Height(1);
+		}
+
+		// Act:
+		context.save();
+
+		// Assert: checkpoint is a full snapshot
+		context.assertStateFiles(0);
+		context.assertLoadedState(height - Height(1));
+	}
+
+	TEST(TEST_CLASS, SaveStateToDirectoryWithIncrementalCheckpointing_CompactsIncrementalCheckpointsWhenLargerThanFullSnapshot) {
+		// Arrange: save incremental checkpoints until their combined size exceeds the size of the full snapshot
+		IncrementalCheckpointingTestContext context(true);
+		context.save();
+
+		auto height = Height(54322);
+		auto fullSnapshotSize = context.fullSnapshotSize();
+		uint64_t incrementalCheckpointsSize = 0;
+		size_t numIncrementalCheckpoints = 0;
+		for (;;) {
+			context.startJournal();
+			for (auto i = 0u; i < 10; ++i) {
+				context.addAccountAndJournal(height);
+				height = height + Height(1);
+			}
+
+			if (incrementalCheckpointsSize + context.journalSize() >= fullSnapshotSize)
+				break;
+
+			incrementalCheckpointsSize += context.journalSize();
+			context.save();
+			++numIncrementalCheckpoints;
+		}
+
+		// Sanity:
+		EXPECT_LT(1u, numIncrementalCheckpoints);
+		EXPECT_EQ(numIncrementalCheckpoints + 3, test::CountFilesAndDirectories(context.stateDirectory().path()));
+
+		// Act:
+		context.save();
+
+		// Assert: checkpoint is a full snapshot
+		context.assertStateFiles(0);
+		context.assertLoadedState(height - Height(1));
+	}
+
+	// endregion
+
+	// region TrySaveStateToDirectoryWithIncrementalCheckpointing
+
+	TEST(TEST_CLASS, TrySaveStateToDirectoryWithIncrementalCheckpointing_DoesNotSaveWhenIncrementalCheckpointsAreDisabled) {
+		// Arrange:
+		IncrementalCheckpointingTestContext context(false);
+		context.save();
+		context.startJournal();
+		while (context.journalSize() < utils::FileSize::FromKilobytes(1).bytes())
+			context.addAccountAndJournal(Height(54322));
+
+		// Act:
+		auto result = context.trySave();
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_TRUE(std::filesystem::exists(context.journalFilename()));
+	}
+
+	TEST(TEST_CLASS, TrySaveStateToDirectoryWithIncrementalCheckpointing_DoesNotSaveWhenJournalDoesNotExist) {
+		// Arrange:
+		IncrementalCheckpointingTestContext context(true);
+		context.save();
+
+		// Act:
+		auto result = context.trySave();
+
+		// Assert:
+		EXPECT_FALSE(result);
+		context.assertStateFiles(0);
+	}
+
+	TEST(TEST_CLASS, TrySaveStateToDirectoryWithIncrementalCheckpointing_DoesNotSaveWhenJournalIsSmallerThanCheckpointSize) {
+		// Arrange:
+		IncrementalCheckpointingTestContext context(true);
+		context.save();
+		context.startJournal();
+		context.addAccountAndJournal(Height(54322));
+
+		// Sanity:
+		EXPECT_GT(utils::FileSize::FromKilobytes(1).bytes(), context.journalSize());
+
+		// Act:
+		auto result = context.trySave();
+
+		// Assert:
+		EXPECT_FALSE(result);
+		EXPECT_TRUE(std::filesystem::exists(context.journalFilename()));
+		EXPECT_FALSE(std::filesystem::exists(context.stateDirectory().file("changes_1.dat")));
+	}
+
+	TEST(TEST_CLASS, TrySaveStateToDirectoryWithIncrementalCheckpointing_SavesIncrementalCheckpointWhenJournalReachesCheckpointSize) {
+		// Arrange:
+		IncrementalCheckpointingTestContext context(true);
+		context.save();
+		context.startJournal();
+
+		auto height = Height(54322);
+		while (context.journalSize() < utils::FileSize::FromKilobytes(1).bytes()) {
+			context.addAccountAndJournal(height);
+			height = height + Height(1);
+		}
+
+		// Act:
+		auto result = context.trySave();
+
+		// Assert:
+		EXPECT_TRUE(result);
+		context.assertStateFiles(1);
+		context.assertLoadedState(height - Height(1));
+	}
+
+	// endregion
 }}
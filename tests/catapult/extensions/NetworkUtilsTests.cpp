@@ -21,6 +21,7 @@
 
 #include "catapult/extensions/NetworkUtils.h"
 #include "catapult/extensions/Results.h"
+#include "catapult/ionet/PacketCompression.h"
 #include "catapult/net/ConnectionContainer.h"
 #include "catapult/net/PeerConnectResult.h"
 #include "tests/test/core/PacketTestUtils.h"
@@ -55,6 +56,8 @@ namespace catapult { namespace extensions {
 			config.Node.SocketWorkingBufferSize = utils::FileSize::FromBytes(512);
 			config.Node.SocketWorkingBufferSensitivity = 987;
 			config.Node.MaxPacketDataSize = utils::FileSize::FromKilobytes(12);
+			config.Node.EnablePacketCompression = true;
+			config.Node.PacketCompressionThreshold = utils::FileSize::FromBytes(345);
 			config.Node.ListenInterface = listenInterface;
 
 			config.Node.Local.Roles = ionet::NodeRoles::IPv6;
@@ -134,6 +137,8 @@ namespace catapult { namespace extensions {
 		EXPECT_EQ(987u, settings.SocketWorkingBufferSensitivity);
 		EXPECT_EQ(utils::FileSize::FromKilobytes(12), settings.MaxPacketDataSize);
 		EXPECT_EQ(ionet::IpProtocol::IPv6, settings.OutgoingProtocols);
+		EXPECT_TRUE(settings.EnablePacketCompression);
+		EXPECT_EQ(utils::FileSize::FromBytes(345), settings.PacketCompressionThreshold);
 
 		EXPECT_TRUE(settings.AllowIncomingSelfConnections);
 		EXPECT_FALSE(settings.AllowOutgoingSelfConnections);
@@ -478,4 +483,45 @@ namespace catapult { namespace extensions {
 	}
 
 	// endregion
+
+	// region BootServer - compression
+
+	TEST(TEST_CLASS, BootServer_AcceptedConnectionDecompressesCompressedPackets) {
+		// Arrange: boot the server
+		auto key = test::GenerateRandomByteArray<Key>();
+		BootServerContext context(net::PeerConnectCode::Accepted, key);
+		auto pServer = context.boot(CreateCatapultConfiguration());
+
+		// - prepare a compressed packet
+		auto pPacket = test::CreateRandomPacket(100, ionet::PacketType::Pull_Blocks);
+		auto compressedPayload = ionet::CompressPacketPayload(ionet::PacketPayload(pPacket));
+		const auto& compressedBuffer = compressedPayload.buffers()[0];
+		auto writeBuffer = ionet::ByteBuffer(sizeof(ionet::PacketHeader) + compressedBuffer.Size);
+		std::memcpy(&writeBuffer[0], &compressedPayload.header(), sizeof(ionet::PacketHeader));
+		std::memcpy(&writeBuffer[sizeof(ionet::PacketHeader)], compressedBuffer.pData, compressedBuffer.Size);
+
+		// Act: connect to the server, send the compressed packet and read it
+		auto pClientThreadPool = test::CreateStartedIoThreadPool(1);
+		auto pClientSocket = test::AddClientWriteBuffersTask(pClientThreadPool->ioContext(), { writeBuffer });
+		WAIT_FOR_ONE_EXPR(context.acceptor().numAccepts());
+
+		std::atomic_bool isReadComplete(false);
+		ionet::SocketOperationCode readCode;
+		ionet::ByteBuffer readBuffer;
+		ASSERT_EQ(1u, context.acceptor().socketInfos().size());
+		context.acceptor().socketInfos()[0].socket()->read([&isReadComplete, &readCode, &readBuffer](auto code, const auto* pReadPacket) {
+			readCode = code;
+			if (pReadPacket)
+				readBuffer = test::CopyPacketToBuffer(*pReadPacket);
+
+			isReadComplete = true;
+		});
+		WAIT_FOR(isReadComplete);
+
+		// Assert: the decompressed packet was read
+		EXPECT_EQ(ionet::SocketOperationCode::Success, readCode);
+		EXPECT_EQ(test::CopyPacketToBuffer(*pPacket), readBuffer);
+	}
+
+	// endregion
 }}
@@ -50,6 +50,7 @@ namespace catapult { namespace extensions {
 		// Assert:
 		EXPECT_EQ(&keys, &locator.keys());
 		EXPECT_TRUE(locator.counters().empty());
+		EXPECT_TRUE(locator.histogramCounters().empty());
 		EXPECT_EQ(0u, locator.numServices());
 	}
 
@@ -290,4 +291,72 @@ namespace catapult { namespace extensions {
 	}
 
 	// endregion
+
+	// region histogram counters
+
+	namespace {
+		utils::DiagnosticHistogramValues CreateHistogramValues(uint64_t value) {
+			utils::DiagnosticHistogramValues::BucketCounts bucketCounts{};
+			++bucketCounts[utils::DiagnosticHistogramValues::BucketIndex(value)];
+			return utils::DiagnosticHistogramValues(bucketCounts, value);
+		}
+
+		void RegisterHistogram(ServiceLocator& locator) {
+			locator.registerServiceHistogram<uint64_t>("foo", "ALPHA", [](auto value) { return CreateHistogramValues(value); });
+		}
+	}
+
+	TEST(TEST_CLASS, ServiceHistogramReturnsEmptyValuesWhenServiceIsNotRegistered) {
+		// Arrange:
+		RunLocatorTest([](ServiceLocator& locator) {
+			RegisterHistogram(locator);
+
+			// Act:
+			const auto& histogramCounters = locator.histogramCounters();
+
+			// Assert:
+			ASSERT_EQ(1u, histogramCounters.size());
+			EXPECT_EQ(utils::DiagnosticCounterId("ALPHA").value(), histogramCounters[0].id().value());
+			EXPECT_EQ(0u, histogramCounters[0].values().count());
+			EXPECT_TRUE(locator.counters().empty());
+		});
+	}
+
+	TEST(TEST_CLASS, ServiceHistogramReturnsServiceValuesWhenServiceIsRegisteredAndNotDestroyed) {
+		// Arrange:
+		RunLocatorTest([](ServiceLocator& locator) {
+			auto pService = std::make_shared<uint64_t>(12);
+			locator.registerService("foo", pService);
+			RegisterHistogram(locator);
+
+			// Act:
+			const auto& histogramCounters = locator.histogramCounters();
+
+			// Assert:
+			ASSERT_EQ(1u, histogramCounters.size());
+			EXPECT_EQ(utils::DiagnosticCounterId("ALPHA").value(), histogramCounters[0].id().value());
+			EXPECT_EQ(1u, histogramCounters[0].values().count());
+			EXPECT_EQ(12u, histogramCounters[0].values().max());
+		});
+	}
+
+	TEST(TEST_CLASS, ServiceHistogramReturnsEmptyValuesWhenServiceIsRegisteredAndDestroyed) {
+		// Arrange:
+		RunLocatorTest([](ServiceLocator& locator) {
+			auto pService = std::make_shared<uint64_t>(12);
+			locator.registerService("foo", pService);
+			RegisterHistogram(locator);
+			pService.reset();
+
+			// Act:
+			const auto& histogramCounters = locator.histogramCounters();
+
+			// Assert:
+			ASSERT_EQ(1u, histogramCounters.size());
+			EXPECT_EQ(utils::DiagnosticCounterId("ALPHA").value(), histogramCounters[0].id().value());
+			EXPECT_EQ(0u, histogramCounters[0].values().count());
+		});
+	}
+
+	// endregion
 }}
@@ -25,7 +25,9 @@
 #include "catapult/ionet/NodeInteractionResult.h"
 #include "catapult/ionet/PackedNodeInfo.h"
 #include "catapult/model/DiagnosticCounterValue.h"
+#include "catapult/model/DiagnosticHistogramValue.h"
 #include "catapult/utils/DiagnosticCounter.h"
+#include "catapult/utils/DiagnosticHistogramCounter.h"
 #include "tests/catapult/handlers/test/HeightRequestHandlerTests.h"
 #include "tests/test/core/BlockStatementTestUtils.h"
 #include "tests/test/core/PacketTestUtils.h"
@@ -38,6 +40,7 @@ namespace catapult { namespace handlers {
 
 	namespace {
 		using CountersVector = std::vector<utils::DiagnosticCounter>;
+		using HistogramCountersVector = std::vector<utils::DiagnosticHistogramCounter>;
 
 		void AssertNoResponseWhenPacketIsMalformed(const ionet::ServerPacketHandlers& handlers, ionet::PacketType packetType) {
 			// Arrange: malform the packet
@@ -140,6 +143,96 @@ namespace catapult { namespace handlers {
 
 	// endregion
 
+	// region DiagnosticHistogramsHandler
+
+	TEST(TEST_CLASS, DiagnosticHistogramsHandler_DoesNotRespondToMalformedRequest) {
+		// Arrange:
+		ionet::ServerPacketHandlers handlers;
+		HistogramCountersVector histogramCounters;
+		RegisterDiagnosticHistogramsHandler(handlers, histogramCounters);
+
+		// Act + Assert:
+		AssertNoResponseWhenPacketIsMalformed(handlers, ionet::PacketType::Diagnostic_Histograms);
+	}
+
+	namespace {
+		utils::DiagnosticHistogramCounter CreateHistogramCounter(uint64_t id, uint64_t lowValue, uint64_t highValue) {
+			// 98 low values and 2 high values
+			utils::DiagnosticHistogramValues::BucketCounts bucketCounts{};
+			bucketCounts[utils::DiagnosticHistogramValues::BucketIndex(lowValue)] = 98;
+			bucketCounts[utils::DiagnosticHistogramValues::BucketIndex(highValue)] = 2;
+			auto values = utils::DiagnosticHistogramValues(bucketCounts, highValue);
+			return utils::DiagnosticHistogramCounter(utils::DiagnosticCounterId(id), [values]() { return values; });
+		}
+
+		void AssertHistogramValue(
+				const model::DiagnosticHistogramValue& histogramValue,
+				uint64_t expectedId,
+				uint64_t expectedLowValue,
+				uint64_t expectedHighValue) {
+			EXPECT_EQ(expectedId, histogramValue.Id);
+			EXPECT_EQ(100u, histogramValue.Count);
+			EXPECT_EQ(expectedLowValue, histogramValue.P50);
+			EXPECT_EQ(expectedLowValue, histogramValue.P90);
+			EXPECT_EQ(expectedHighValue, histogramValue.P99);
+			EXPECT_EQ(expectedHighValue, histogramValue.Max);
+		}
+
+		template<typename TAssertHandlerContext>
+		void AssertDiagnosticHistogramsHandlerWritesValuesInResponseToValidRequest(
+				const HistogramCountersVector& histogramCounters,
+				TAssertHandlerContext assertHandlerContext) {
+			// Arrange:
+			ionet::ServerPacketHandlers handlers;
+			RegisterDiagnosticHistogramsHandler(handlers, histogramCounters);
+
+			// - create a valid request
+			auto pPacket = ionet::CreateSharedPacket<ionet::Packet>();
+			pPacket->Type = ionet::PacketType::Diagnostic_Histograms;
+
+			// Act:
+			ionet::ServerPacketHandlerContext handlerContext;
+			EXPECT_TRUE(handlers.process(*pPacket, handlerContext));
+
+			// Assert: header is correct
+			auto expectedPacketSize = sizeof(ionet::PacketHeader) + histogramCounters.size() * sizeof(model::DiagnosticHistogramValue);
+			test::AssertPacketHeader(handlerContext, expectedPacketSize, ionet::PacketType::Diagnostic_Histograms);
+
+			// - histogram values are written
+			assertHandlerContext(handlerContext);
+		}
+	}
+
+	TEST(TEST_CLASS, DiagnosticHistogramsHandler_WritesValuesInResponseToValidRequest_ZeroHistograms) {
+		// Arrange:
+		auto histogramCounters = HistogramCountersVector();
+
+		// Assert:
+		AssertDiagnosticHistogramsHandlerWritesValuesInResponseToValidRequest(histogramCounters, [](const auto& handlerContext) {
+			EXPECT_TRUE(handlerContext.response().buffers().empty());
+		});
+	}
+
+	TEST(TEST_CLASS, DiagnosticHistogramsHandler_WritesValuesInResponseToValidRequest_MultipleHistograms) {
+		// Arrange: use bucket upper bounds as low values so that percentiles are exact
+		auto histogramCounters = HistogramCountersVector{
+			CreateHistogramCounter(123, 7, 1000),
+			CreateHistogramCounter(777, 15, 2000)
+		};
+
+		// Assert:
+		AssertDiagnosticHistogramsHandlerWritesValuesInResponseToValidRequest(histogramCounters, [](const auto& handlerContext) {
+			const auto* pBufferData = test::GetSingleBufferData(handlerContext);
+			const auto* pHistogramValue = reinterpret_cast<const model::DiagnosticHistogramValue*>(pBufferData);
+			AssertHistogramValue(*pHistogramValue, 123, 7, 1000);
+
+			++pHistogramValue;
+			AssertHistogramValue(*pHistogramValue, 777, 15, 2000);
+		});
+	}
+
+	// endregion
+
 	// region DiagnosticNodesHandler
 
 	TEST(TEST_CLASS, DiagnosticNodesHandler_DoesNotRespondToMalformedRequest) {
@@ -44,6 +44,10 @@ namespace catapult { namespace io {
 			void notifyDropBlocksAfter(Height) override {
 				CATAPULT_THROW_RUNTIME_ERROR("notifyDropBlocksAfter - not supported in mock");
 			}
+
+			void flush() override {
+				CATAPULT_THROW_RUNTIME_ERROR("flush - not supported in mock");
+			}
 		};
 
 		// endregion
@@ -169,6 +173,7 @@ namespace catapult { namespace io {
 
 		ASSERT_EQ(1u, context.subscriber().blockElements().size());
 		EXPECT_EQ(pBlockElement.get(), context.subscriber().blockElements()[0]);
+		EXPECT_EQ(1u, context.subscriber().numFlushes());
 	}
 
 	TEST(TEST_CLASS, DropBlocksAfterDelegatesToStorageAndPublisher) {
@@ -194,6 +199,7 @@ namespace catapult { namespace io {
 
 		ASSERT_EQ(1u, context.subscriber().dropBlocksAfterHeights().size());
 		EXPECT_EQ(Height(553), context.subscriber().dropBlocksAfterHeights()[0]);
+		EXPECT_EQ(1u, context.subscriber().numFlushes());
 	}
 
 	// endregion
@@ -300,6 +300,68 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region ReadBlockElementView
+
+	TEST(TEST_CLASS, CanReadBlockElementView) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		auto pBuffer = std::make_shared<std::vector<uint8_t>>(context.Buffer);
+
+		// Act:
+		auto pBlockElement = ReadBlockElementView(*pBuffer, pBuffer);
+
+		// Assert: block data is referenced in place
+		EXPECT_EQ(pBuffer->data(), reinterpret_cast<const uint8_t*>(&pBlockElement->Block));
+		EXPECT_EQ(*context.pBlock, pBlockElement->Block);
+		EXPECT_EQ(context.Hashes[0], pBlockElement->EntityHash);
+		EXPECT_EQ(context.GenerationHash, pBlockElement->GenerationHash);
+
+		ASSERT_EQ(4u, pBlockElement->SubCacheMerkleRoots.size());
+		EXPECT_EQ(std::vector<Hash256>(&context.Hashes[8], &context.Hashes[12]), pBlockElement->SubCacheMerkleRoots);
+		ASSERT_EQ(3u, pBlockElement->Transactions.size());
+		AssertReadTransactions(context, *pBlockElement);
+		EXPECT_FALSE(!!pBlockElement->OptionalStatement);
+	}
+
+	TEST(TEST_CLASS, BlockElementViewExtendsLifetimeOfBufferOwner) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		auto pBuffer = std::make_shared<std::vector<uint8_t>>(context.Buffer);
+
+		// Act:
+		auto pBlockElement = ReadBlockElementView(*pBuffer, pBuffer);
+		std::weak_ptr<std::vector<uint8_t>> pBufferWeak = pBuffer;
+		pBuffer.reset();
+
+		// Assert:
+		EXPECT_FALSE(pBufferWeak.expired());
+		EXPECT_EQ(*context.pBlock, pBlockElement->Block);
+
+		// - buffer is released with block element
+		pBlockElement.reset();
+		EXPECT_TRUE(pBufferWeak.expired());
+	}
+
+	TEST(TEST_CLASS, CannotReadBlockElementViewWithInvalidBlockSize) {
+		// Arrange: make the block size larger than the buffer
+		auto context = PrepareReadTestContext(3, 4);
+		reinterpret_cast<model::Block&>(context.Buffer[0]).Size = static_cast<uint32_t>(context.Buffer.size() + 1);
+
+		// Act + Assert:
+		EXPECT_THROW(ReadBlockElementView(context.Buffer, nullptr), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CannotReadBlockElementViewWithTrailingData) {
+		// Arrange:
+		auto context = PrepareReadTestContext(3, 4);
+		context.Buffer.push_back(42);
+
+		// Act + Assert:
+		EXPECT_THROW(ReadBlockElementView(context.Buffer, nullptr), catapult_runtime_error);
+	}
+
+	// endregion
+
 	// region Roundtrip
 
 	namespace {
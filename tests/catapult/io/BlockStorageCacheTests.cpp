@@ -487,6 +487,232 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region hot blocks cache
+
+	namespace {
+		constexpr auto Hot_Blocks_Max_Memory_Size = utils::FileSize::FromMegabytes(1);
+
+		void AssertStatistics(const BlockStorageCache& cache, uint64_t expectedNumHits, uint64_t expectedNumMisses) {
+			auto statistics = cache.statistics();
+			EXPECT_EQ(expectedNumHits, statistics.NumHotBlockHits);
+			EXPECT_EQ(expectedNumMisses, statistics.NumHotBlockMisses);
+		}
+
+		utils::FileSize GetSingleHotBlockMemorySize() {
+			BlockStorageCache cache(mocks::CreateMemoryBlockStorage(5), mocks::CreateMemoryBlockStorage(0), Hot_Blocks_Max_Memory_Size);
+			cache.view().loadBlockElement(Height(3));
+			return cache.statistics().HotBlocksMemorySize;
+		}
+	}
+
+	TEST(TEST_CLASS, HotBlocksCacheIsDisabledByDefault) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0));
+
+		// Act:
+		for (auto i = 0u; i < 3; ++i) {
+			cache.view().loadBlock(Height(5));
+			cache.view().loadBlockElement(Height(5));
+			cache.view().loadBlockStatementData(Height(5));
+		}
+
+		// Assert:
+		AssertStatistics(cache, 0, 0);
+		EXPECT_EQ(utils::FileSize(), cache.statistics().HotBlocksMemorySize);
+	}
+
+	TEST(TEST_CLASS, LoadBlockElementPopulatesHotBlocksCache) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), Hot_Blocks_Max_Memory_Size);
+
+		// Act:
+		auto pBlockElement1 = cache.view().loadBlockElement(Height(5));
+		auto pBlockElement2 = cache.view().loadBlockElement(Height(5));
+
+		// Assert:
+		test::AssertEqual(*pStorageRaw->loadBlockElement(Height(5)), *pBlockElement1);
+		EXPECT_EQ(pBlockElement1, pBlockElement2);
+		AssertStatistics(cache, 1, 1);
+		EXPECT_LT(utils::FileSize(), cache.statistics().HotBlocksMemorySize);
+	}
+
+	TEST(TEST_CLASS, HotBlocksCacheStoresCopiesOfStorageBlockElements) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), Hot_Blocks_Max_Memory_Size);
+
+		// Act:
+		auto pBlockElement = cache.view().loadBlockElement(Height(5));
+
+		// Assert: block data is owned by the cache and transaction elements reference the copied block
+		auto pStorageBlockElement = pStorageRaw->loadBlockElement(Height(5));
+		test::AssertEqual(*pStorageBlockElement, *pBlockElement);
+		EXPECT_NE(&pStorageBlockElement->Block, &pBlockElement->Block);
+
+		const auto* pBlockStart = reinterpret_cast<const uint8_t*>(&pBlockElement->Block);
+		for (const auto& transactionElement : pBlockElement->Transactions) {
+			const auto* pTransaction = reinterpret_cast<const uint8_t*>(&transactionElement.Transaction);
+			EXPECT_LT(pBlockStart, pTransaction);
+			EXPECT_GT(pBlockStart + pBlockElement->Block.Size, pTransaction);
+		}
+	}
+
+	TEST(TEST_CLASS, LoadBlockUsesHotBlocksCache) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), Hot_Blocks_Max_Memory_Size);
+
+		// Act:
+		auto pBlock = cache.view().loadBlock(Height(5));
+		auto pBlockElement = cache.view().loadBlockElement(Height(5));
+
+		// Assert:
+		EXPECT_EQ(*pStorageRaw->loadBlock(Height(5)), *pBlock);
+		EXPECT_EQ(&pBlockElement->Block, pBlock.get());
+		AssertStatistics(cache, 1, 1);
+	}
+
+	TEST(TEST_CLASS, LoadBlockStatementDataUsesHotBlocksCache) {
+		// Arrange:
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		auto pStorageRaw = pStorage.get();
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), Hot_Blocks_Max_Memory_Size);
+
+		// Act:
+		auto blockStatementData1 = cache.view().loadBlockStatementData(Height(5));
+		auto blockStatementData2 = cache.view().loadBlockStatementData(Height(5));
+
+		// Assert:
+		auto expectedBlockStatementData = pStorageRaw->loadBlockStatementData(Height(5));
+		EXPECT_EQ(expectedBlockStatementData, blockStatementData1);
+		EXPECT_EQ(expectedBlockStatementData, blockStatementData2);
+		AssertStatistics(cache, 1, 1);
+	}
+
+	TEST(TEST_CLASS, HotBlocksCacheEvictsLeastRecentlyUsedBlocksWhenFull) {
+		// Arrange: allow two blocks to be cached
+		auto singleHotBlockMemorySize = GetSingleHotBlockMemorySize();
+		auto maxMemorySize = utils::FileSize::FromBytes(2 * singleHotBlockMemorySize.bytes());
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0), maxMemorySize);
+
+		cache.view().loadBlockElement(Height(3));
+		cache.view().loadBlockElement(Height(4));
+		cache.view().loadBlockElement(Height(3));
+
+		// Act: loading a third block should evict the least recently used block (4)
+		cache.view().loadBlockElement(Height(5));
+
+		// Assert:
+		AssertStatistics(cache, 1, 3);
+		EXPECT_EQ(maxMemorySize, cache.statistics().HotBlocksMemorySize);
+
+		cache.view().loadBlockElement(Height(3));
+		cache.view().loadBlockElement(Height(5));
+		AssertStatistics(cache, 3, 3);
+
+		cache.view().loadBlockElement(Height(4));
+		AssertStatistics(cache, 3, 4);
+	}
+
+	TEST(TEST_CLASS, HotBlocksCacheDoesNotCacheBlocksLargerThanMaxMemorySize) {
+		// Arrange:
+		auto maxMemorySize = utils::FileSize::FromBytes(GetSingleHotBlockMemorySize().bytes() - 1);
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0), maxMemorySize);
+
+		// Act:
+		cache.view().loadBlockElement(Height(5));
+		cache.view().loadBlockElement(Height(5));
+
+		// Assert:
+		AssertStatistics(cache, 0, 2);
+		EXPECT_EQ(utils::FileSize(), cache.statistics().HotBlocksMemorySize);
+	}
+
+	TEST(TEST_CLASS, HotBlocksCacheChargesMemoryForEmptyBlockStatementData) {
+		// Arrange: memory storage does not have any statements
+		auto pStorage = mocks::CreateMemoryBlockStorage(Delegation_Chain_Size);
+		BlockStorageCache cache(std::move(pStorage), mocks::CreateMemoryBlockStorage(0), Hot_Blocks_Max_Memory_Size);
+
+		// Act:
+		auto blockStatementData = cache.view().loadBlockStatementData(Height(5));
+
+		// Sanity:
+		EXPECT_FALSE(blockStatementData.second);
+
+		// Assert:
+		EXPECT_LT(utils::FileSize(), cache.statistics().HotBlocksMemorySize);
+	}
+
+	TEST(TEST_CLASS, HotBlocksCacheBoundsNumberOfEmptyBlockStatementDataEntries) {
+		// Arrange: determine memory size of a single empty entry
+		auto singleEntryMemorySize = [] {
+			BlockStorageCache cache(mocks::CreateMemoryBlockStorage(5), mocks::CreateMemoryBlockStorage(0), Hot_Blocks_Max_Memory_Size);
+			cache.view().loadBlockStatementData(Height(3));
+			return cache.statistics().HotBlocksMemorySize;
+		}();
+
+		// - allow three entries to be cached
+		auto maxMemorySize = utils::FileSize::FromBytes(3 * singleEntryMemorySize.bytes());
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(Delegation_Chain_Size), mocks::CreateMemoryBlockStorage(0), maxMemorySize);
+
+		// Act:
+		for (auto i = 1u; i <= Delegation_Chain_Size; ++i)
+			cache.view().loadBlockStatementData(Height(i));
+
+		// Assert:
+		EXPECT_EQ(maxMemorySize, cache.statistics().HotBlocksMemorySize);
+	}
+
+	TEST(TEST_CLASS, CommitRemovesDroppedBlocksFromHotBlocksCache) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0), Hot_Blocks_Max_Memory_Size);
+		cache.view().loadBlockElement(Height(8));
+		cache.view().loadBlockElement(Height(9));
+
+		// Act:
+		auto pNewBlock9 = test::GenerateBlockWithTransactions(5, Height(9));
+		auto pNewBlock10 = test::GenerateBlockWithTransactions(5, Height(10));
+		auto newBlockElement9 = test::CreateBlockElementForSaveTests(*pNewBlock9);
+		auto newBlockElement10 = test::CreateBlockElementForSaveTests(*pNewBlock10);
+		{
+			auto modifier = cache.modifier();
+			modifier.dropBlocksAfter(Height(8));
+			modifier.saveBlocks({ newBlockElement9, newBlockElement10 });
+			modifier.commit();
+		}
+
+		// Assert: block 8 is still cached but block 9 is reloaded from storage
+		EXPECT_EQ(Height(10), cache.view().chainHeight());
+		cache.view().loadBlockElement(Height(8));
+		test::AssertEqual(newBlockElement9, *cache.view().loadBlockElement(Height(9)));
+		AssertStatistics(cache, 1, 3);
+	}
+
+	TEST(TEST_CLASS, CommitAddsNewChainTipToHotBlocksCache) {
+		// Arrange:
+		BlockStorageCache cache(mocks::CreateMemoryBlockStorage(12), mocks::CreateMemoryBlockStorage(0), Hot_Blocks_Max_Memory_Size);
+
+		// Act: save two blocks so that the first one is no longer the chain tip
+		for (auto height : { Height(13), Height(14) }) {
+			auto pBlock = test::GenerateBlockWithTransactions(5, height);
+			auto modifier = cache.modifier();
+			modifier.saveBlock(test::CreateBlockElementForSaveTests(*pBlock));
+			modifier.commit();
+		}
+
+		auto pBlockElement = cache.view().loadBlockElement(Height(13));
+
+		// Assert:
+		EXPECT_EQ(Height(13), pBlockElement->Block.Height);
+		AssertStatistics(cache, 1, 0);
+	}
+
+	// endregion
+
 	// region synchronization
 
 	namespace {
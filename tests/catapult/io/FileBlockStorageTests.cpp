@@ -192,4 +192,110 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region memory mapping
+
+	namespace {
+		std::unique_ptr<FileBlockStorage> CreateMemoryMappedStorage(const std::string& destination) {
+			return std::make_unique<FileBlockStorage>(destination, test::File_Database_Batch_Size, FileBlockStorageMode::Hash_Index, true);
+		}
+	}
+
+	TEST(TEST_CLASS, CanLoadBlocksFromMemoryMappedFiles) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock1 = test::GenerateBlockWithTransactions(5, Height(2));
+		auto pBlock2 = test::GenerateBlockWithTransactions(5, Height(3));
+		auto element1 = test::BlockToBlockElement(*pBlock1, test::GenerateRandomByteArray<Hash256>());
+		auto element2 = test::BlockToBlockElement(*pBlock2, test::GenerateRandomByteArray<Hash256>());
+		{
+			auto pStorage = FileTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element1);
+			pStorage->saveBlock(element2);
+		}
+
+		// Act:
+		auto pStorage = CreateMemoryMappedStorage(tempDir.name());
+		auto pBlock = pStorage->loadBlock(Height(2));
+		auto pBlockElement1 = pStorage->loadBlockElement(Height(2));
+		auto pBlockElement2 = pStorage->loadBlockElement(Height(3));
+
+		// Assert:
+		EXPECT_EQ(*pBlock1, *pBlock);
+		test::AssertEqual(element1, *pBlockElement1);
+		test::AssertEqual(element2, *pBlockElement2);
+
+		// - block and block element reference the same mapped data
+		EXPECT_EQ(pBlock.get(), &pBlockElement1->Block);
+	}
+
+	TEST(TEST_CLASS, CanLoadNewlySavedBlockFromMemoryMappedFiles) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileTraits::PrepareStorage(tempDir.name());
+		auto pStorage = CreateMemoryMappedStorage(tempDir.name());
+		auto pBlock1 = test::GenerateBlockWithTransactions(5, Height(2));
+		auto element1 = test::BlockToBlockElement(*pBlock1, test::GenerateRandomByteArray<Hash256>());
+		pStorage->saveBlock(element1);
+
+		// - load a block to map the file
+		auto pBlockElement1 = pStorage->loadBlockElement(Height(2));
+
+		// Act: save a block to the same file and load it
+		auto pBlock2 = test::GenerateBlockWithTransactions(5, Height(3));
+		auto element2 = test::BlockToBlockElement(*pBlock2, test::GenerateRandomByteArray<Hash256>());
+		pStorage->saveBlock(element2);
+		auto pBlockElement2 = pStorage->loadBlockElement(Height(3));
+
+		// Assert:
+		test::AssertEqual(element1, *pBlockElement1);
+		test::AssertEqual(element2, *pBlockElement2);
+	}
+
+	TEST(TEST_CLASS, MemoryMappedBlockElementIsUnchangedWhenBlockIsOverwritten) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileTraits::PrepareStorage(tempDir.name());
+		auto pStorage = CreateMemoryMappedStorage(tempDir.name());
+		auto pBlock1 = test::GenerateBlockWithTransactions(5, Height(2));
+		auto element1 = test::BlockToBlockElement(*pBlock1, test::GenerateRandomByteArray<Hash256>());
+		pStorage->saveBlock(element1);
+		auto pBlockElement1 = pStorage->loadBlockElement(Height(2));
+
+		// Act: overwrite the block, which truncates the mapped file
+		pStorage->dropBlocksAfter(Height(1));
+		auto pBlock2 = test::GenerateBlockWithTransactions(3, Height(2));
+		auto element2 = test::BlockToBlockElement(*pBlock2, test::GenerateRandomByteArray<Hash256>());
+		pStorage->saveBlock(element2);
+		auto pBlockElement2 = pStorage->loadBlockElement(Height(2));
+
+		// Assert:
+		test::AssertEqual(element1, *pBlockElement1);
+		test::AssertEqual(element2, *pBlockElement2);
+	}
+
+	TEST(TEST_CLASS, CannotReadMemoryMappedBlockElementWithTrailingData) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto pBlock = test::GenerateBlockWithTransactions(5, Height(2));
+		auto element = test::BlockToBlockElement(*pBlock, test::GenerateRandomByteArray<Hash256>());
+		{
+			auto pStorage = FileTraits::PrepareStorage(tempDir.name());
+			pStorage->saveBlock(element);
+		}
+
+		// - append some data
+		{
+			io::RawFile file(tempDir.name() + "/00000/00000.dat", io::OpenMode::Read_Append);
+			file.seek(file.size());
+			std::vector<uint8_t> buffer{ 42 };
+			file.write(buffer);
+		}
+
+		// Act + Assert:
+		auto pStorage = CreateMemoryMappedStorage(tempDir.name());
+		EXPECT_THROW(pStorage->loadBlockElement(Height(2)), catapult_runtime_error);
+	}
+
+	// endregion
 }}
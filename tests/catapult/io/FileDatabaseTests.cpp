@@ -35,8 +35,8 @@ namespace catapult { namespace io {
 
 		class TestContext {
 		public:
-			explicit TestContext(size_t batchSize = Batch_Size)
-					: m_database(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin" })
+			explicit TestContext(size_t batchSize = Batch_Size, bool enableMemoryMapping = false)
+					: m_database(config::CatapultDirectory(m_tempDir.name()), { batchSize, ".bin", enableMemoryMapping })
 			{}
 
 		public:
@@ -679,4 +679,144 @@ namespace catapult { namespace io {
 	}
 
 	// endregion
+
+	// region payload view
+
+	namespace {
+		std::vector<uint8_t> ToVector(const RawBuffer& buffer) {
+			return std::vector<uint8_t>(buffer.pData, buffer.pData + buffer.Size);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotGetPayloadViewWhenMemoryMappingIsDisabled) {
+		// Arrange:
+		TestContext context;
+		WriteAll(context.database(), 10, CreatePayloads({ 50 }));
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().payloadView(10), catapult_runtime_error);
+	}
+
+	TEST(TEST_CLASS, CannotGetPayloadViewWhenFileDoesNotExist) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().payloadView(10), catapult_file_io_error);
+	}
+
+	READ_TEST(CanGetPayloadViewInFile) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30, 20, 15 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payloadView = context.database().payloadView(10 + Payload_Index);
+
+		// Assert:
+		EXPECT_TRUE(!!payloadView.pMappedFile);
+		EXPECT_EQ(payloads[Payload_Index], ToVector(payloadView.Payload));
+	}
+
+	TEST(TEST_CLASS, CanGetPayloadViewOfLastPayloadInPartiallyFullFile) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payloadView = context.database().payloadView(12);
+
+		// Assert:
+		EXPECT_EQ(payloads[2], ToVector(payloadView.Payload));
+	}
+
+	TEST(TEST_CLASS, CannotGetPayloadViewOfUnwrittenPayloadInPartiallyFullFile) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+		WriteAll(context.database(), 10, CreatePayloads({ 50, 10, 30 }));
+
+		// Act + Assert:
+		EXPECT_THROW(context.database().payloadView(13), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanGetPayloadViewInHeaderlessMode) {
+		// Arrange:
+		TestContext context(1, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, payloads);
+
+		// Act:
+		auto payloadView1 = context.database().payloadView(10);
+		auto payloadView2 = context.database().payloadView(12);
+
+		// Assert:
+		EXPECT_EQ(payloads[0], ToVector(payloadView1.Payload));
+		EXPECT_EQ(payloads[2], ToVector(payloadView2.Payload));
+	}
+
+	TEST(TEST_CLASS, PayloadViewsInSameFileShareMapping) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+		WriteAll(context.database(), 10, CreatePayloads({ 50, 10, 30 }));
+
+		// Act:
+		auto payloadView1 = context.database().payloadView(10);
+		auto payloadView2 = context.database().payloadView(12);
+
+		// Assert:
+		EXPECT_EQ(payloadView1.pMappedFile, payloadView2.pMappedFile);
+	}
+
+	TEST(TEST_CLASS, CanGetPayloadViewOfPayloadWrittenAfterPreviousView) {
+		// Arrange:
+		TestContext context(Batch_Size, true);
+
+		auto payloads = CreatePayloads({ 50, 10, 30 });
+		WriteAll(context.database(), 10, { payloads[0], payloads[1] });
+		auto payloadView1 = context.database().payloadView(11);
+
+		// Act: append a payload to the mapped file
+		WriteAll(context.database(), 12, { payloads[2] });
+		auto payloadView2 = context.database().payloadView(12);
+
+		// Assert:
+		EXPECT_EQ(payloads[1], ToVector(payloadView1.Payload));
+		EXPECT_EQ(payloads[2], ToVector(payloadView2.Payload));
+	}
+
+	namespace {
+		void AssertPayloadViewIsUnchangedByRewrite(size_t batchSize) {
+			// Arrange:
+			TestContext context(batchSize, true);
+
+			auto payloads = CreatePayloads({ 50, 10, 30 });
+			WriteAll(context.database(), 10, payloads);
+			auto payloadView = context.database().payloadView(12);
+
+			// Act: rewrite the payload, which truncates the file
+			auto newPayload = test::GenerateRandomVector(20);
+			WriteAll(context.database(), 12, { newPayload });
+			auto newPayloadView = context.database().payloadView(12);
+
+			// Assert: the outstanding view still references the original data
+			EXPECT_EQ(payloads[2], ToVector(payloadView.Payload));
+			EXPECT_EQ(newPayload, ToVector(newPayloadView.Payload));
+			EXPECT_NE(payloadView.pMappedFile, newPayloadView.pMappedFile);
+		}
+	}
+
+	TEST(TEST_CLASS, PayloadViewIsUnchangedByRewrite) {
+		AssertPayloadViewIsUnchangedByRewrite(Batch_Size);
+	}
+
+	TEST(TEST_CLASS, PayloadViewIsUnchangedByRewriteInHeaderlessMode) {
+		AssertPayloadViewIsUnchangedByRewrite(1);
+	}
+
+	// endregion
 }}
@@ -624,6 +624,10 @@ namespace catapult { namespace io {
 			return m_writeBuffer1;
 		}
 
+		const auto& writeBuffer2() const {
+			return m_writeBuffer2;
+		}
+
 	private:
 		void setup() {
 			// Arrange:
@@ -649,6 +653,11 @@ namespace catapult { namespace io {
 			EXPECT_EQ(m_writeBuffer2, m_context.readAll(Message2_Filename));
 		}
 
+		void assertAllFilesConsumed() {
+			EXPECT_EQ(2u, m_context.countFiles());
+			AssertIndexFiles(m_context, 120, 120);
+		}
+
 		void assertSingleFileConsumed() {
 			EXPECT_EQ(3u, m_context.countFiles());
 			AssertIndexFiles(m_context, 120, 119);
@@ -770,6 +779,107 @@ namespace catapult { namespace io {
 
 	// endregion
 
+	// region FileQueueReader - peek
+
+	namespace {
+		template<typename TTraits>
+		void AssertCannotPeekWithIndexValues(uint64_t indexWriterValue, uint64_t indexReaderValue) {
+			// Arrange:
+			ReaderTestContext<TTraits> context;
+			context.setIndexes(indexWriterValue, indexReaderValue);
+
+			// Act:
+			auto messages = context.reader().peekNextMessages(5);
+
+			// Assert:
+			EXPECT_TRUE(messages.empty());
+
+			EXPECT_EQ(2u, context.countFiles());
+			AssertIndexFiles(context, indexWriterValue, indexReaderValue);
+		}
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotPeekWhenWriterIndexDoesNotExist) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(121, 120);
+		std::filesystem::remove(context.directory() / TTraits::Index_Writer_Filename);
+
+		// Act:
+		auto messages = context.reader().peekNextMessages(5);
+
+		// Assert:
+		EXPECT_TRUE(messages.empty());
+
+		EXPECT_EQ(1u, context.countFiles());
+		EXPECT_EQ(120u, context.readIndexReaderFile());
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotPeekWhenReaderIndexIsGreaterThanWriterIndex) {
+		AssertCannotPeekWithIndexValues<TTraits>(120, 121);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotPeekWhenReaderIndexIsEqualToWriterIndex) {
+		AssertCannotPeekWithIndexValues<TTraits>(120, 120);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CannotPeekWhenMessageAtReaderIndexDoesNotExist) {
+		// Arrange:
+		ReaderTestContext<TTraits> context;
+		context.setIndexes(120, 118);
+
+		// Act + Assert:
+		EXPECT_THROW(context.reader().peekNextMessages(5), catapult_runtime_error);
+
+		EXPECT_EQ(2u, context.countFiles());
+		AssertIndexFiles(context, 120, 118);
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanPeekAtMostMaxMessages) {
+		// Arrange:
+		TwoFileReaderTestContext<TTraits> context;
+
+		// Act:
+		auto messages = context.reader().peekNextMessages(1);
+
+		// Assert:
+		ASSERT_EQ(1u, messages.size());
+		EXPECT_EQ(context.writeBuffer1(), messages[0]);
+
+		// - peeked data file should NOT have been deleted
+		context.assertZeroFilesConsumed();
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanPeekAllPendingMessages) {
+		// Arrange:
+		TwoFileReaderTestContext<TTraits> context;
+
+		// Act:
+		auto messages = context.reader().peekNextMessages(5);
+
+		// Assert:
+		ASSERT_EQ(2u, messages.size());
+		EXPECT_EQ(context.writeBuffer1(), messages[0]);
+		EXPECT_EQ(context.writeBuffer2(), messages[1]);
+
+		// - peeked data files should NOT have been deleted
+		context.assertZeroFilesConsumed();
+	}
+
+	DIRECTORY_TRAITS_BASED_TEST(CanConsumePeekedMessagesWithSkip) {
+		// Arrange:
+		TwoFileReaderTestContext<TTraits> context;
+		auto messages = context.reader().peekNextMessages(5);
+
+		// Act:
+		context.reader().skip(static_cast<uint32_t>(messages.size()));
+
+		// Assert:
+		context.assertAllFilesConsumed();
+	}
+
+	// endregion
+
 	// region FileQueueReader - skip
 
 	namespace {
@@ -0,0 +1,204 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/FileQueueWatcher.h"
+#include "catapult/io/FileQueue.h"
+#include "catapult/io/IndexFile.h"
+#include "catapult/utils/StackTimer.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <filesystem>
+#include <thread>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS FileQueueWatcherTests
+
+	namespace {
+		constexpr auto Short_Timeout = utils::TimeSpan::FromMilliseconds(20);
+		constexpr auto Long_Timeout = utils::TimeSpan::FromSeconds(5);
+
+		void WriteMessage(const std::string& directory) {
+			FileQueueWriter writer(directory);
+			writer.write(test::GenerateRandomVector(12));
+			writer.flush();
+		}
+
+		void AssertWaitTimesOut(FileQueueWatcher& watcher) {
+			// Act:
+			utils::StackTimer stopwatch;
+			auto result = watcher.wait(Short_Timeout);
+			auto elapsedMillis = stopwatch.millis();
+
+			// Assert:
+			EXPECT_FALSE(result);
+			EXPECT_LE(Short_Timeout.millis(), elapsedMillis);
+		}
+	}
+
+	// region constructor
+
+	TEST(TEST_CLASS, CanCreateWatcherAroundNewDirectory) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		auto directory = std::filesystem::path(tempDir.name()) / "queue";
+
+		// Act:
+		FileQueueWatcher watcher(directory.generic_string(), "index.dat");
+
+		// Assert:
+		EXPECT_TRUE(std::filesystem::is_directory(directory));
+	}
+
+	// endregion
+
+	// region wait + notify
+
+	TEST(TEST_CLASS, WaitTimesOutWhenThereAreNoUpdates) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), "index.dat");
+
+		// Act + Assert:
+		AssertWaitTimesOut(watcher);
+	}
+
+	TEST(TEST_CLASS, WaitDetectsNotificationRaisedBeforeWait) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), "index.dat");
+
+		// Act:
+		watcher.notify();
+		auto result = watcher.wait(Long_Timeout);
+
+		// Assert:
+		EXPECT_TRUE(result);
+	}
+
+	TEST(TEST_CLASS, WaitDetectsNotificationRaisedDuringWait) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), "index.dat");
+
+		// Act:
+		std::thread notifyThread([&watcher]() {
+			test::Sleep(10);
+			watcher.notify();
+		});
+		auto result = watcher.wait(Long_Timeout);
+		notifyThread.join();
+
+		// Assert:
+		EXPECT_TRUE(result);
+	}
+
+	TEST(TEST_CLASS, NotificationIsOnlyReportedOnce) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), "index.dat");
+		watcher.notify();
+		watcher.wait(Long_Timeout);
+
+		// Act + Assert:
+		AssertWaitTimesOut(watcher);
+	}
+
+	// endregion
+
+#ifdef __linux__
+
+	// region wait - file changes
+
+	TEST(TEST_CLASS, WaitDetectsIndexUpdateBeforeWait) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), "index.dat");
+
+		// Act:
+		WriteMessage(tempDir.name());
+		auto result = watcher.wait(Long_Timeout);
+
+		// Assert:
+		EXPECT_TRUE(result);
+	}
+
+	TEST(TEST_CLASS, WaitDetectsIndexUpdateDuringWait) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), "index.dat");
+
+		// Act:
+		std::thread writerThread([directory = tempDir.name()]() {
+			test::Sleep(10);
+			WriteMessage(directory);
+		});
+		auto result = watcher.wait(Long_Timeout);
+		writerThread.join();
+
+		// Assert:
+		EXPECT_TRUE(result);
+	}
+
+	TEST(TEST_CLASS, WaitDetectsIndexUpdateOfCustomIndexFile) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), "alpha.zzz");
+
+		// Act:
+		IndexFile((std::filesystem::path(tempDir.name()) / "alpha.zzz").generic_string()).set(123);
+		auto result = watcher.wait(Long_Timeout);
+
+		// Assert:
+		EXPECT_TRUE(result);
+	}
+
+	TEST(TEST_CLASS, IndexUpdatesAreOnlyReportedOnce) {
+		// Arrange: write multiple messages
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), "index.dat");
+		for (auto i = 0u; i < 3; ++i)
+			WriteMessage(tempDir.name());
+
+		watcher.wait(Long_Timeout);
+
+		// Act + Assert:
+		AssertWaitTimesOut(watcher);
+	}
+
+	TEST(TEST_CLASS, WaitIgnoresUpdatesOfOtherFiles) {
+		// Arrange:
+		test::TempDirectoryGuard tempDir;
+		FileQueueWatcher watcher(tempDir.name(), "index.dat");
+
+		// - update reader index file and write a message file without updating the writer index file
+		IndexFile((std::filesystem::path(tempDir.name()) / "index_reader.dat").generic_string()).set(123);
+		FileQueueWriter writer(tempDir.name(), "alpha.zzz");
+		writer.write(test::GenerateRandomVector(12));
+
+		// Act + Assert:
+		AssertWaitTimesOut(watcher);
+	}
+
+	// endregion
+
+#endif
+}}
@@ -0,0 +1,89 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/io/MemoryMappedFile.h"
+#include "catapult/io/RawFile.h"
+#include "tests/test/nodeps/Filesystem.h"
+#include "tests/TestHarness.h"
+#include <filesystem>
+
+namespace catapult { namespace io {
+
+#define TEST_CLASS MemoryMappedFileTests
+
+	namespace {
+		void WriteFile(const std::string& filename, const std::vector<uint8_t>& buffer) {
+			RawFile file(filename, OpenMode::Read_Write);
+			file.write(buffer);
+		}
+	}
+
+	TEST(TEST_CLASS, CannotMapNonexistentFile) {
+		// Arrange:
+		test::TempFileGuard tempFile("test.dat");
+
+		// Act + Assert:
+		EXPECT_THROW(MemoryMappedFile(tempFile.name()), catapult_file_io_error);
+	}
+
+	TEST(TEST_CLASS, CanMapEmptyFile) {
+		// Arrange:
+		test::TempFileGuard tempFile("test.dat");
+		WriteFile(tempFile.name(), {});
+
+		// Act:
+		MemoryMappedFile mappedFile(tempFile.name());
+
+		// Assert:
+		EXPECT_EQ(0u, mappedFile.size());
+		EXPECT_FALSE(!!mappedFile.data());
+	}
+
+	TEST(TEST_CLASS, CanMapFile) {
+		// Arrange:
+		test::TempFileGuard tempFile("test.dat");
+		auto buffer = test::GenerateRandomVector(1234);
+		WriteFile(tempFile.name(), buffer);
+
+		// Act:
+		MemoryMappedFile mappedFile(tempFile.name());
+
+		// Assert:
+		ASSERT_EQ(buffer.size(), mappedFile.size());
+		EXPECT_EQ_MEMORY(buffer.data(), mappedFile.data(), buffer.size());
+	}
+
+	TEST(TEST_CLASS, MappingIsUnchangedWhenFileIsReplaced) {
+		// Arrange:
+		test::TempFileGuard tempFile("test.dat");
+		auto buffer = test::GenerateRandomVector(1234);
+		WriteFile(tempFile.name(), buffer);
+		MemoryMappedFile mappedFile(tempFile.name());
+
+		// Act: replace the file with a smaller one
+		std::filesystem::remove(tempFile.name());
+		WriteFile(tempFile.name(), test::GenerateRandomVector(10));
+
+		// Assert:
+		ASSERT_EQ(buffer.size(), mappedFile.size());
+		EXPECT_EQ_MEMORY(buffer.data(), mappedFile.data(), buffer.size());
+	}
+}}
@@ -35,8 +35,11 @@ namespace catapult { namespace ionet {
 		test::AssertParse("IPv4", NodeRoles::IPv4, TryParseValue);
 		test::AssertParse("IPv6", NodeRoles::IPv6, TryParseValue);
 
+		test::AssertParse("Compression", NodeRoles::Compression, TryParseValue);
+
 		test::AssertParse("Peer,Api", NodeRoles::Peer | NodeRoles::Api, TryParseValue);
 		test::AssertParse("IPv6,Api", NodeRoles::IPv6 | NodeRoles::Api, TryParseValue);
 		test::AssertParse("IPv4,IPv6,Api", NodeRoles::IPv4 | NodeRoles::IPv6 | NodeRoles::Api, TryParseValue);
+		test::AssertParse("Peer,Compression", NodeRoles::Peer | NodeRoles::Compression, TryParseValue);
 	}
 }}
@@ -0,0 +1,363 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/PacketCompressionSocketDecorator.h"
+#include "catapult/ionet/PacketCompression.h"
+#include "tests/test/core/PacketSocketDecoratorTests.h"
+#include "tests/test/core/PacketTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS PacketCompressionSocketDecoratorTests
+
+	namespace {
+		constexpr auto Min_Compressible_Packet_Data_Size = 100u;
+
+		// region test utils
+
+		PacketCompressionSettings CreateCompressionSettings() {
+			PacketCompressionSettings settings;
+			settings.CompressiblePacketTypes = { PacketType::Pull_Blocks, PacketType::Push_Transactions };
+			settings.MinCompressiblePacketDataSize = Min_Compressible_Packet_Data_Size;
+			settings.MaxPacketDataSize = 10'000;
+			return settings;
+		}
+
+		std::shared_ptr<Packet> CreateCompressiblePacket(uint32_t dataSize, PacketType type) {
+			auto pPacket = CreateSharedPacket<Packet>(dataSize);
+			pPacket->Type = type;
+			for (auto i = 0u; i < dataSize; ++i)
+				pPacket->Data()[i] = static_cast<uint8_t>(i / 16);
+
+			return pPacket;
+		}
+
+		std::shared_ptr<Packet> CreateCompressedPacket(const std::shared_ptr<Packet>& pPacket) {
+			auto compressedPayload = CompressPacketPayload(PacketPayload(pPacket));
+			auto pCompressedPacket = CreateSharedPacket<Packet>(compressedPayload.header().Size - SizeOf32<Packet>());
+			pCompressedPacket->Type = compressedPayload.header().Type;
+			std::memcpy(pCompressedPacket->Data(), compressedPayload.buffers()[0].pData, compressedPayload.buffers()[0].Size);
+			return pCompressedPacket;
+		}
+
+		// endregion
+
+		// region TestContext
+
+		struct TestContext {
+		public:
+			explicit TestContext(bool isRemoteCompressionCapable)
+					: pMockPacketSocket(std::make_shared<mocks::MockPacketSocket>())
+					, pDecoratedSocket(AddPacketCompression(pMockPacketSocket, CreateCompressionSettings(), isRemoteCompressionCapable))
+			{}
+
+		public:
+			const Packet& write(const std::shared_ptr<Packet>& pPacket) {
+				pMockPacketSocket->queueWrite(SocketOperationCode::Success);
+				pDecoratedSocket->write(PacketPayload(pPacket), [](auto) {});
+				return pMockPacketSocket->writtenPacketAt<Packet>(pMockPacketSocket->numWrites() - 1);
+			}
+
+		public:
+			std::shared_ptr<mocks::MockPacketSocket> pMockPacketSocket;
+			std::shared_ptr<PacketSocket> pDecoratedSocket;
+		};
+
+		// endregion
+	}
+
+	// region all
+
+	namespace {
+		struct IncapableRemoteTraits {
+			struct TestContextType : public TestContext {
+				TestContextType() : TestContext(false)
+				{}
+			};
+		};
+
+		struct CapableRemoteTraits {
+			struct TestContextType : public TestContext {
+				TestContextType() : TestContext(true)
+				{}
+			};
+		};
+	}
+
+	DEFINE_PACKET_SOCKET_DECORATOR_TESTS(IncapableRemoteTraits, IncapableRemote_)
+	DEFINE_PACKET_SOCKET_DECORATOR_TESTS(CapableRemoteTraits, CapableRemote_)
+
+	// endregion
+
+	// region write
+
+	TEST(TEST_CLASS, IncapableRemote_DoesNotCompressWrittenPackets) {
+		// Arrange:
+		TestContext context(false);
+
+		// Act:
+		const auto& writtenPacket1 = context.write(CreateCompressiblePacket(0, PacketType::Chain_Statistics));
+		const auto& writtenPacket2 = context.write(CreateCompressiblePacket(1000, PacketType::Push_Transactions));
+
+		// Assert:
+		EXPECT_EQ(PacketType::Chain_Statistics, writtenPacket1.Type);
+		EXPECT_EQ(PacketType::Push_Transactions, writtenPacket2.Type);
+		EXPECT_EQ(sizeof(Packet) + 1000, writtenPacket2.Size);
+	}
+
+	TEST(TEST_CLASS, CapableRemote_CompressesFirstWrittenPacketToAdvertiseCompressionSupport) {
+		// Arrange:
+		TestContext context(true);
+
+		// Act: neither packet is compressible
+		const auto& writtenPacket1 = context.write(CreateCompressiblePacket(0, PacketType::Chain_Statistics));
+		const auto& writtenPacket2 = context.write(CreateCompressiblePacket(0, PacketType::Chain_Statistics));
+
+		// Assert:
+		ASSERT_EQ(PacketType::Compressed_Payload, writtenPacket1.Type);
+		EXPECT_EQ(PacketType::Chain_Statistics, static_cast<const CompressedPacket&>(writtenPacket1).WrappedType);
+		EXPECT_EQ(PacketType::Chain_Statistics, writtenPacket2.Type);
+	}
+
+	TEST(TEST_CLASS, CapableRemote_CompressesCompressiblePackets) {
+		// Arrange:
+		TestContext context(true);
+		context.write(CreateCompressiblePacket(0, PacketType::Chain_Statistics));
+
+		for (auto packetType : { PacketType::Pull_Blocks, PacketType::Push_Transactions }) {
+			// Act:
+			const auto& writtenPacket = context.write(CreateCompressiblePacket(1000, packetType));
+
+			// Assert:
+			ASSERT_EQ(PacketType::Compressed_Payload, writtenPacket.Type) << packetType;
+			EXPECT_GT(sizeof(Packet) + 1000, writtenPacket.Size) << packetType;
+
+			const auto& compressedPacket = static_cast<const CompressedPacket&>(writtenPacket);
+			EXPECT_EQ(packetType, compressedPacket.WrappedType) << packetType;
+			EXPECT_EQ(1000u, compressedPacket.WrappedDataSize) << packetType;
+		}
+	}
+
+	TEST(TEST_CLASS, CapableRemote_DoesNotCompressPacketsWithOtherTypes) {
+		// Arrange:
+		TestContext context(true);
+		context.write(CreateCompressiblePacket(0, PacketType::Chain_Statistics));
+
+		// Act:
+		const auto& writtenPacket = context.write(CreateCompressiblePacket(1000, PacketType::Push_Block));
+
+		// Assert:
+		EXPECT_EQ(PacketType::Push_Block, writtenPacket.Type);
+		EXPECT_EQ(sizeof(Packet) + 1000, writtenPacket.Size);
+	}
+
+	TEST(TEST_CLASS, CapableRemote_CompressesOnlyPacketsWithDataSizeAtLeastThreshold) {
+		// Arrange:
+		TestContext context(true);
+		context.write(CreateCompressiblePacket(0, PacketType::Chain_Statistics));
+
+		// Act:
+		constexpr auto Min_Size = Min_Compressible_Packet_Data_Size;
+		const auto& writtenPacket1 = context.write(CreateCompressiblePacket(Min_Size - 1, PacketType::Pull_Blocks));
+		const auto& writtenPacket2 = context.write(CreateCompressiblePacket(Min_Size, PacketType::Pull_Blocks));
+
+		// Assert:
+		EXPECT_EQ(PacketType::Pull_Blocks, writtenPacket1.Type);
+		EXPECT_EQ(PacketType::Compressed_Payload, writtenPacket2.Type);
+	}
+
+	TEST(TEST_CLASS, CapableRemote_DoesNotCompressPacketsThatDoNotShrink) {
+		// Arrange:
+		TestContext context(true);
+		context.write(CreateCompressiblePacket(0, PacketType::Chain_Statistics));
+
+		// Act:
+		const auto& writtenPacket = context.write(test::CreateRandomPacket(1000, PacketType::Pull_Blocks));
+
+		// Assert:
+		EXPECT_EQ(PacketType::Pull_Blocks, writtenPacket.Type);
+		EXPECT_EQ(sizeof(Packet) + 1000, writtenPacket.Size);
+	}
+
+	// endregion
+
+	// region read
+
+	namespace {
+		template<typename TRead>
+		void AssertReadPacket(
+				mocks::MockPacketIo& mockIo,
+				const std::shared_ptr<Packet>& pPacket,
+				SocketOperationCode expectedCode,
+				const Packet* pExpectedPacket,
+				TRead read) {
+			// Arrange:
+			mockIo.queueRead(SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+
+			// Act:
+			std::vector<SocketOperationCode> readCodes;
+			std::vector<ByteBuffer> readPacketBuffers;
+			read([&readCodes, &readPacketBuffers](auto code, const auto* pReadPacket) {
+				readCodes.push_back(code);
+				readPacketBuffers.push_back(pReadPacket ? test::CopyPacketToBuffer(*pReadPacket) : ByteBuffer());
+			});
+
+			// Assert:
+			ASSERT_EQ(1u, readCodes.size());
+			EXPECT_EQ(expectedCode, readCodes[0]);
+			if (pExpectedPacket)
+				EXPECT_EQ(test::CopyPacketToBuffer(*pExpectedPacket), readPacketBuffers[0]);
+			else
+				EXPECT_TRUE(readPacketBuffers[0].empty());
+		}
+
+		template<typename TAction>
+		void RunReadTest(TAction action) {
+			// Arrange:
+			TestContext context(false);
+			auto pBufferedIo = context.pDecoratedSocket->buffered();
+
+			// Act + Assert:
+			action(*context.pMockPacketSocket, [&context](const auto& callback) { context.pDecoratedSocket->read(callback); });
+			action(*context.pMockPacketSocket, [&context](const auto& callback) { context.pDecoratedSocket->readMultiple(callback); });
+			action(*context.pMockPacketSocket->mockBufferedIo(), [pBufferedIo](const auto& callback) { pBufferedIo->read(callback); });
+		}
+	}
+
+	TEST(TEST_CLASS, CanReadUncompressedPacket) {
+		RunReadTest([](auto& mockIo, auto read) {
+			// Arrange:
+			auto pPacket = CreateCompressiblePacket(1000, PacketType::Pull_Blocks);
+
+			// Act + Assert:
+			AssertReadPacket(mockIo, pPacket, SocketOperationCode::Success, pPacket.get(), read);
+		});
+	}
+
+	TEST(TEST_CLASS, CanReadCompressedPacket) {
+		RunReadTest([](auto& mockIo, auto read) {
+			// Arrange:
+			auto pPacket = CreateCompressiblePacket(1000, PacketType::Pull_Blocks);
+
+			// Act + Assert:
+			AssertReadPacket(mockIo, CreateCompressedPacket(pPacket), SocketOperationCode::Success, pPacket.get(), read);
+		});
+	}
+
+	TEST(TEST_CLASS, CannotReadMalformedCompressedPacket) {
+		RunReadTest([](auto& mockIo, auto read) {
+			// Arrange:
+			auto pCompressedPacket = CreateCompressedPacket(CreateCompressiblePacket(1000, PacketType::Pull_Blocks));
+			--pCompressedPacket->Size;
+
+			// Act + Assert:
+			AssertReadPacket(mockIo, pCompressedPacket, SocketOperationCode::Malformed_Data, nullptr, read);
+		});
+	}
+
+	TEST(TEST_CLASS, CanReadNonSuccessCodes) {
+		// Arrange:
+		TestContext context(false);
+		context.pMockPacketSocket->queueRead(SocketOperationCode::Read_Error);
+
+		// Act:
+		SocketOperationCode readCode;
+		const Packet* pReadPacket = nullptr;
+		context.pDecoratedSocket->read([&readCode, &pReadPacket](auto code, const auto* pPacket) {
+			readCode = code;
+			pReadPacket = pPacket;
+		});
+
+		// Assert:
+		EXPECT_EQ(SocketOperationCode::Read_Error, readCode);
+		EXPECT_FALSE(!!pReadPacket);
+	}
+
+	// endregion
+
+	// region read + write
+
+	namespace {
+		template<typename TRead>
+		void AssertReadingCompressedPacketEnablesCompression(TestContext& context, mocks::MockPacketIo& mockIo, TRead read) {
+			// Arrange: read a compressed packet
+			auto pCompressedPacket = CreateCompressedPacket(CreateCompressiblePacket(0, PacketType::Pull_Blocks));
+			mockIo.queueRead(SocketOperationCode::Success, [pCompressedPacket](const auto*) { return pCompressedPacket; });
+			read();
+
+			// Act:
+			const auto& writtenPacket1 = context.write(CreateCompressiblePacket(0, PacketType::Chain_Statistics));
+			const auto& writtenPacket2 = context.write(CreateCompressiblePacket(1000, PacketType::Pull_Blocks));
+
+			// Assert: compression is enabled without advertisement
+			EXPECT_EQ(PacketType::Chain_Statistics, writtenPacket1.Type);
+			EXPECT_EQ(PacketType::Compressed_Payload, writtenPacket2.Type);
+		}
+	}
+
+	TEST(TEST_CLASS, ReadingCompressedPacketEnablesCompression) {
+		// Arrange:
+		TestContext context(false);
+
+		// Act + Assert:
+		AssertReadingCompressedPacketEnablesCompression(context, *context.pMockPacketSocket, [&context]() {
+			context.pDecoratedSocket->read([](auto, const auto*) {});
+		});
+	}
+
+	TEST(TEST_CLASS, ReadingCompressedPacketWithReadMultipleEnablesCompression) {
+		// Arrange:
+		TestContext context(false);
+
+		// Act + Assert:
+		AssertReadingCompressedPacketEnablesCompression(context, *context.pMockPacketSocket, [&context]() {
+			context.pDecoratedSocket->readMultiple([](auto, const auto*) {});
+		});
+	}
+
+	TEST(TEST_CLASS, ReadingCompressedPacketWithBufferedIoEnablesCompression) {
+		// Arrange:
+		TestContext context(false);
+		auto pBufferedIo = context.pDecoratedSocket->buffered();
+
+		// Act + Assert:
+		AssertReadingCompressedPacketEnablesCompression(context, *context.pMockPacketSocket->mockBufferedIo(), [pBufferedIo]() {
+			pBufferedIo->read([](auto, const auto*) {});
+		});
+	}
+
+	TEST(TEST_CLASS, ReadingUncompressedPacketDoesNotEnableCompression) {
+		// Arrange:
+		TestContext context(false);
+		auto pPacket = CreateCompressiblePacket(1000, PacketType::Pull_Blocks);
+		context.pMockPacketSocket->queueRead(SocketOperationCode::Success, [pPacket](const auto*) { return pPacket; });
+		context.pDecoratedSocket->read([](auto, const auto*) {});
+
+		// Act:
+		const auto& writtenPacket = context.write(CreateCompressiblePacket(1000, PacketType::Pull_Blocks));
+
+		// Assert:
+		EXPECT_EQ(PacketType::Pull_Blocks, writtenPacket.Type);
+	}
+
+	// endregion
+}}
@@ -0,0 +1,258 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/ionet/PacketCompression.h"
+#include "catapult/ionet/PacketPayloadBuilder.h"
+#include "tests/test/core/PacketTestUtils.h"
+#include "tests/TestHarness.h"
+
+namespace catapult { namespace ionet {
+
+#define TEST_CLASS PacketCompressionTests
+
+	namespace {
+		constexpr auto Test_Packet_Type = static_cast<PacketType>(987);
+		constexpr auto Max_Packet_Data_Size = 10'000u;
+
+		std::shared_ptr<Packet> CreateCompressiblePacket(uint32_t dataSize) {
+			auto pPacket = CreateSharedPacket<Packet>(dataSize);
+			pPacket->Type = Test_Packet_Type;
+			for (auto i = 0u; i < dataSize; ++i)
+				pPacket->Data()[i] = static_cast<uint8_t>(i / 16);
+
+			return pPacket;
+		}
+
+		std::shared_ptr<Packet> CompressPacket(const PacketPayload& payload) {
+			auto compressedPayload = CompressPacketPayload(payload);
+			auto pPacket = CreateSharedPacket<Packet>(compressedPayload.header().Size - SizeOf32<Packet>());
+			pPacket->Type = compressedPayload.header().Type;
+
+			auto* pData = pPacket->Data();
+			for (const auto& buffer : compressedPayload.buffers()) {
+				std::memcpy(pData, buffer.pData, buffer.Size);
+				pData += buffer.Size;
+			}
+
+			return pPacket;
+		}
+
+		std::shared_ptr<Packet> CompressPacket(const std::shared_ptr<Packet>& pPacket) {
+			return CompressPacket(PacketPayload(pPacket));
+		}
+	}
+
+	// region CompressPacketPayload
+
+	TEST(TEST_CLASS, CanCompressPacketPayload) {
+		// Arrange:
+		auto pPacket = CreateCompressiblePacket(1000);
+
+		// Act:
+		auto pCompressedPacket = CompressPacket(pPacket);
+
+		// Assert:
+		EXPECT_EQ(PacketType::Compressed_Payload, pCompressedPacket->Type);
+		EXPECT_GT(pPacket->Size, pCompressedPacket->Size);
+
+		const auto& compressedPacket = static_cast<const CompressedPacket&>(*pCompressedPacket);
+		EXPECT_EQ(Test_Packet_Type, compressedPacket.WrappedType);
+		EXPECT_EQ(1000u, compressedPacket.WrappedDataSize);
+	}
+
+	// endregion
+
+	// region CompressPacketPayload + DecompressPacket - roundtrip
+
+	namespace {
+		void AssertCanRoundtripPayload(const PacketPayload& payload, const Packet& expectedPacket) {
+			// Act:
+			auto pCompressedPacket = CompressPacket(payload);
+			auto pDecompressedPacket = DecompressPacket(*pCompressedPacket, Max_Packet_Data_Size);
+
+			// Assert:
+			ASSERT_TRUE(!!pDecompressedPacket);
+			ASSERT_EQ(expectedPacket.Size, pDecompressedPacket->Size);
+			EXPECT_EQ(expectedPacket.Type, pDecompressedPacket->Type);
+			EXPECT_EQ_MEMORY(&expectedPacket, pDecompressedPacket.get(), expectedPacket.Size);
+		}
+	}
+
+	TEST(TEST_CLASS, CanRoundtripPacketWithNoData) {
+		// Arrange:
+		auto pPacket = CreateCompressiblePacket(0);
+
+		// Act + Assert:
+		AssertCanRoundtripPayload(PacketPayload(pPacket), *pPacket);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripPacketWithCompressibleData) {
+		// Arrange:
+		auto pPacket = CreateCompressiblePacket(Max_Packet_Data_Size);
+
+		// Act + Assert:
+		AssertCanRoundtripPayload(PacketPayload(pPacket), *pPacket);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripPacketWithIncompressibleData) {
+		// Arrange:
+		auto pPacket = test::CreateRandomPacket(1000, Test_Packet_Type);
+
+		// Act + Assert:
+		AssertCanRoundtripPayload(PacketPayload(pPacket), *pPacket);
+	}
+
+	TEST(TEST_CLASS, CanRoundtripPayloadWithMultipleBuffers) {
+		// Arrange: split compressible packet data across three buffers
+		auto pPacket = CreateCompressiblePacket(600);
+		std::array<uint8_t, 200> buffer1;
+		std::array<uint8_t, 150> buffer2;
+		std::array<uint8_t, 250> buffer3;
+		std::memcpy(buffer1.data(), pPacket->Data(), buffer1.size());
+		std::memcpy(buffer2.data(), pPacket->Data() + 200, buffer2.size());
+		std::memcpy(buffer3.data(), pPacket->Data() + 350, buffer3.size());
+
+		PacketPayloadBuilder builder(Test_Packet_Type);
+		builder.appendValue(buffer1);
+		builder.appendValue(buffer2);
+		builder.appendValue(buffer3);
+		auto payload = builder.build();
+
+		// Sanity:
+		EXPECT_EQ(3u, payload.buffers().size());
+
+		// Act + Assert:
+		AssertCanRoundtripPayload(payload, *pPacket);
+	}
+
+	// endregion
+
+	// region DecompressPacket - failure
+
+	TEST(TEST_CLASS, CannotDecompressPacketWithWrongType) {
+		// Arrange:
+		auto pCompressedPacket = CompressPacket(CreateCompressiblePacket(100));
+		pCompressedPacket->Type = Test_Packet_Type;
+
+		// Act + Assert:
+		EXPECT_FALSE(!!DecompressPacket(*pCompressedPacket, Max_Packet_Data_Size));
+	}
+
+	TEST(TEST_CLASS, CannotDecompressPacketWithIncompleteHeader) {
+		// Arrange:
+		auto pCompressedPacket = CreateSharedPacket<Packet>(sizeof(CompressedPacket) - sizeof(Packet) - 1);
+		pCompressedPacket->Type = PacketType::Compressed_Payload;
+
+		// Act + Assert:
+		EXPECT_FALSE(!!DecompressPacket(*pCompressedPacket, Max_Packet_Data_Size));
+	}
+
+	TEST(TEST_CLASS, CannotDecompressPacketWrappingCompressedPacket) {
+		// Arrange:
+		auto pCompressedPacket = CompressPacket(CompressPacket(CreateCompressiblePacket(100)));
+
+		// Act + Assert:
+		EXPECT_FALSE(!!DecompressPacket(*pCompressedPacket, Max_Packet_Data_Size));
+	}
+
+	TEST(TEST_CLASS, CannotDecompressPacketWithDataSizeGreaterThanMax) {
+		// Arrange:
+		auto pCompressedPacket = CompressPacket(CreateCompressiblePacket(Max_Packet_Data_Size + 1));
+
+		// Act + Assert:
+		EXPECT_FALSE(!!DecompressPacket(*pCompressedPacket, Max_Packet_Data_Size));
+		EXPECT_TRUE(!!DecompressPacket(*pCompressedPacket, Max_Packet_Data_Size + 1));
+	}
+
+	TEST(TEST_CLASS, CannotDecompressPacketWithDataSizeGreaterThanMaxDecompressionRatio) {
+		// Arrange: declare a data size that cannot be inflated from the compressed data
+		auto pCompressedPacket = CompressPacket(CreateCompressiblePacket(100));
+		auto& compressedPacket = static_cast<CompressedPacket&>(*pCompressedPacket);
+		compressedPacket.WrappedDataSize = std::numeric_limits<uint32_t>::max();
+
+		// Act + Assert:
+		EXPECT_FALSE(!!DecompressPacket(*pCompressedPacket, std::numeric_limits<size_t>::max()));
+	}
+
+	TEST(TEST_CLASS, CanDecompressPacketWithHighDecompressionRatio) {
+		// Arrange: zero data is highly compressible
+		constexpr uint32_t Data_Size = 1024 * 1024;
+		auto pPacket = CreateSharedPacket<Packet>(Data_Size);
+		pPacket->Type = Test_Packet_Type;
+		std::memset(static_cast<void*>(pPacket->Data()), 0, Data_Size);
+
+		auto pCompressedPacket = CompressPacket(pPacket);
+
+		// Sanity:
+		EXPECT_LT(100u * pCompressedPacket->Size, Data_Size);
+
+		// Act:
+		auto pDecompressedPacket = DecompressPacket(*pCompressedPacket, Data_Size);
+
+		// Assert:
+		ASSERT_TRUE(!!pDecompressedPacket);
+		ASSERT_EQ(pPacket->Size, pDecompressedPacket->Size);
+		EXPECT_EQ_MEMORY(pPacket.get(), pDecompressedPacket.get(), pPacket->Size);
+	}
+
+	TEST(TEST_CLASS, CannotDecompressPacketWithWrongDataSize) {
+		// Arrange:
+		auto pCompressedPacket = CompressPacket(CreateCompressiblePacket(100));
+		auto& compressedPacket = static_cast<CompressedPacket&>(*pCompressedPacket);
+
+		// Act + Assert:
+		for (auto dataSize : { 99u, 101u }) {
+			compressedPacket.WrappedDataSize = dataSize;
+			EXPECT_FALSE(!!DecompressPacket(*pCompressedPacket, Max_Packet_Data_Size)) << dataSize;
+		}
+	}
+
+	TEST(TEST_CLASS, CannotDecompressPacketWithTruncatedData) {
+		// Arrange:
+		auto pCompressedPacket = CompressPacket(CreateCompressiblePacket(100));
+		--pCompressedPacket->Size;
+
+		// Act + Assert:
+		EXPECT_FALSE(!!DecompressPacket(*pCompressedPacket, Max_Packet_Data_Size));
+	}
+
+	TEST(TEST_CLASS, CannotDecompressPacketWithTrailingData) {
+		// Arrange:
+		auto pCompressedPacket = CompressPacket(CreateCompressiblePacket(100));
+		auto pPacketWithTrailingData = CreateSharedPacket<Packet>(pCompressedPacket->Size - SizeOf32<Packet>() + 1);
+		std::memcpy(static_cast<void*>(pPacketWithTrailingData.get()), pCompressedPacket.get(), pCompressedPacket->Size);
+		++pPacketWithTrailingData->Size;
+
+		// Act + Assert:
+		EXPECT_FALSE(!!DecompressPacket(*pPacketWithTrailingData, Max_Packet_Data_Size));
+	}
+
+	TEST(TEST_CLASS, CannotDecompressPacketWithCorruptData) {
+		// Arrange:
+		auto pCompressedPacket = CompressPacket(CreateCompressiblePacket(100));
+		pCompressedPacket->Data()[sizeof(CompressedPacket) - sizeof(Packet)] ^= 0xFF;
+
+		// Act + Assert:
+		EXPECT_FALSE(!!DecompressPacket(*pCompressedPacket, Max_Packet_Data_Size));
+	}
+
+	// endregion
+}}
@@ -167,6 +167,7 @@ namespace catapult { namespace ionet {
 		// Assert:
 		EXPECT_EQ(0u, handlers.size());
 		EXPECT_EQ(Default_Max_Packet_Data_Size, handlers.maxPacketDataSize());
+		EXPECT_EQ(0u, handlers.processHistogram().values().count());
 	}
 
 	TEST(TEST_CLASS, CanCreateHandlersWithCustomOptions) {
@@ -321,6 +322,7 @@ namespace catapult { namespace ionet {
 			// Assert:
 			EXPECT_FALSE(isProcessed);
 			EXPECT_EQ(0x00000000u, marker);
+			EXPECT_EQ(0u, handlers.processHistogram().values().count());
 		}
 	}
 
@@ -341,6 +343,24 @@ namespace catapult { namespace ionet {
 		// Assert:
 		EXPECT_TRUE(isProcessed);
 		EXPECT_EQ(0x00000010u, marker);
+		EXPECT_EQ(1u, handlers.processHistogram().values().count());
+	}
+
+	TEST(TEST_CLASS, ProcessHistogramIsSharedByHandlerCopies) {
+		// Arrange:
+		auto marker = 0u;
+		PacketHandlers handlers;
+		RegisterHandlers(handlers, { 1, 3, 5 }, marker);
+		auto handlersCopy = handlers;
+
+		// Act:
+		ProcessPacket(handlers, 1);
+		ProcessPacket(handlersCopy, 3);
+		ProcessPacket(handlersCopy, 5);
+
+		// Assert:
+		EXPECT_EQ(3u, handlers.processHistogram().values().count());
+		EXPECT_EQ(&handlers.processHistogram(), &handlersCopy.processHistogram());
 	}
 
 	TEST(TEST_CLASS, PacketIsPassedToHandler) {
@@ -121,6 +121,160 @@ namespace catapult { namespace ionet {
 
 	// endregion
 
+	// region copy
+
+	TEST(TEST_CLASS, CopiedPacketPayloadSharesDataBuffers) {
+		// Arrange:
+		auto entities = std::vector<std::shared_ptr<model::VerifiableEntity>>{
+			test::CreateRandomEntityWithSize<>(164),
+			test::CreateRandomEntityWithSize<>(212),
+			test::CreateRandomEntityWithSize<>(132)
+		};
+		auto payload = PacketPayloadFactory::FromEntities(Test_Packet_Type, entities);
+
+		// Act:
+		auto payloadCopy = payload;
+
+		// Assert:
+		test::AssertPacketHeader(payloadCopy, sizeof(PacketHeader) + 164 + 212 + 132, Test_Packet_Type);
+		EXPECT_EQ(&payload.buffers(), &payloadCopy.buffers());
+		EXPECT_EQ(3u, payloadCopy.buffers().size());
+	}
+
+	TEST(TEST_CLASS, CopiedPacketPayloadKeepsDataAliveAfterOriginalIsDestroyed) {
+		// Arrange:
+		constexpr auto Data_Size = 123u;
+		auto dataBuffer = test::GenerateRandomArray<Data_Size>();
+		auto pPayload = std::make_unique<PacketPayload>(CreatePacketPointerWithData(dataBuffer));
+
+		// Act:
+		auto payloadCopy = *pPayload;
+		pPayload.reset();
+
+		// Assert:
+		test::AssertPacketHeader(payloadCopy, sizeof(PacketHeader) + Data_Size, Test_Packet_Type);
+		ASSERT_EQ(1u, payloadCopy.buffers().size());
+
+		const auto& payloadBuffer = payloadCopy.buffers()[0];
+		ASSERT_EQ(Data_Size, payloadBuffer.Size);
+		EXPECT_EQ_MEMORY(dataBuffer.data(), payloadBuffer.pData, Data_Size);
+	}
+
+	// endregion
+
+	// region compressed
+
+	namespace {
+		class CountingCompressor {
+		public:
+			CountingCompressor() : m_numCalls(0)
+			{}
+
+		public:
+			size_t numCalls() const {
+				return m_numCalls;
+			}
+
+		public:
+			PacketPayload operator()(const PacketPayload& payload) {
+				++m_numCalls;
+				return PacketPayload(CreatePacketPointer(static_cast<uint32_t>(payload.buffers().size())));
+			}
+
+		private:
+			size_t m_numCalls;
+		};
+	}
+
+	TEST(TEST_CLASS, CompressedReturnsPayloadCreatedByCompress) {
+		// Arrange:
+		auto payload = PacketPayload(CreatePacketPointer(123));
+		auto pCompressedPacket = CreatePacketPointer(50);
+
+		// Act:
+		auto compressedPayload = payload.compressed([pCompressedPacket](const auto&) {
+			return PacketPayload(pCompressedPacket);
+		});
+
+		// Assert:
+		test::AssertPacketHeader(compressedPayload, sizeof(PacketHeader) + 50, Test_Packet_Type);
+		ASSERT_EQ(1u, compressedPayload.buffers().size());
+		EXPECT_EQ(pCompressedPacket->Data(), compressedPayload.buffers()[0].pData);
+	}
+
+	TEST(TEST_CLASS, CompressedCompressesPayloadWithDataOnceForAllCopies) {
+		// Arrange:
+		auto payload = PacketPayload(CreatePacketPointer(123));
+		auto payloadCopy = payload;
+		CountingCompressor compressor;
+		auto compress = [&compressor](const auto& payloadToCompress) { return compressor(payloadToCompress); };
+
+		// Act:
+		auto compressedPayload1 = payload.compressed(compress);
+		auto compressedPayload2 = payloadCopy.compressed(compress);
+		auto compressedPayload3 = payload.compressed(compress);
+
+		// Assert:
+		EXPECT_EQ(1u, compressor.numCalls());
+		EXPECT_EQ(&compressedPayload1.buffers(), &compressedPayload2.buffers());
+		EXPECT_EQ(&compressedPayload1.buffers(), &compressedPayload3.buffers());
+	}
+
+	TEST(TEST_CLASS, CompressedCompressesPayloadWithoutDataEveryTime) {
+		// Arrange:
+		auto payload = PacketPayload(Test_Packet_Type);
+		CountingCompressor compressor;
+		auto compress = [&compressor](const auto& payloadToCompress) { return compressor(payloadToCompress); };
+
+		// Act:
+		payload.compressed(compress);
+		payload.compressed(compress);
+
+		// Assert:
+		EXPECT_EQ(2u, compressor.numCalls());
+	}
+
+	TEST(TEST_CLASS, CompressedDoesNotShareCompressedPayloadWithMergedPayload) {
+		// Arrange:
+		auto payload = PacketPayload(CreatePacketPointer(123));
+		auto mergedPayload = PacketPayload::Merge(CreatePacketPointer(20), payload);
+		CountingCompressor compressor;
+		auto compress = [&compressor](const auto& payloadToCompress) { return compressor(payloadToCompress); };
+
+		// Act:
+		auto compressedPayload = payload.compressed(compress);
+		auto compressedMergedPayload = mergedPayload.compressed(compress);
+
+		// Assert:
+		EXPECT_EQ(2u, compressor.numCalls());
+		EXPECT_EQ(sizeof(PacketHeader) + 1, compressedPayload.header().Size);
+		EXPECT_EQ(sizeof(PacketHeader) + 3, compressedMergedPayload.header().Size);
+	}
+
+	TEST(TEST_CLASS, CompressedRetriesCompressionAfterFailure) {
+		// Arrange:
+		auto payload = PacketPayload(CreatePacketPointer(123));
+		CountingCompressor compressor;
+		auto compress = [&compressor](const auto& payloadToCompress) {
+			auto compressedPayload = compressor(payloadToCompress);
+			if (1 == compressor.numCalls())
+				CATAPULT_THROW_RUNTIME_ERROR("compression failed");
+
+			return compressedPayload;
+		};
+
+		// Act:
+		EXPECT_THROW(payload.compressed(compress), catapult_runtime_error);
+		auto compressedPayload1 = payload.compressed(compress);
+		auto compressedPayload2 = payload.compressed(compress);
+
+		// Assert:
+		EXPECT_EQ(2u, compressor.numCalls());
+		EXPECT_EQ(&compressedPayload1.buffers(), &compressedPayload2.buffers());
+	}
+
+	// endregion
+
 	// region Merge
 
 	TEST(TEST_CLASS, CannotMergePacketWithInvalidDataAndPayload) {
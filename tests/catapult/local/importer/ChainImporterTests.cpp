@@ -58,6 +58,9 @@ namespace catapult { namespace local {
 				CATAPULT_THROW_RUNTIME_ERROR("notifyDropBlocksAfter - not supported in mock");
 			}
 
+			void flush() override
+			{}
+
 		private:
 			std::vector<Height>& m_heights;
 		};
@@ -168,7 +171,7 @@ namespace catapult { namespace local {
 			}
 
 			void seedProofs(uint64_t numProofs) {
-				io::FileDatabase proofFileDatabase(m_dataDirectory.rootDir(), { test::File_Database_Batch_Size, ".proof" });
+				io::FileDatabase proofFileDatabase(m_dataDirectory.rootDir(), { test::File_Database_Batch_Size, ".proof", false });
 				for (auto i = 0u; i < numProofs; ++i) {
 					auto pProofStream = proofFileDatabase.outputStream(2 + i);
 
@@ -23,6 +23,7 @@
 #include "catapult/config/CatapultDataDirectory.h"
 #include "catapult/extensions/LocalNodeChainScore.h"
 #include "catapult/extensions/NemesisBlockLoader.h"
+#include "catapult/model/BlockUtils.h"
 #include "catapult/subscribers/StateChangeInfo.h"
 #include "tests/test/core/BlockTestUtils.h"
 #include "tests/test/core/ResolverTestUtils.h"
@@ -32,6 +33,7 @@
 #include "tests/test/local/LocalNodeTestState.h"
 #include "tests/test/local/LocalTestUtils.h"
 #include "tests/test/nodeps/Filesystem.h"
+#include "tests/test/nodeps/KeyTestUtils.h"
 #include "tests/test/other/mocks/MockBlockHeightCapturingNotificationObserver.h"
 #include "tests/test/plugins/PluginManagerFactory.h"
 #include "tests/TestHarness.h"
@@ -143,9 +145,13 @@ namespace catapult { namespace local {
 			});
 		}
 
+		enum class BlockCorruption { Entity_Hash, Transactions_Hash, Signature };
+
 		class LoadBlockChainTestContext {
 		public:
-			LoadBlockChainTestContext() : m_pluginManager(test::CreatePluginManager()) {
+			explicit LoadBlockChainTestContext(StatelessBlockVerification verification = StatelessBlockVerification::None)
+					: m_pluginManager(test::CreatePluginManager())
+					, m_verification(verification) {
 				AddXorResolvers(m_pluginManager);
 			}
 
@@ -163,6 +169,10 @@ namespace catapult { namespace local {
 			}
 
 		public:
+			void setFailureHeight(Height failureHeight) {
+				m_failureHeight = failureHeight;
+			}
+
 			void setStorageChainHeight(Height chainHeight) {
 				auto storage = m_state.ref().Storage.modifier();
 
@@ -175,13 +185,48 @@ namespace catapult { namespace local {
 				storage.commit();
 			}
 
+			void setVerifiableStorageChainHeight(Height chainHeight) {
+				setVerifiableStorageChainHeight(chainHeight, Height(), BlockCorruption::Entity_Hash);
+			}
+
+			void setVerifiableStorageChainHeight(Height chainHeight, Height corruptHeight, BlockCorruption corruption) {
+				auto storage = m_state.ref().Storage.modifier();
+
+				for (auto height = Height(2); height <= chainHeight; height = height + Height(1)) {
+					auto signer = test::GenerateKeyPair();
+					auto pBlock = test::GenerateBlockWithTransactions(0, height, Timestamp(height.unwrap() * 3000));
+					pBlock->Difficulty = Difficulty(Difficulty().unwrap() + height.unwrap());
+					pBlock->TransactionsHash = Hash256();
+					pBlock->SignerPublicKey = signer.publicKey();
+					model::SignBlockHeader(signer, *pBlock);
+
+					auto isCorrupt = corruptHeight == height;
+					if (isCorrupt && BlockCorruption::Transactions_Hash == corruption)
+						pBlock->TransactionsHash[0] ^= 0xFF;
+
+					if (isCorrupt && BlockCorruption::Signature == corruption)
+						pBlock->Signature[0] ^= 0xFF;
+
+					auto blockElement = test::BlockToBlockElement(*pBlock);
+					if (isCorrupt && BlockCorruption::Entity_Hash == corruption)
+						blockElement.EntityHash[0] ^= 0xFF;
+
+					storage.saveBlock(blockElement);
+				}
+
+				storage.commit();
+			}
+
 			model::ChainScore load(Height startHeight) {
 				auto observerFactory = [this](const auto& block) {
 					this->m_factoryHeights.push_back(block.Height);
 					return std::make_unique<mocks::MockBlockHeightCapturingNotificationObserver>(this->m_observerBlockHeights);
 				};
 
-				auto score = LoadBlockChain(observerFactory, m_pluginManager, m_state.ref(), startHeight, [this](const auto& status) {
+				auto statusConsumer = [this](const auto& status) {
+					if (m_failureHeight == status.BlockElement.Block.Height)
+						CATAPULT_THROW_RUNTIME_ERROR("status consumer failure");
+
 					// check status for internal consistency
 					auto newComputedScore = m_statusScore;
 					newComputedScore += status.StateChangeInfo.ScoreDelta;
@@ -191,7 +236,8 @@ namespace catapult { namespace local {
 
 					m_statusScore = newComputedScore;
 					m_statusHeights.push_back(status.BlockElement.Block.Height);
-				});
+				};
+				auto score = LoadBlockChain(observerFactory, m_pluginManager, m_state.ref(), startHeight, statusConsumer, m_verification);
 
 				// check score for consistency
 				EXPECT_EQ(m_statusScore, score);
@@ -204,8 +250,11 @@ namespace catapult { namespace local {
 			test::LocalNodeTestState m_state;
 			plugins::PluginManager m_pluginManager;
 
+			StatelessBlockVerification m_verification;
+
 			model::ChainScore m_statusScore;
 			std::vector<Height> m_statusHeights;
+			Height m_failureHeight;
 		};
 
 		constexpr uint64_t CalculateExpectedScore(size_t height) {
@@ -286,6 +335,123 @@ namespace catapult { namespace local {
 		EXPECT_EQ(expectedHeights, context.statusHeights());
 	}
 
+	TEST(TEST_CLASS, LoadBlockChainLoadsMoreBlocksThanCanBePrefetched) {
+		// Arrange: create a storage with more blocks than are buffered by read-ahead
+		LoadBlockChainTestContext context;
+		context.setStorageChainHeight(Height(50));
+
+		// Act:
+		auto score = context.load(Height(2));
+
+		// Assert:
+		std::vector<Height> expectedHeights;
+		for (auto height = Height(2); height <= Height(50); height = height + Height(1))
+			expectedHeights.push_back(height);
+
+		EXPECT_EQ(model::ChainScore(CalculateExpectedScore(50)), score);
+		EXPECT_EQ(expectedHeights, context.observerBlockHeights());
+		EXPECT_EQ(expectedHeights, context.factoryHeights());
+		EXPECT_EQ(expectedHeights, context.statusHeights());
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainStopsLoadingWhenBlockProcessingFails) {
+		// Arrange: create a storage with more blocks than are buffered by read-ahead and fail processing early
+		LoadBlockChainTestContext context;
+		context.setStorageChainHeight(Height(50));
+		context.setFailureHeight(Height(5));
+
+		// Act + Assert:
+		EXPECT_THROW(context.load(Height(2)), catapult_runtime_error);
+
+		// - blocks after failure are not processed
+		auto expectedHeights = std::vector<Height>{ Height(2), Height(3), Height(4) };
+		EXPECT_EQ(expectedHeights, context.statusHeights());
+	}
+
+	// endregion
+
+	// region LoadBlockChain - stateless verification
+
+	namespace {
+		void AssertCanLoadVerifiableBlocks(StatelessBlockVerification verification) {
+			// Arrange:
+			LoadBlockChainTestContext context(verification);
+			context.setVerifiableStorageChainHeight(Height(30));
+
+			// Act:
+			auto score = context.load(Height(2));
+
+			// Assert:
+			std::vector<Height> expectedHeights;
+			for (auto height = Height(2); height <= Height(30); height = height + Height(1))
+				expectedHeights.push_back(height);
+
+			EXPECT_EQ(model::ChainScore(CalculateExpectedScore(30)), score);
+			EXPECT_EQ(expectedHeights, context.statusHeights());
+		}
+
+		void AssertCannotLoadCorruptBlock(StatelessBlockVerification verification, BlockCorruption corruption) {
+			// Arrange:
+			LoadBlockChainTestContext context(verification);
+			context.setVerifiableStorageChainHeight(Height(30), Height(5), corruption);
+
+			// Act + Assert:
+			EXPECT_THROW(context.load(Height(2)), catapult_runtime_error);
+
+			// - blocks before corrupt block are processed
+			auto expectedHeights = std::vector<Height>{ Height(2), Height(3), Height(4) };
+			EXPECT_EQ(expectedHeights, context.statusHeights());
+		}
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainSkipsVerificationWhenVerificationIsDisabled) {
+		// Arrange: storage block with random transactions hash
+		LoadBlockChainTestContext context;
+		context.setStorageChainHeight(Height(7));
+
+		// Act:
+		auto score = context.load(Height(2));
+
+		// Assert:
+		EXPECT_EQ(model::ChainScore(CalculateExpectedScore(7)), score);
+		EXPECT_EQ(6u, context.statusHeights().size());
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainCanLoadBlocksWithValidHashes) {
+		AssertCanLoadVerifiableBlocks(StatelessBlockVerification::Hashes);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainCanLoadBlocksWithValidHashesAndSignatures) {
+		AssertCanLoadVerifiableBlocks(StatelessBlockVerification::Hashes_And_Signatures);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainFailsWhenBlockEntityHashIsInvalid) {
+		AssertCannotLoadCorruptBlock(StatelessBlockVerification::Hashes, BlockCorruption::Entity_Hash);
+		AssertCannotLoadCorruptBlock(StatelessBlockVerification::Hashes_And_Signatures, BlockCorruption::Entity_Hash);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainFailsWhenBlockTransactionsHashIsInvalid) {
+		AssertCannotLoadCorruptBlock(StatelessBlockVerification::Hashes, BlockCorruption::Transactions_Hash);
+		AssertCannotLoadCorruptBlock(StatelessBlockVerification::Hashes_And_Signatures, BlockCorruption::Transactions_Hash);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainFailsWhenBlockSignatureIsInvalidAndSignaturesAreVerified) {
+		AssertCannotLoadCorruptBlock(StatelessBlockVerification::Hashes_And_Signatures, BlockCorruption::Signature);
+	}
+
+	TEST(TEST_CLASS, LoadBlockChainIgnoresInvalidBlockSignatureWhenOnlyHashesAreVerified) {
+		// Arrange: corrupt the signature after the block hash is calculated, so that only signature verification can detect it
+		LoadBlockChainTestContext context(StatelessBlockVerification::Hashes);
+		context.setVerifiableStorageChainHeight(Height(7), Height(5), BlockCorruption::Signature);
+
+		// Act:
+		auto score = context.load(Height(2));
+
+		// Assert:
+		EXPECT_EQ(model::ChainScore(CalculateExpectedScore(7)), score);
+		EXPECT_EQ(6u, context.statusHeights().size());
+	}
+
 	// endregion
 
 	// region LoadBlockChain - state enabled
@@ -112,6 +112,7 @@ namespace catapult { namespace local {
 		// Assert:
 		const auto& capturedBlockElements = subscriber.copiedBlockElements();
 		EXPECT_EQ(0u, capturedBlockElements.size());
+		EXPECT_EQ(0u, subscriber.numFlushes());
 	}
 
 	TEST(TEST_CLASS, BlockChangeNotificationsAreRaisedWhenPreviousExecutionIsNotDetected_WithoutStatement) {
@@ -126,6 +127,7 @@ namespace catapult { namespace local {
 		const auto& capturedBlockElements = subscriber.copiedBlockElements();
 		ASSERT_EQ(1u, capturedBlockElements.size());
 		EXPECT_EQ(Height(1), capturedBlockElements[0]->Block.Height);
+		EXPECT_EQ(1u, subscriber.numFlushes());
 
 		EXPECT_FALSE(capturedBlockElements[0]->OptionalStatement);
 	}
@@ -143,6 +145,7 @@ namespace catapult { namespace local {
 		const auto& capturedBlockElements = subscriber.copiedBlockElements();
 		ASSERT_EQ(1u, capturedBlockElements.size());
 		EXPECT_EQ(Height(1), capturedBlockElements[0]->Block.Height);
+		EXPECT_EQ(1u, subscriber.numFlushes());
 
 		ASSERT_TRUE(capturedBlockElements[0]->OptionalStatement);
 		test::AssertEqual(*pBlockStatement, *capturedBlockElements[0]->OptionalStatement);
@@ -99,4 +99,40 @@ namespace catapult { namespace model {
 		// Assert:
 		EXPECT_TRUE(addresses.empty());
 	}
+
+	TEST(TEST_CLASS, ExtractAddressesExtractsAddressesFromAllEntityInfos) {
+		// Arrange:
+		std::vector<std::unique_ptr<mocks::MockTransaction>> transactions;
+		std::vector<Hash256> hashes(3);
+		WeakEntityInfos entityInfos;
+		for (auto i = 0u; i < 3; ++i) {
+			transactions.push_back(mocks::CreateMockTransactionWithSignerAndRecipient(
+					test::GenerateRandomByteArray<Key>(),
+					test::GenerateRandomByteArray<Key>()));
+			entityInfos.emplace_back(*transactions.back(), hashes[i]);
+		}
+
+		MockNotificationPublisher notificationPublisher(MockNotificationPublisher::Mode::Public_Key);
+
+		// Act:
+		auto addresses = ExtractAddresses(entityInfos, notificationPublisher);
+
+		// Assert:
+		EXPECT_EQ(6u, addresses.size());
+		for (const auto& pTransaction : transactions) {
+			EXPECT_CONTAINS(addresses, extensions::CopyToUnresolvedAddress(GetSignerAddress(*pTransaction)));
+			EXPECT_CONTAINS(addresses, extensions::CopyToUnresolvedAddress(mocks::GetRecipientAddress(*pTransaction)));
+		}
+	}
+
+	TEST(TEST_CLASS, ExtractAddressesReturnsNoAddressesWhenThereAreNoEntityInfos) {
+		// Arrange:
+		MockNotificationPublisher notificationPublisher(MockNotificationPublisher::Mode::Address);
+
+		// Act:
+		auto addresses = ExtractAddresses(WeakEntityInfos(), notificationPublisher);
+
+		// Assert:
+		EXPECT_TRUE(addresses.empty());
+	}
 }}
@@ -38,6 +38,8 @@ namespace catapult { namespace net {
 		EXPECT_EQ(0u, settings.SocketWorkingBufferSensitivity);
 		EXPECT_EQ(utils::FileSize::FromMegabytes(100), settings.MaxPacketDataSize);
 		EXPECT_EQ(ionet::IpProtocol::IPv4, settings.OutgoingProtocols);
+		EXPECT_FALSE(settings.EnablePacketCompression);
+		EXPECT_EQ(utils::FileSize::FromKilobytes(4), settings.PacketCompressionThreshold);
 
 		EXPECT_TRUE(settings.AllowIncomingSelfConnections);
 		EXPECT_FALSE(settings.AllowOutgoingSelfConnections);
@@ -87,4 +89,38 @@ namespace catapult { namespace net {
 		EXPECT_TRUE(options.SslOptions.VerifyCallbackSupplier()(verifyContext));
 		EXPECT_EQ(0x0101u, callbackMask);
 	}
+
+	namespace {
+		ionet::PacketCompressionSettings ToPacketCompressionSettings(bool enablePacketCompression) {
+			// Arrange:
+			auto settings = ConnectionSettings();
+			settings.MaxPacketDataSize = utils::FileSize::FromMegabytes(2);
+			settings.EnablePacketCompression = enablePacketCompression;
+			settings.PacketCompressionThreshold = utils::FileSize::FromKilobytes(3);
+
+			// Act:
+			return settings.toPacketCompressionSettings();
+		}
+	}
+
+	TEST(TEST_CLASS, CanConvertToPacketCompressionSettings_CompressionDisabled) {
+		// Act:
+		auto compressionSettings = ToPacketCompressionSettings(false);
+
+		// Assert:
+		EXPECT_TRUE(compressionSettings.CompressiblePacketTypes.empty());
+		EXPECT_EQ(3u * 1024, compressionSettings.MinCompressiblePacketDataSize);
+		EXPECT_EQ(2u * 1024 * 1024, compressionSettings.MaxPacketDataSize);
+	}
+
+	TEST(TEST_CLASS, CanConvertToPacketCompressionSettings_CompressionEnabled) {
+		// Act:
+		auto compressionSettings = ToPacketCompressionSettings(true);
+
+		// Assert:
+		auto expectedPacketTypes = std::vector<ionet::PacketType>{ ionet::PacketType::Pull_Blocks, ionet::PacketType::Push_Transactions };
+		EXPECT_EQ(expectedPacketTypes, compressionSettings.CompressiblePacketTypes);
+		EXPECT_EQ(3u * 1024, compressionSettings.MinCompressiblePacketDataSize);
+		EXPECT_EQ(2u * 1024 * 1024, compressionSettings.MaxPacketDataSize);
+	}
 }}
@@ -78,4 +78,22 @@ namespace catapult { namespace subscribers {
 			EXPECT_EQ(Height(553), pSubscriber->dropBlocksAfterHeights()[0]) << message;
 		}
 	}
+
+	TEST(TEST_CLASS, FlushForwardsToAllSubscribers) {
+		// Arrange:
+		TestContext<mocks::MockBlockChangeSubscriber> context;
+
+		// Sanity:
+		EXPECT_EQ(3u, context.subscribers().size());
+
+		// Act:
+		context.aggregate().flush();
+
+		// Assert:
+		auto i = 0u;
+		for (const auto* pSubscriber : context.subscribers()) {
+			auto message = "subscriber at " + std::to_string(i++);
+			EXPECT_EQ(1u, pSubscriber->numFlushes()) << message;
+		}
+	}
 }}
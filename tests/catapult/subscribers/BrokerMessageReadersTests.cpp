@@ -345,4 +345,131 @@ namespace catapult { namespace subscribers {
 	}
 
 	// endregion
+
+	// region ReadAllBatched (FileQueue)
+
+	namespace {
+		class MockBufferSubscriberWithFailingFlush : public MockBufferSubscriberWithoutFlush {
+		public:
+			void flush() {
+				m_breadcrumbs.push_back(Breadcrumb::Flush);
+				CATAPULT_THROW_RUNTIME_ERROR("flush failed");
+			}
+		};
+
+		std::vector<std::vector<uint8_t>> WriteFiveMessages(QueueTestContext& context) {
+			std::vector<std::vector<uint8_t>> notificationBuffers;
+			for (auto i = 0u; i < 7; ++i)
+				notificationBuffers.push_back(test::GenerateRandomVector(130 + i));
+
+			context.write({ notificationBuffers[0], notificationBuffers[1] });
+			context.write(notificationBuffers[2]);
+			context.write(notificationBuffers[3]);
+			context.write({ notificationBuffers[4], notificationBuffers[5] });
+			context.write(notificationBuffers[6]);
+			return notificationBuffers;
+		}
+	}
+
+	TEST(TEST_CLASS, ReadAllBatched_CanReadZero) {
+		// Arrange:
+		QueueTestContext context;
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		ReadAllBatched(context.reader(), 2, subscriber, ReadNextBuffer);
+
+		// Assert:
+		EXPECT_EQ(std::vector<Breadcrumb>(), subscriber.breadcrumbs());
+		EXPECT_TRUE(subscriber.notifications().empty());
+	}
+
+	TEST(TEST_CLASS, ReadAllBatched_FlushesOncePerBatch) {
+		// Arrange:
+		QueueTestContext context;
+		auto notificationBuffers = WriteFiveMessages(context);
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		ReadAllBatched(context.reader(), 2, subscriber, ReadNextBuffer);
+
+		// Assert:
+		std::vector<Breadcrumb> expectedBreadcrumbs{
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Flush
+		};
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+		EXPECT_EQ(notificationBuffers, subscriber.notifications());
+
+		// - all messages were consumed
+		EXPECT_EQ(0u, context.reader().pending());
+	}
+
+	TEST(TEST_CLASS, ReadAllBatched_DoesNotConsumeBatchWhenFlushFails) {
+		// Arrange:
+		QueueTestContext context;
+		auto notificationBuffers = WriteFiveMessages(context);
+
+		MockBufferSubscriberWithFailingFlush subscriber;
+
+		// Act:
+		EXPECT_THROW(ReadAllBatched(context.reader(), 2, subscriber, ReadNextBuffer), catapult_runtime_error);
+
+		// Assert: first batch was processed but not consumed
+		std::vector<Breadcrumb> expectedBreadcrumbs{ Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush };
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+		EXPECT_EQ(3u, subscriber.notifications().size());
+
+		EXPECT_EQ(5u, context.reader().pending());
+	}
+
+	// endregion
+
+	// region ReadAll (MessageQueueDescriptor, catch-up)
+
+	TEST(TEST_CLASS, ReadAllMessageQueueDescriptor_DoesNotUseCatchUpModeWhenFewerMessagesArePending) {
+		// Arrange:
+		QueueTestContext context;
+		auto notificationBuffers = WriteFiveMessages(context);
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		ReadAll({ context.queuePath(), "index_r.dat", "index.dat" }, 6, subscriber, ReadNextBuffer);
+
+		// Assert: subscriber is flushed after each message
+		std::vector<Breadcrumb> expectedBreadcrumbs{
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Flush
+		};
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+		EXPECT_EQ(notificationBuffers, subscriber.notifications());
+	}
+
+	TEST(TEST_CLASS, ReadAllMessageQueueDescriptor_UsesCatchUpModeWhenEnoughMessagesArePending) {
+		// Arrange:
+		QueueTestContext context;
+		auto notificationBuffers = WriteFiveMessages(context);
+
+		MockBufferSubscriber subscriber;
+
+		// Act:
+		ReadAll({ context.queuePath(), "index_r.dat", "index.dat" }, 3, subscriber, ReadNextBuffer);
+
+		// Assert: subscriber is flushed after each batch
+		std::vector<Breadcrumb> expectedBreadcrumbs{
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush,
+			Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Notify, Breadcrumb::Flush
+		};
+		EXPECT_EQ(expectedBreadcrumbs, subscriber.breadcrumbs());
+		EXPECT_EQ(notificationBuffers, subscriber.notifications());
+	}
+
+	// endregion
 }}
@@ -39,6 +39,10 @@ namespace catapult { namespace test {
 		void notifyDropBlocksAfter(Height) override {
 			CATAPULT_THROW_RUNTIME_ERROR("notifyDropBlocksAfter - not supported in mock");
 		}
+
+		void flush() override {
+			CATAPULT_THROW_RUNTIME_ERROR("flush - not supported in mock");
+		}
 	};
 
 	/// Unsupported finalization subscriber.
@@ -621,6 +621,33 @@ namespace catapult { namespace tree {
 		EXPECT_EQ(expectedRoot, pDeltaTree->root());
 	}
 
+	TEST(TEST_CLASS, CanSetBatchOfValues) {
+		// Arrange:
+		MemoryDataSource dataSource;
+		MemoryBasePatriciaTree tree(dataSource);
+		SeedTreeWithFourNodes(tree);
+
+		// Act:
+		auto pDeltaTree = tree.rebase();
+		pDeltaTree->setBatch(std::vector<std::pair<uint32_t, std::string>>{
+			{ 0x64'6F'67'00, "kitten" },
+			{ 0x26'54'32'10, "alpha" }
+		});
+		tree.commit();
+
+		// Assert:
+		auto expectedRoot = CalculateRootHash({
+			{ 0x26'54'32'10, "alpha" },
+			{ 0x64'6F'00'00, "verb" },
+			{ 0x64'6F'67'00, "kitten" },
+			{ 0x64'6F'67'65, "coin" },
+			{ 0x68'6F'72'73, "stallion" }
+		});
+
+		EXPECT_EQ(expectedRoot, tree.root());
+		EXPECT_EQ(expectedRoot, pDeltaTree->root());
+	}
+
 	// endregion
 
 	// region custom hasher
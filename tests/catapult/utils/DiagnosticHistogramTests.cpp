@@ -0,0 +1,186 @@
+/**
+*** Copyright (c) 2016-2019, Jaguar0625, gimre, BloodyRookie, Tech Bureau, Corp.
+*** Copyright (c) 2020-present, Jaguar0625, gimre, BloodyRookie.
+*** All rights reserved.
+***
+*** This file is part of Catapult.
+***
+*** Catapult is free software: you can redistribute it and/or modify
+*** it under the terms of the GNU Lesser General Public License as published by
+*** the Free Software Foundation, either version 3 of the License, or
+*** (at your option) any later version.
+***
+*** Catapult is distributed in the hope that it will be useful,
+*** but WITHOUT ANY WARRANTY; without even the implied warranty of
+*** MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+*** GNU Lesser General Public License for more details.
+***
+*** You should have received a copy of the GNU Lesser General Public License
+*** along with Catapult. If not, see <http://www.gnu.org/licenses/>.
+**/
+
+#include "catapult/utils/DiagnosticHistogram.h"
+#include "catapult/thread/ThreadGroup.h"
+#include "tests/TestHarness.h"
+#include <limits>
+
+namespace catapult { namespace utils {
+
+#define TEST_CLASS DiagnosticHistogramTests
+
+	// region DiagnosticHistogramValues - buckets
+
+	TEST(TEST_CLASS, SmallValuesAreBucketedExactly) {
+		for (auto value = 0u; value < 4; ++value) {
+			// Act:
+			auto index = DiagnosticHistogramValues::BucketIndex(value);
+
+			// Assert:
+			EXPECT_EQ(value, index) << value;
+			EXPECT_EQ(value, DiagnosticHistogramValues::BucketUpperBound(index)) << value;
+		}
+	}
+
+	TEST(TEST_CLASS, BucketUpperBoundsAreWithinQuarterOfValues) {
+		for (auto exponent = 2u; exponent < 64; ++exponent) {
+			for (auto value : { 1ull << exponent, (1ull << exponent) + 1, (3ull << (exponent - 1)) - 1, (1ull << exponent) * 2 - 1 }) {
+				// Act:
+				auto upperBound = DiagnosticHistogramValues::BucketUpperBound(DiagnosticHistogramValues::BucketIndex(value));
+
+				// Assert:
+				EXPECT_LE(value, upperBound) << value;
+				EXPECT_LE(upperBound - value, value / 4) << value;
+			}
+		}
+	}
+
+	TEST(TEST_CLASS, BucketIndexesAreMonotonicAndBounded) {
+		// Act + Assert:
+		EXPECT_EQ(4u, DiagnosticHistogramValues::BucketIndex(4));
+		EXPECT_EQ(7u, DiagnosticHistogramValues::BucketIndex(7));
+		EXPECT_EQ(8u, DiagnosticHistogramValues::BucketIndex(8));
+		EXPECT_EQ(8u, DiagnosticHistogramValues::BucketIndex(9));
+		EXPECT_EQ(9u, DiagnosticHistogramValues::BucketIndex(10));
+
+		auto maxIndex = DiagnosticHistogramValues::BucketIndex(std::numeric_limits<uint64_t>::max());
+		EXPECT_EQ(DiagnosticHistogramValues::Num_Buckets - 1, maxIndex);
+		EXPECT_EQ(std::numeric_limits<uint64_t>::max(), DiagnosticHistogramValues::BucketUpperBound(maxIndex));
+	}
+
+	// endregion
+
+	// region DiagnosticHistogramValues - percentile
+
+	TEST(TEST_CLASS, EmptyValuesHaveZeroPercentiles) {
+		// Act:
+		DiagnosticHistogramValues values;
+
+		// Assert:
+		EXPECT_EQ(0u, values.count());
+		EXPECT_EQ(0u, values.max());
+		EXPECT_EQ(0u, values.percentile(50));
+		EXPECT_EQ(0u, values.percentile(100));
+	}
+
+	TEST(TEST_CLASS, CannotCalculateInvalidPercentile) {
+		// Arrange:
+		DiagnosticHistogramValues values;
+
+		// Act + Assert:
+		EXPECT_THROW(values.percentile(0), catapult_invalid_argument);
+		EXPECT_THROW(values.percentile(101), catapult_invalid_argument);
+	}
+
+	TEST(TEST_CLASS, CanCalculatePercentilesFromBucketCounts) {
+		// Arrange: 50 x 1, 40 x 2, 10 x 3
+		DiagnosticHistogramValues::BucketCounts bucketCounts{};
+		bucketCounts[1] = 50;
+		bucketCounts[2] = 40;
+		bucketCounts[3] = 10;
+
+		// Act:
+		DiagnosticHistogramValues values(bucketCounts, 3);
+
+		// Assert:
+		EXPECT_EQ(100u, values.count());
+		EXPECT_EQ(3u, values.max());
+		EXPECT_EQ(1u, values.percentile(1));
+		EXPECT_EQ(1u, values.percentile(50));
+		EXPECT_EQ(2u, values.percentile(51));
+		EXPECT_EQ(2u, values.percentile(90));
+		EXPECT_EQ(3u, values.percentile(91));
+		EXPECT_EQ(3u, values.percentile(100));
+	}
+
+	TEST(TEST_CLASS, PercentilesAreBoundedByMaxValue) {
+		// Arrange: 1000 is in bucket [896, 1023]
+		DiagnosticHistogramValues::BucketCounts bucketCounts{};
+		bucketCounts[DiagnosticHistogramValues::BucketIndex(1000)] = 1;
+
+		// Act:
+		DiagnosticHistogramValues values(bucketCounts, 1000);
+
+		// Assert:
+		EXPECT_EQ(1000u, values.percentile(50));
+	}
+
+	// endregion
+
+	// region DiagnosticHistogram
+
+	TEST(TEST_CLASS, HistogramIsInitiallyEmpty) {
+		// Act:
+		DiagnosticHistogram histogram;
+		auto values = histogram.values();
+
+		// Assert:
+		EXPECT_EQ(0u, values.count());
+		EXPECT_EQ(0u, values.max());
+	}
+
+	TEST(TEST_CLASS, CanRecordValues) {
+		// Arrange:
+		DiagnosticHistogram histogram;
+
+		// Act:
+		for (auto i = 1u; i <= 1000; ++i)
+			histogram.record(i);
+
+		auto values = histogram.values();
+
+		// Assert:
+		EXPECT_EQ(1000u, values.count());
+		EXPECT_EQ(1000u, values.max());
+
+		for (auto percentile : { 10, 50, 90, 99 }) {
+			auto expectedValue = 10u * static_cast<uint32_t>(percentile);
+			EXPECT_LE(expectedValue, values.percentile(static_cast<uint8_t>(percentile))) << percentile;
+			EXPECT_GE(expectedValue + expectedValue / 4, values.percentile(static_cast<uint8_t>(percentile))) << percentile;
+		}
+	}
+
+	TEST(TEST_CLASS, CanRecordValuesFromMultipleThreads) {
+		// Arrange:
+		constexpr auto Num_Threads = 8u;
+		constexpr auto Num_Values_Per_Thread = 10'000u;
+		DiagnosticHistogram histogram;
+
+		// Act:
+		thread::ThreadGroup threads;
+		for (auto i = 0u; i < Num_Threads; ++i) {
+			threads.spawn([&histogram, i]() {
+				for (auto j = 0u; j < Num_Values_Per_Thread; ++j)
+					histogram.record(i * Num_Values_Per_Thread + j);
+			});
+		}
+
+		threads.join();
+		auto values = histogram.values();
+
+		// Assert:
+		EXPECT_EQ(Num_Threads * Num_Values_Per_Thread, values.count());
+		EXPECT_EQ(Num_Threads * Num_Values_Per_Thread - 1, values.max());
+	}
+
+	// endregion
+}}
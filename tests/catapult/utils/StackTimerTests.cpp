@@ -55,6 +55,22 @@ namespace catapult { namespace utils {
 		EXPECT_LE(elapsedMillis1, elapsedMillis2);
 	}
 
+	TEST(TEST_CLASS, ElapsedMicrosIsConsistentWithElapsedMillis) {
+		// Arrange:
+		StackTimer stackTimer;
+		test::Sleep(5);
+
+		// Act:
+		auto elapsedMillis1 = stackTimer.millis();
+		auto elapsedMicros = stackTimer.micros();
+		auto elapsedMillis2 = stackTimer.millis();
+
+		// Assert:
+		EXPECT_LE(5'000u, elapsedMicros);
+		EXPECT_LE(elapsedMillis1 * 1000, elapsedMicros);
+		EXPECT_LT(elapsedMicros, (elapsedMillis2 + 1) * 1000);
+	}
+
 	namespace {
 		constexpr auto Sleep_Millis = 5u;
 		constexpr auto Epsilon_Millis = 1u;
@@ -74,6 +74,9 @@ namespace catapult { namespace local {
 		EXPECT_TRUE(test::HasCounter(counters, "UT CACHE")) << "local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "UT CACHE MEM")) << "local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "TOT CONF TXES")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "HOT BLK HIT")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "HOT BLK MISS")) << "local node counters";
+		EXPECT_TRUE(test::HasCounter(counters, "HOT BLK MEM")) << "local node counters";
 		EXPECT_TRUE(test::HasCounter(counters, "MEM CUR RSS")) << "memory counters";
 		EXPECT_TRUE(test::HasCounter(counters, "NODES")) << "node container counters";
 		EXPECT_TRUE(test::HasCounter(counters, "BAN ACT")) << "banned nodes container counters";
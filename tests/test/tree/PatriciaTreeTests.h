@@ -1484,6 +1484,107 @@ namespace catapult { namespace test {
 
 		// endregion
 
+		// region setBatch
+
+	private:
+		using KeyValuePairs = std::vector<std::pair<uint32_t, std::string>>;
+
+		static void AssertSetBatchIsEquivalentToSet(const KeyValuePairs& seedPairs, const KeyValuePairs& pairs) {
+			// Arrange:
+			TestContext expectedContext(tree::DataSourceVerbosity::Off);
+			TestContext context(tree::DataSourceVerbosity::Off);
+			for (const auto& pair : seedPairs) {
+				expectedContext.tree().set(pair.first, pair.second);
+				context.tree().set(pair.first, pair.second);
+			}
+
+			for (const auto& pair : pairs)
+				expectedContext.tree().set(pair.first, pair.second);
+
+			// Act:
+			context.tree().setBatch(pairs);
+
+			// Assert:
+			EXPECT_EQ(expectedContext.tree().root(), context.tree().root());
+		}
+
+	public:
+		static void AssertSetBatchWithNoPairsHasNoEffect() {
+			// Arrange:
+			TestContext context;
+			context.tree().set(0x64'6F'00'00, "verb");
+			context.tree().set(0x64'6F'67'00, "puppy");
+			auto rootHash = context.tree().root();
+
+			// Act:
+			context.tree().setBatch(KeyValuePairs());
+
+			// Assert:
+			EXPECT_EQ(rootHash, context.tree().root());
+		}
+
+		static void AssertCanSetBatchIntoEmptyTree() {
+			// Arrange:
+			TestContext context;
+
+			// Act:
+			context.tree().setBatch(KeyValuePairs{
+				{ 0x68'6F'72'73, "stallion" },
+				{ 0x64'6F'67'00, "puppy" },
+				{ 0x64'6F'00'00, "verb" },
+				{ 0x64'6F'67'65, "coin" }
+			});
+
+			// Assert:
+			auto checker = CreateCheckerForCanCreatePuppyTreeWithRootExtensionNode(context.dataSource());
+			EXPECT_EQ(checker.get("root"), context.tree().root());
+			context.verifyDataSourceSize(7);
+			checker.checkReachable(context.tree().root(), {
+				"verb", "puppy", "coin", "puppy-coin", "verb-puppy-coin", "stallion", "root"
+			});
+
+			AssertLeaves(context.tree(), {
+				{ 0x64'6F'00'00, "verb" }, { 0x64'6F'67'00, "puppy" }, { 0x64'6F'67'65, "coin" }, { 0x68'6F'72'73, "stallion" }
+			});
+		}
+
+		static void AssertCanSetBatchIntoTreeWithRootLeafNode() {
+			AssertSetBatchIsEquivalentToSet(
+					{ { 0x64'6F'00'00, "verb" } },
+					{ { 0x64'6F'67'00, "puppy" }, { 0x64'6F'00'00, "noun" }, { 0x64'6F'67'65, "coin" } });
+		}
+
+		static void AssertCanSetBatchIntoTreeWithRootExtensionNode() {
+			// Assert: stallion splits the root extension node, kitten updates a leaf and dog is added to an existing branch
+			AssertSetBatchIsEquivalentToSet(
+					{ { 0x64'6F'00'00, "verb" }, { 0x64'6F'67'00, "puppy" }, { 0x64'6F'67'65, "coin" } },
+					{ { 0x68'6F'72'73, "stallion" }, { 0x64'6F'67'00, "kitten" }, { 0x64'6F'67'01, "dog" } });
+		}
+
+		static void AssertSetBatchRetainsLastValueForDuplicateKeys() {
+			AssertSetBatchIsEquivalentToSet(
+					{ { 0x64'6F'00'00, "verb" } },
+					{ { 0x64'6F'67'00, "kitten" }, { 0x64'6F'00'00, "noun" }, { 0x64'6F'67'00, "pony" } });
+		}
+
+		static void AssertSetBatchIsEquivalentToSetForManyValues() {
+			// Arrange: seed the tree with random values and then update some of them and insert new ones
+			KeyValuePairs seedPairs;
+			for (auto i = 0u; i < 100; ++i)
+				seedPairs.emplace_back(static_cast<uint32_t>(Random()), std::to_string(i));
+
+			KeyValuePairs pairs;
+			for (auto i = 0u; i < 1000; ++i) {
+				auto key = 0 == i % 10 ? seedPairs[i / 10].first : static_cast<uint32_t>(Random());
+				pairs.emplace_back(key, "updated " + std::to_string(i));
+			}
+
+			// Act + Assert:
+			AssertSetBatchIsEquivalentToSet(seedPairs, pairs);
+		}
+
+		// endregion
+
 		// region tryLoad
 
 	private:
@@ -1704,6 +1805,13 @@ namespace catapult { namespace test {
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanCreatePuppyTreeWithRootExtensionNode_AnyOrder) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanUndoPuppyTreeWithRootExtensionNode_AnyOrder) \
 	\
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchWithNoPairsHasNoEffect) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanSetBatchIntoEmptyTree) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanSetBatchIntoTreeWithRootLeafNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanSetBatchIntoTreeWithRootExtensionNode) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchRetainsLastValueForDuplicateKeys) \
+	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, SetBatchIsEquivalentToSetForManyValues) \
+	\
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundLatestRootHash) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundPreviousRootHash) \
 	MAKE_PATRICIA_TREE_TEST(TRAITS_NAME, CanLoadTreeAroundNonRootHash) \